@@ -63,6 +63,7 @@ void add_logging_options(CLI::App& cli, log::Settings& log_settings) {
     log_opts.add_flag("--log.utc", log_settings.log_utc, "Prints log timings in UTC");
     log_opts.add_flag("--log.threads", log_settings.log_threads, "Prints thread ids");
     log_opts.add_option("--log.file", log_settings.log_file, "Tee all log lines to given file name");
+    log_opts.add_flag("--log.async", log_settings.log_async, "Writes log lines in background, dropping them if overwhelmed");
 }
 
 void add_option_chain(CLI::App& cli, uint64_t& network_id) {
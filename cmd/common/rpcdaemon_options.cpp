@@ -18,6 +18,10 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
 
 #include <absl/strings/str_split.h>
 
@@ -107,6 +111,18 @@ void add_rpcdaemon_options(CLI::App& cli, silkworm::rpc::DaemonSettings& setting
     cli.add_flag("--erigon_compatibility", settings.erigon_json_rpc_compatibility)
         ->description("Flag indicating if strict compatibility with Erigon RpcDaemon is enabled")
         ->capture_default_str();
+
+    cli.add_option_function<uint32_t>("--logs.query.timeout", [&settings](uint32_t timeout) {
+        settings.logs_query_timeout = std::chrono::milliseconds{timeout};
+    })
+        ->description("Max duration of a single logs query or Otterscan transaction search (in milliseconds)")
+        ->check(CLI::Range(1u, std::numeric_limits<uint32_t>::max()))
+        ->default_str(std::to_string(settings.logs_query_timeout.count()));
+
+    cli.add_option("--trace.filter.max.blocks", settings.trace_filter_max_blocks)
+        ->description("Max number of blocks in the range of a single trace_filter request")
+        ->check(CLI::Range(uint64_t{1}, std::numeric_limits<uint64_t>::max()))
+        ->capture_default_str();
 }
 
 }  // namespace silkworm::cmd::common
@@ -95,6 +95,21 @@ void add_sentry_options(CLI::App& cli, silkworm::sentry::Settings& settings) {
         ->description("Maximum number of P2P network peers")
         ->check(CLI::Range(0, 1000))
         ->capture_default_str();
+
+    cli.add_option("--sentry.inbound.attempts", settings.max_inbound_attempts_per_ip)
+        ->description("Maximum number of inbound connection attempts accepted from the same IP address within the throttle window")
+        ->check(CLI::Range(1, 1000))
+        ->capture_default_str();
+
+    cli.add_option("--sentry.inbound.window", settings.inbound_throttle_window_seconds)
+        ->description("Inbound connection throttle window (in seconds)")
+        ->check(CLI::Range(1, 3600))
+        ->capture_default_str();
+
+    cli.add_option("--sentry.inbound.handshakes", settings.max_inbound_handshakes)
+        ->description("Maximum number of inbound peer handshakes in progress at the same time")
+        ->check(CLI::Range(1, 1000))
+        ->capture_default_str();
 }
 
 }  // namespace silkworm::cmd::common
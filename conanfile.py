@@ -43,6 +43,7 @@ class SilkwormRecipe(ConanFile):
         self.requires('snappy/1.1.7')
         self.requires('sqlitecpp/3.3.0')
         self.requires('tomlplusplus/3.3.0')
+        self.requires('zlib/1.2.13')
 
     def configure(self):
         self.options['asio-grpc'].local_allocator = 'boost_container'
@@ -16,13 +16,24 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <thread>
 
 #include <boost/asio/cancellation_signal.hpp>
+#include <boost/circular_buffer.hpp>
 
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/execution/evm.hpp>
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/core/types/block.hpp>
 #include <silkworm/infra/concurrency/context_pool_settings.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/db/mdbx.hpp>
 #include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/silkrpc/daemon.hpp>
 
@@ -35,4 +46,50 @@ struct SilkwormInstance {
     // sentry
     std::unique_ptr<std::thread> sentry_thread;
     boost::asio::cancellation_signal sentry_stop_signal;
+
+    // execution: EVM caches kept warm across silkworm_execute_blocks calls
+    std::unique_ptr<silkworm::AnalysisCache> analysis_cache;
+    std::unique_ptr<silkworm::ObjectPool<evmone::ExecutionState>> state_pool;
+
+    // execution sessions opened and not closed yet, silkworm_fini refuses to destroy the instance until they are closed
+    std::atomic_size_t open_sessions{0};
+};
+
+//! Max number of blocks read ahead from storage by one block execution session
+inline constexpr std::size_t kMaxPrefetchedBlocks{10240};
+
+//! The execution state kept alive across silkworm_execution_session_execute calls: the state buffer bound to the
+//! caller-owned MDBX transaction, the blocks already read ahead and the gas accumulated towards the next flush
+struct SilkwormExecutionSession {
+    SilkwormExecutionSession(SilkwormInstance& silkworm_instance, MDBX_txn* mdbx_txn, const silkworm::ChainConfig& config,
+                             silkworm::protocol::RuleSetPtr protocol_rule_set)
+        : instance{silkworm_instance},
+          txn{mdbx_txn},
+          state_buffer{txn, /*prune_history_threshold=*/0},
+          access_layer{txn},
+          chain_config{config},
+          rule_set{std::move(protocol_rule_set)},
+          prefetched_blocks{/*buffer_capacity=*/kMaxPrefetchedBlocks} {
+        ++instance.open_sessions;
+    }
+    ~SilkwormExecutionSession() { --instance.open_sessions; }
+
+    SilkwormExecutionSession(const SilkwormExecutionSession&) = delete;
+    SilkwormExecutionSession& operator=(const SilkwormExecutionSession&) = delete;
+
+    SilkwormInstance& instance;
+    silkworm::db::RWTxnUnmanaged txn;  // MDBX txn is only used but neither aborted nor committed
+    silkworm::db::Buffer state_buffer;
+    silkworm::db::DataModel access_layer;
+    const silkworm::ChainConfig& chain_config;
+    silkworm::protocol::RuleSetPtr rule_set;
+    bool write_change_sets{true};
+    bool write_receipts{true};
+    bool write_call_traces{false};
+
+    boost::circular_buffer<silkworm::Block> prefetched_blocks;  // consecutive blocks read ahead, next one first
+    std::optional<silkworm::BlockNum> last_executed_block;      // the last block executed in this session, if any
+    std::size_t gas_batch_size{0};                              // gas executed since last state flush
+    std::size_t gas_history_size{0};                            // gas executed since last history flush
+    bool failed{false};                                         // an exception left the buffered state unreliable
 };
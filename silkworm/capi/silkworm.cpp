@@ -21,8 +21,6 @@
 #include <memory>
 #include <vector>
 
-#include <boost/circular_buffer.hpp>
-
 #include <silkworm/buildinfo.h>
 #include <silkworm/core/chain/config.hpp>
 #include <silkworm/core/execution/call_tracer.hpp>
@@ -52,6 +50,9 @@ static log::Settings kLogSettingsLikeErigon{
     .log_trim = true,       // compact rendering (i.e. no whitespaces)
 };
 
+//! Capacity of the EVM code analysis cache shared by all block executions of one Silkworm instance
+static constexpr size_t kAnalysisCacheSize{5'000};
+
 using SteadyTimePoint = std::chrono::time_point<std::chrono::steady_clock>;
 
 //! The progress reached by the block execution process
@@ -130,6 +131,9 @@ class SignalHandlerGuard {
     ~SignalHandlerGuard() { SignalHandler::reset(); }
 };
 
+//! Only one Silkworm instance at a time is allowed
+static bool is_initialized{false};
+
 SILKWORM_EXPORT int silkworm_init(
     SilkwormHandle* handle,
     const struct SilkwormSettings* settings) SILKWORM_NOEXCEPT {
@@ -140,7 +144,6 @@ SILKWORM_EXPORT int silkworm_init(
         return SILKWORM_INVALID_SETTINGS;
     }
 
-    static bool is_initialized = false;
     if (is_initialized) {
         return SILKWORM_TOO_MANY_INSTANCES;
     } else {
@@ -160,6 +163,9 @@ SILKWORM_EXPORT int silkworm_init(
         {},  // rpcdaemon unique_ptr
         {},  // sentry_thread unique_ptr
         {},  // sentry_stop_signal
+        std::make_unique<AnalysisCache>(kAnalysisCacheSize, /*thread_safe=*/true),
+        std::make_unique<ObjectPool<evmone::ExecutionState>>(/*thread_safe=*/true),
+        {},  // open_sessions
     };
     return SILKWORM_OK;
 }
@@ -349,6 +355,157 @@ SILKWORM_EXPORT int silkworm_stop_rpcdaemon(SilkwormHandle handle) SILKWORM_NOEX
     return SILKWORM_OK;
 }
 
+//! Run the given function translating any exception into the corresponding error code
+template <typename F>
+static int execute_guarded(F&& f, int* mdbx_error_code) noexcept {
+    try {
+        return f();
+    } catch (const mdbx::exception& e) {
+        if (mdbx_error_code) {
+            *mdbx_error_code = e.error().code();
+        }
+        return SILKWORM_MDBX_ERROR;
+    } catch (const DecodingError&) {
+        return SILKWORM_DECODING_ERROR;
+    } catch (const std::exception& e) {
+        SILK_ERROR << "exception: " << e.what();
+        return SILKWORM_INTERNAL_ERROR;
+    } catch (...) {
+        return SILKWORM_UNKNOWN_ERROR;
+    }
+}
+
+//! Create a new execution session, returning the error code if the chain is unknown
+static int make_execution_session(SilkwormHandle handle, MDBX_txn* mdbx_txn, uint64_t chain_id,
+                                  std::unique_ptr<SilkwormExecutionSession>& session) {
+    const auto chain_info = kKnownChainConfigs.find(chain_id);
+    if (!chain_info) {
+        return SILKWORM_UNKNOWN_CHAIN_ID;
+    }
+    const ChainConfig* chain_config{*chain_info};
+    auto protocol_rule_set{protocol::rule_set_factory(*chain_config)};
+    if (!protocol_rule_set) {
+        return SILKWORM_UNKNOWN_CHAIN_ID;
+    }
+    session = std::make_unique<SilkwormExecutionSession>(*handle, mdbx_txn, *chain_config, std::move(protocol_rule_set));
+    return SILKWORM_OK;
+}
+
+//! Read ahead the blocks starting from block_number up to max_block, reusing those already prefetched if any
+static bool prefetch_blocks(SilkwormExecutionSession& session, BlockNum block_number, BlockNum max_block) {
+    auto& prefetched_blocks{session.prefetched_blocks};
+    if (!prefetched_blocks.empty() && prefetched_blocks.front().header.number != block_number) {
+        prefetched_blocks.clear();  // not the blocks we are looking for
+    }
+    if (!prefetched_blocks.empty()) {
+        return true;
+    }
+    const auto num_blocks{std::min(size_t(max_block - block_number + 1), kMaxPrefetchedBlocks)};
+    SILK_TRACE << "Prefetching " << num_blocks << " blocks start";
+    for (BlockNum n{block_number}; n < block_number + num_blocks; ++n) {
+        prefetched_blocks.push_back();
+        if (!session.access_layer.read_block(n, /*read_senders=*/true, prefetched_blocks.back())) {
+            prefetched_blocks.pop_back();
+            return !prefetched_blocks.empty();  // blocks found so far are still good for execution
+        }
+    }
+    SILK_TRACE << "Prefetching " << num_blocks << " blocks done";
+    return true;
+}
+
+//! Execute the blocks in [start_block, max_block] within the session, flushing the state buffer into the session txn
+//! when the accumulated gas exceeds the limits derived from batch_size
+static int execute_blocks(SilkwormExecutionSession& session, uint64_t start_block, uint64_t max_block,
+                          uint64_t batch_size, uint64_t* last_executed_block) {
+    auto& state_buffer{session.state_buffer};
+
+    // Transform batch size limit into gas units (Ggas = Giga gas, Tgas = Tera gas)
+    const size_t gas_max_history_size{batch_size * 1_Kibi / 2};  // 512MB -> 256Ggas roughly
+    const size_t gas_max_batch_size{gas_max_history_size * 20};  // 256Ggas -> 5Tgas roughly
+
+    ExecutionProgress progress{.start_time = std::chrono::steady_clock::now()};
+    auto signal_check_time{progress.start_time};
+    auto log_time{progress.start_time};
+
+    for (BlockNum block_number{start_block}; block_number <= max_block; ++block_number) {
+        if (!prefetch_blocks(session, block_number, max_block)) {
+            return SILKWORM_BLOCK_NOT_FOUND;
+        }
+        const Block& block{session.prefetched_blocks.front()};
+
+        ExecutionProcessor processor{block, *session.rule_set, state_buffer, session.chain_config};
+        processor.evm().analysis_cache = session.instance.analysis_cache.get();
+        processor.evm().state_pool = session.instance.state_pool.get();
+        CallTraces traces;
+        CallTracer tracer{traces};
+        if (session.write_call_traces) {
+            processor.evm().add_tracer(tracer);
+        }
+
+        std::vector<Receipt> receipts;
+        const auto result{processor.execute_and_write_block(receipts)};
+        if (result != ValidationResult::kOk) {
+            return SILKWORM_INVALID_BLOCK;
+        }
+
+        if (session.write_receipts) {
+            state_buffer.insert_receipts(block.header.number, receipts);
+        }
+        if (session.write_call_traces) {
+            state_buffer.insert_call_traces(block.header.number, traces);
+        }
+
+        session.last_executed_block = block.header.number;
+        if (last_executed_block) {
+            *last_executed_block = block.header.number;
+        }
+
+        ++progress.processed_blocks;
+        progress.processed_transactions += block.transactions.size();
+        progress.processed_gas += block.header.gas_used;
+        session.gas_batch_size += block.header.gas_used;
+        session.gas_history_size += block.header.gas_used;
+
+        session.prefetched_blocks.pop_front();
+
+        // Flush whole state buffer or just history if we've reached the target batch sizes in gas units
+        if (session.gas_batch_size >= gas_max_batch_size) {
+            SILK_TRACE << log::Args{"buffer", "state", "size", human_size(state_buffer.current_batch_state_size())};
+            state_buffer.write_to_db(session.write_change_sets);
+            session.gas_batch_size = 0;
+        } else if (session.gas_history_size >= gas_max_history_size) {
+            SILK_TRACE << log::Args{"buffer", "history", "size", human_size(state_buffer.current_batch_history_size())};
+            state_buffer.write_history_to_db(session.write_change_sets);
+            session.gas_history_size = 0;
+        }
+
+        const auto now{std::chrono::steady_clock::now()};
+        if (signal_check_time <= now) {
+            if (SignalHandler::signalled()) {
+                return SILKWORM_TERMINATION_SIGNAL;
+            }
+            signal_check_time = now + 5s;
+        }
+        if (log_time <= now) {
+            progress.gas_state_perc = float(session.gas_batch_size) / float(gas_max_batch_size);
+            progress.gas_history_perc = float(session.gas_history_size) / float(gas_max_history_size);
+            progress.end_time = now;
+            log::Info{"[4/12 Execution] Executed blocks",  // NOLINT(*-unused-raii)
+                      log_args_for_exec_progress(progress, block.header.number)};
+            log_time = now + 20s;
+        }
+    }
+
+    return SILKWORM_OK;
+}
+
+//! Write all the changes accumulated in the session state buffer into the session txn
+static void flush_execution_session(SilkwormExecutionSession& session) {
+    session.state_buffer.write_to_db(session.write_change_sets);
+    session.gas_batch_size = 0;
+    session.gas_history_size = 0;
+}
+
 SILKWORM_EXPORT
 int silkworm_execute_blocks(SilkwormHandle handle, MDBX_txn* mdbx_txn, uint64_t chain_id, uint64_t start_block, uint64_t max_block,
                             uint64_t batch_size, bool write_change_sets, bool write_receipts, bool write_call_traces,
@@ -362,133 +519,112 @@ int silkworm_execute_blocks(SilkwormHandle handle, MDBX_txn* mdbx_txn, uint64_t
     if (start_block > max_block) {
         return SILKWORM_INVALID_BLOCK_RANGE;
     }
-    const auto chain_info = kKnownChainConfigs.find(chain_id);
-    if (!chain_info) {
-        return SILKWORM_UNKNOWN_CHAIN_ID;
-    }
-    const ChainConfig* chain_config{*chain_info};
 
     SignalHandlerGuard signal_guard;
-    try {
-        // Wrap MDBX txn into an internal *unmanaged* txn, i.e. MDBX txn is only used but neither aborted nor committed
-        db::RWTxnUnmanaged txn{mdbx_txn};
-
-        db::Buffer state_buffer{txn, /*prune_history_threshold=*/0};
-        db::DataModel access_layer{txn};
-
-        static constexpr size_t kCacheSize{5'000};
-        AnalysisCache analysis_cache{kCacheSize};
-        ObjectPool<evmone::ExecutionState> state_pool;
-
-        // Transform batch size limit into gas units (Ggas = Giga gas, Tgas = Tera gas)
-        const size_t gas_max_history_size{batch_size * 1_Kibi / 2};  // 512MB -> 256Ggas roughly
-        const size_t gas_max_batch_size{gas_max_history_size * 20};  // 256Ggas -> 5Tgas roughly
-
-        // Preload requested blocks in batches from storage, i.e. from MDBX database or snapshots
-        static constexpr size_t kMaxPrefetchedBlocks{10240};
-        boost::circular_buffer<Block> prefetched_blocks{/*buffer_capacity=*/kMaxPrefetchedBlocks};
-
-        ExecutionProgress progress{.start_time = std::chrono::steady_clock::now()};
-        auto signal_check_time{progress.start_time};
-        auto log_time{progress.start_time};
-
-        size_t gas_batch_size{0}, gas_history_size{0};
-        for (BlockNum block_number{start_block}; block_number <= max_block; ++block_number) {
-            if (prefetched_blocks.empty()) {
-                const auto num_blocks{std::min(size_t(max_block - block_number + 1), kMaxPrefetchedBlocks)};
-                SILK_TRACE << "Prefetching " << num_blocks << " blocks start";
-                for (BlockNum n{block_number}; n < block_number + num_blocks; ++n) {
-                    prefetched_blocks.push_back();
-                    const bool success{access_layer.read_block(n, /*read_senders=*/true, prefetched_blocks.back())};
-                    if (!success) {
-                        return SILKWORM_BLOCK_NOT_FOUND;
-                    }
-                }
-                SILK_TRACE << "Prefetching " << num_blocks << " blocks done";
+    return execute_guarded(
+        [&]() {
+            std::unique_ptr<SilkwormExecutionSession> session;
+            if (const int status{make_execution_session(handle, mdbx_txn, chain_id, session)}; status != SILKWORM_OK) {
+                return status;
             }
-            const Block& block{prefetched_blocks.front()};
-
-            const auto protocol_rule_set{protocol::rule_set_factory(*chain_config)};
-            if (!protocol_rule_set) {
-                return SILKWORM_UNKNOWN_CHAIN_ID;
-            }
-            ExecutionProcessor processor{block, *protocol_rule_set, state_buffer, *chain_config};
-            processor.evm().analysis_cache = &analysis_cache;
-            processor.evm().state_pool = &state_pool;
-            CallTraces traces;
-            CallTracer tracer{traces};
-            if (write_call_traces) {
-                processor.evm().add_tracer(tracer);
+            session->write_change_sets = write_change_sets;
+            session->write_receipts = write_receipts;
+            session->write_call_traces = write_call_traces;
+
+            // Reaching the end of the chain is not an error: the blocks executed so far must be written anyway
+            const int status{execute_blocks(*session, start_block, max_block, batch_size, last_executed_block)};
+            if (status == SILKWORM_OK || status == SILKWORM_BLOCK_NOT_FOUND) {
+                flush_execution_session(*session);
             }
+            return status;
+        },
+        mdbx_error_code);
+}
 
-            std::vector<Receipt> receipts;
-            const auto result{processor.execute_and_write_block(receipts)};
-            if (result != ValidationResult::kOk) {
-                return SILKWORM_INVALID_BLOCK;
-            }
+SILKWORM_EXPORT int silkworm_execution_session_open(SilkwormHandle handle, MDBX_txn* mdbx_txn, uint64_t chain_id,
+                                                    bool write_change_sets, bool write_receipts, bool write_call_traces,
+                                                    SilkwormExecutionSessionHandle* session) SILKWORM_NOEXCEPT {
+    if (!handle) {
+        return SILKWORM_INVALID_HANDLE;
+    }
+    if (!mdbx_txn) {
+        return SILKWORM_INVALID_MDBX_TXN;
+    }
+    if (!session) {
+        return SILKWORM_INVALID_SESSION;
+    }
 
-            if (write_receipts) {
-                state_buffer.insert_receipts(block.header.number, receipts);
-            }
-            if (write_call_traces) {
-                state_buffer.insert_call_traces(block.header.number, traces);
+    return execute_guarded(
+        [&]() {
+            std::unique_ptr<SilkwormExecutionSession> new_session;
+            if (const int status{make_execution_session(handle, mdbx_txn, chain_id, new_session)}; status != SILKWORM_OK) {
+                return status;
             }
+            new_session->write_change_sets = write_change_sets;
+            new_session->write_receipts = write_receipts;
+            new_session->write_call_traces = write_call_traces;
+            *session = new_session.release();
+            return SILKWORM_OK;
+        },
+        /*mdbx_error_code=*/nullptr);
+}
 
-            if (last_executed_block) {
-                *last_executed_block = block.header.number;
-            }
+SILKWORM_EXPORT int silkworm_execution_session_execute(SilkwormExecutionSessionHandle session, uint64_t start_block,
+                                                       uint64_t max_block, uint64_t batch_size,
+                                                       uint64_t* last_executed_block,
+                                                       int* mdbx_error_code) SILKWORM_NOEXCEPT {
+    if (!session) {
+        return SILKWORM_INVALID_SESSION;
+    }
+    if (session->failed) {
+        return SILKWORM_SESSION_FAILED;
+    }
+    if (start_block > max_block) {
+        return SILKWORM_INVALID_BLOCK_RANGE;
+    }
+    // Blocks executed in the session must be consecutive, otherwise the buffered state would be inconsistent
+    if (session->last_executed_block && start_block != *session->last_executed_block + 1) {
+        return SILKWORM_INVALID_BLOCK_RANGE;
+    }
 
-            ++progress.processed_blocks;
-            progress.processed_transactions += block.transactions.size();
-            progress.processed_gas += block.header.gas_used;
-            gas_batch_size += block.header.gas_used;
-            gas_history_size += block.header.gas_used;
-
-            prefetched_blocks.pop_front();
-
-            // Flush whole state buffer or just history if we've reached the target batch sizes in gas units
-            if (gas_batch_size >= gas_max_batch_size) {
-                SILK_TRACE << log::Args{"buffer", "state", "size", human_size(state_buffer.current_batch_state_size())};
-                state_buffer.write_to_db(write_change_sets);
-                gas_batch_size = 0;
-            } else if (gas_history_size >= gas_max_history_size) {
-                SILK_TRACE << log::Args{"buffer", "history", "size", human_size(state_buffer.current_batch_history_size())};
-                state_buffer.write_history_to_db(write_change_sets);
-                gas_history_size = 0;
-            }
+    SignalHandlerGuard signal_guard;
+    return execute_guarded(
+        [&]() {
+            // An exception may escape in the middle of a block: the flag is left set in that case only
+            session->failed = true;
+            const int status{execute_blocks(*session, start_block, max_block, batch_size, last_executed_block)};
+            session->failed = false;
+            return status;
+        },
+        mdbx_error_code);
+}
 
-            const auto now{std::chrono::steady_clock::now()};
-            if (signal_check_time <= now) {
-                if (SignalHandler::signalled()) {
-                    return SILKWORM_TERMINATION_SIGNAL;
-                }
-                signal_check_time = now + 5s;
-            }
-            if (log_time <= now) {
-                progress.gas_state_perc = float(gas_batch_size) / float(gas_max_batch_size);
-                progress.gas_history_perc = float(gas_history_size) / float(gas_max_history_size);
-                progress.end_time = now;
-                log::Info{"[4/12 Execution] Executed blocks",  // NOLINT(*-unused-raii)
-                          log_args_for_exec_progress(progress, block.header.number)};
-                log_time = now + 20s;
-            }
-        }
+SILKWORM_EXPORT int silkworm_execution_session_flush(SilkwormExecutionSessionHandle session,
+                                                     int* mdbx_error_code) SILKWORM_NOEXCEPT {
+    if (!session) {
+        return SILKWORM_INVALID_SESSION;
+    }
+    if (session->failed) {
+        return SILKWORM_SESSION_FAILED;
+    }
 
-        state_buffer.write_to_db(write_change_sets);
-        return SILKWORM_OK;
-    } catch (const mdbx::exception& e) {
-        if (mdbx_error_code) {
-            *mdbx_error_code = e.error().code();
-        }
-        return SILKWORM_MDBX_ERROR;
-    } catch (const DecodingError&) {
-        return SILKWORM_DECODING_ERROR;
-    } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what();
-        return SILKWORM_INTERNAL_ERROR;
-    } catch (...) {
-        return SILKWORM_UNKNOWN_ERROR;
+    return execute_guarded(
+        [&]() {
+            // The state buffer may be partially written if an exception escapes
+            session->failed = true;
+            flush_execution_session(*session);
+            session->failed = false;
+            return SILKWORM_OK;
+        },
+        mdbx_error_code);
+}
+
+SILKWORM_EXPORT int silkworm_execution_session_close(SilkwormExecutionSessionHandle session) SILKWORM_NOEXCEPT {
+    if (!session) {
+        return SILKWORM_INVALID_SESSION;
     }
+    delete session;
+    return SILKWORM_OK;
 }
 
 SILKWORM_EXPORT int silkworm_fini(SilkwormHandle handle) SILKWORM_NOEXCEPT {
@@ -498,6 +634,10 @@ SILKWORM_EXPORT int silkworm_fini(SilkwormHandle handle) SILKWORM_NOEXCEPT {
     if (!handle->snapshot_repository) {
         return SILKWORM_INVALID_HANDLE;
     }
+    if (handle->open_sessions > 0) {
+        return SILKWORM_SESSIONS_STILL_OPEN;
+    }
     delete handle;
+    is_initialized = false;
     return SILKWORM_OK;
 }
@@ -58,6 +58,9 @@ extern "C" {
 #define SILKWORM_INVALID_SETTINGS 14
 #define SILKWORM_TERMINATION_SIGNAL 15
 #define SILKWORM_SERVICE_ALREADY_STARTED 16
+#define SILKWORM_INVALID_SESSION 17
+#define SILKWORM_SESSION_FAILED 18
+#define SILKWORM_SESSIONS_STILL_OPEN 19
 
 typedef struct MDBX_env MDBX_env;
 typedef struct MDBX_txn MDBX_txn;
@@ -65,6 +68,9 @@ typedef struct MDBX_txn MDBX_txn;
 struct SilkwormInstance;
 typedef struct SilkwormInstance* SilkwormHandle;
 
+struct SilkwormExecutionSession;
+typedef struct SilkwormExecutionSession* SilkwormExecutionSessionHandle;
+
 struct SilkwormMemoryMappedFile {
     const char* file_path;
     uint8_t* memory_address;
@@ -169,6 +175,7 @@ SILKWORM_EXPORT int silkworm_sentry_stop(SilkwormHandle handle) SILKWORM_NOEXCEP
 
 /**
  * \brief Execute a batch of blocks and write resulting changes into the database.
+ * EVM caches (e.g. code analysis) are owned by the Silkworm instance, so they stay warm across successive calls.
  * \param[in] handle A valid Silkworm instance handle, got with silkworm_init.
  * \param[in] txn A valid read-write MDBX transaction. Must not be zero.
  * This function does not commit nor abort the transaction.
@@ -194,10 +201,74 @@ SILKWORM_EXPORT int silkworm_execute_blocks(
     uint64_t batch_size, bool write_change_sets, bool write_receipts, bool write_call_traces,
     uint64_t* last_executed_block, int* mdbx_error_code) SILKWORM_NOEXCEPT;
 
+/**
+ * \brief Open a block execution session bound to a read-write MDBX transaction.
+ * The session keeps the state buffer, the EVM caches and the blocks read ahead from storage alive across successive
+ * silkworm_execution_session_execute calls, so that an embedding host executing blocks in a loop does not lose them.
+ * Blocks are read ahead in the calling thread because the MDBX transaction cannot be used by other threads.
+ * \param[in] handle A valid Silkworm instance handle, got with silkworm_init.
+ * \param[in] txn A valid read-write MDBX transaction. Must not be zero.
+ * The session neither commits nor aborts the transaction: the caller must flush the session before committing the
+ * transaction and close the session before the transaction ends.
+ * \param[in] chain_id EIP-155 chain ID. SILKWORM_UNKNOWN_CHAIN_ID is returned in case of an unknown or unsupported chain.
+ * \param[in] write_change_sets Whether to write state changes into the DB.
+ * \param[in] write_receipts Whether to write CBOR-encoded receipts into the DB.
+ * \param[in] write_call_traces Whether to write call traces into the DB.
+ * \param[out] session Execution session handle returned on success.
+ * \return SILKWORM_OK (=0) on success, a non-zero error value on failure.
+ */
+SILKWORM_EXPORT int silkworm_execution_session_open(
+    SilkwormHandle handle, MDBX_txn* txn, uint64_t chain_id, bool write_change_sets, bool write_receipts,
+    bool write_call_traces, SilkwormExecutionSessionHandle* session) SILKWORM_NOEXCEPT;
+
+/**
+ * \brief Execute a batch of blocks within the session.
+ * Resulting changes are kept in the session state buffer and written into the session transaction only when the batch
+ * is full or the session is flushed.
+ * \param[in] session A valid execution session handle, got with silkworm_execution_session_open.
+ * \param[in] start_block The block height to start the execution from. It must follow the last block executed in the
+ * session, if any, otherwise SILKWORM_INVALID_BLOCK_RANGE is returned.
+ * \param[in] max_block Do not execute after this block.
+ * \param[in] batch_size The size of DB changes to accumulate before writing them into the session transaction.
+ * \param[out] last_executed_block The height of the last successfully executed block.
+ * Not written to if no blocks were executed, otherwise *last_executed_block ≤ max_block.
+ * \param[out] mdbx_error_code If an MDBX error occurs (this function returns kSilkwormMdbxError)
+ * and mdbx_error_code isn't NULL, it's populated with the relevant MDBX error code.
+ * \return SILKWORM_OK (=0) on success, a non-zero error value on failure.
+ * SILKWORM_BLOCK_NOT_FOUND is probably OK: it simply means that the execution reached the end of the chain
+ * (blocks up to and incl. last_executed_block were still executed).
+ * If the execution fails with an exception (e.g. an MDBX or decoding error) the session state is no longer reliable:
+ * any further execute or flush call returns SILKWORM_SESSION_FAILED and the session can only be closed.
+ */
+SILKWORM_EXPORT int silkworm_execution_session_execute(
+    SilkwormExecutionSessionHandle session, uint64_t start_block, uint64_t max_block, uint64_t batch_size,
+    uint64_t* last_executed_block, int* mdbx_error_code) SILKWORM_NOEXCEPT;
+
+/**
+ * \brief Write all the changes accumulated in the session into the session transaction.
+ * \param[in] session A valid execution session handle, got with silkworm_execution_session_open.
+ * \param[out] mdbx_error_code If an MDBX error occurs (this function returns kSilkwormMdbxError)
+ * and mdbx_error_code isn't NULL, it's populated with the relevant MDBX error code.
+ * \return SILKWORM_OK (=0) on success, a non-zero error value on failure.
+ * SILKWORM_SESSION_FAILED is returned if a previous call failed with an exception. If this call fails the changes may
+ * have been partially written, so the session fails as well.
+ */
+SILKWORM_EXPORT int silkworm_execution_session_flush(
+    SilkwormExecutionSessionHandle session, int* mdbx_error_code) SILKWORM_NOEXCEPT;
+
+/**
+ * \brief Close the session, discarding any change not flushed yet.
+ * \param[in] session A valid execution session handle, got with silkworm_execution_session_open.
+ * \return SILKWORM_OK (=0) on success, a non-zero error value on failure.
+ */
+SILKWORM_EXPORT int silkworm_execution_session_close(SilkwormExecutionSessionHandle session) SILKWORM_NOEXCEPT;
+
 /**
  * \brief Finalize the Silkworm C API library.
  * \param[in] handle A valid Silkworm instance handle got with silkworm_init.
  * \return SILKWORM_OK (=0) on success, a non-zero error value on failure.
+ * SILKWORM_SESSIONS_STILL_OPEN is returned if any execution session has not been closed yet: the instance is kept
+ * alive and silkworm_fini must be called again after closing all the sessions.
  */
 SILKWORM_EXPORT int silkworm_fini(SilkwormHandle handle) SILKWORM_NOEXCEPT;
 
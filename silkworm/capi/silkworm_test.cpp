@@ -0,0 +1,237 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "silkworm.h"
+
+#include <cstring>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/protocol/param.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/test/context.hpp>
+
+namespace silkworm {
+
+//! Number of empty blocks written on top of the genesis block
+static constexpr BlockNum kChainHeight{10};
+
+static constexpr evmc::address kBeneficiary{0x8d4ac9b2d4b9ac4c2af7e52fb7e5eb3ebd80f5b2_address};
+
+//! Write kChainHeight empty canonical blocks after the genesis, all mined by kBeneficiary
+static void add_empty_blocks(db::RWTxn& txn) {
+    auto parent_hash{db::read_canonical_hash(txn, 0)};
+    REQUIRE(parent_hash);
+    for (BlockNum number{1}; number <= kChainHeight; ++number) {
+        Block block;
+        block.header.number = number;
+        block.header.parent_hash = *parent_hash;
+        block.header.beneficiary = kBeneficiary;
+        block.header.difficulty = 17'171'480'576;  // a random value
+        block.header.gas_limit = 5'000;
+        const auto block_hash{block.header.hash()};
+        db::write_header(txn, block.header, /*with_header_numbers=*/true);
+        db::write_canonical_header_hash(txn, block_hash.bytes, number);
+        db::write_body(txn, block, block_hash, number);
+        parent_hash = block_hash;
+    }
+}
+
+//! Write the block following the last empty one with a body that cannot be decoded
+static void add_undecodable_block(db::RWTxn& txn) {
+    const auto parent_hash{db::read_canonical_hash(txn, kChainHeight)};
+    REQUIRE(parent_hash);
+    BlockHeader header;
+    header.number = kChainHeight + 1;
+    header.parent_hash = *parent_hash;
+    header.gas_limit = 5'000;
+    const auto block_hash{header.hash()};
+    db::write_header(txn, header, /*with_header_numbers=*/true);
+    db::write_canonical_header_hash(txn, block_hash.bytes, header.number);
+    const Bytes key{db::block_key(header.number, block_hash.bytes)};
+    const Bytes garbage{0x01};  // an RLP string where the body list is expected
+    txn.rw_cursor(db::table::kBlockBodies)->upsert(db::to_slice(key), db::to_slice(garbage));
+}
+
+//! The balance of kBeneficiary after executing the whole chain, i.e. the sum of the block rewards
+static const intx::uint256 kChainReward{intx::uint256{protocol::kBlockRewardFrontier} * kChainHeight};
+
+static intx::uint256 beneficiary_balance(db::RWTxn& txn) {
+    const auto account{db::read_account(txn, kBeneficiary)};
+    return account ? account->balance : 0;
+}
+
+//! Silkworm instance and database with kChainHeight empty blocks on mainnet, alive for the test duration
+class CApiTest {
+  public:
+    CApiTest() {
+        context_.add_genesis_data();
+        add_empty_blocks(context_.rw_txn());
+
+        SilkwormSettings settings{};
+        const auto data_dir_path{context_.dir().path().string()};
+        std::strncpy(settings.data_dir_path, data_dir_path.c_str(), SILKWORM_PATH_SIZE - 1);
+        REQUIRE(silkworm_init(&handle_, &settings) == SILKWORM_OK);
+    }
+    ~CApiTest() { silkworm_fini(handle_); }
+
+    CApiTest(const CApiTest&) = delete;
+    CApiTest& operator=(const CApiTest&) = delete;
+
+    [[nodiscard]] SilkwormHandle handle() const { return handle_; }
+    [[nodiscard]] MDBX_txn* mdbx_txn() { return static_cast<MDBX_txn*>(context_.txn()); }
+    [[nodiscard]] db::RWTxn& txn() { return context_.rw_txn(); }
+
+  private:
+    test::Context context_;
+    SilkwormHandle handle_{nullptr};
+};
+
+static constexpr uint64_t kMainnetChainId{1};
+static constexpr uint64_t kBatchSize{512 * 1024 * 1024};
+
+TEST_CASE("silkworm_execute_blocks", "[silkworm][capi]") {
+    CApiTest test;
+    uint64_t last_executed_block{0};
+    int mdbx_error_code{0};
+
+    SECTION("all blocks") {
+        CHECK(silkworm_execute_blocks(test.handle(), test.mdbx_txn(), kMainnetChainId, 1, kChainHeight, kBatchSize,
+                                      /*write_change_sets=*/true, /*write_receipts=*/true, /*write_call_traces=*/false,
+                                      &last_executed_block, &mdbx_error_code) == SILKWORM_OK);
+        CHECK(last_executed_block == kChainHeight);
+        CHECK(beneficiary_balance(test.txn()) == kChainReward);
+    }
+
+    SECTION("past the end of the chain") {
+        CHECK(silkworm_execute_blocks(test.handle(), test.mdbx_txn(), kMainnetChainId, 1, kChainHeight + 5, kBatchSize,
+                                      /*write_change_sets=*/true, /*write_receipts=*/true, /*write_call_traces=*/false,
+                                      &last_executed_block, &mdbx_error_code) == SILKWORM_BLOCK_NOT_FOUND);
+        CHECK(last_executed_block == kChainHeight);
+        // the blocks executed before reaching the end of the chain are written anyway
+        CHECK(beneficiary_balance(test.txn()) == kChainReward);
+    }
+
+    SECTION("invalid arguments") {
+        CHECK(silkworm_execute_blocks(nullptr, test.mdbx_txn(), kMainnetChainId, 1, kChainHeight, kBatchSize,
+                                      true, true, false, &last_executed_block, &mdbx_error_code) == SILKWORM_INVALID_HANDLE);
+        CHECK(silkworm_execute_blocks(test.handle(), nullptr, kMainnetChainId, 1, kChainHeight, kBatchSize,
+                                      true, true, false, &last_executed_block, &mdbx_error_code) == SILKWORM_INVALID_MDBX_TXN);
+        CHECK(silkworm_execute_blocks(test.handle(), test.mdbx_txn(), kMainnetChainId, 2, 1, kBatchSize,
+                                      true, true, false, &last_executed_block, &mdbx_error_code) == SILKWORM_INVALID_BLOCK_RANGE);
+        CHECK(silkworm_execute_blocks(test.handle(), test.mdbx_txn(), 0xDEADBEEF, 1, kChainHeight, kBatchSize,
+                                      true, true, false, &last_executed_block, &mdbx_error_code) == SILKWORM_UNKNOWN_CHAIN_ID);
+    }
+}
+
+TEST_CASE("silkworm_execution_session", "[silkworm][capi]") {
+    CApiTest test;
+    uint64_t last_executed_block{0};
+    int mdbx_error_code{0};
+
+    SilkwormExecutionSessionHandle session{nullptr};
+    REQUIRE(silkworm_execution_session_open(test.handle(), test.mdbx_txn(), kMainnetChainId,
+                                            /*write_change_sets=*/true, /*write_receipts=*/true,
+                                            /*write_call_traces=*/false, &session) == SILKWORM_OK);
+    REQUIRE(session);
+
+    // The batch is large enough to keep all the changes buffered until the session is flushed
+    REQUIRE(silkworm_execution_session_execute(session, 1, 4, kBatchSize, &last_executed_block, &mdbx_error_code) ==
+            SILKWORM_OK);
+    CHECK(last_executed_block == 4);
+    CHECK(beneficiary_balance(test.txn()) == 0);
+
+    SECTION("consecutive batches then flush") {
+        CHECK(silkworm_execution_session_execute(session, 5, kChainHeight, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_OK);
+        CHECK(last_executed_block == kChainHeight);
+        CHECK(beneficiary_balance(test.txn()) == 0);
+
+        CHECK(silkworm_execution_session_flush(session, &mdbx_error_code) == SILKWORM_OK);
+        CHECK(beneficiary_balance(test.txn()) == kChainReward);
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+    }
+
+    SECTION("non-consecutive batch") {
+        CHECK(silkworm_execution_session_execute(session, 6, kChainHeight, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_INVALID_BLOCK_RANGE);
+        CHECK(silkworm_execution_session_execute(session, 4, kChainHeight, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_INVALID_BLOCK_RANGE);
+        CHECK(last_executed_block == 4);
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+    }
+
+    SECTION("past the end of the chain") {
+        CHECK(silkworm_execution_session_execute(session, 5, kChainHeight + 5, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_BLOCK_NOT_FOUND);
+        CHECK(last_executed_block == kChainHeight);
+        CHECK(silkworm_execution_session_flush(session, &mdbx_error_code) == SILKWORM_OK);
+        CHECK(beneficiary_balance(test.txn()) == kChainReward);
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+    }
+
+    SECTION("close without flush discards the changes") {
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+        CHECK(beneficiary_balance(test.txn()) == 0);
+    }
+
+    SECTION("exception fails the session") {
+        add_undecodable_block(test.txn());
+        CHECK(silkworm_execution_session_execute(session, 5, kChainHeight + 1, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_INTERNAL_ERROR);
+        // the failed session cannot be used anymore, not even to write what has been executed so far
+        CHECK(silkworm_execution_session_execute(session, 5, kChainHeight, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_SESSION_FAILED);
+        CHECK(silkworm_execution_session_flush(session, &mdbx_error_code) == SILKWORM_SESSION_FAILED);
+        CHECK(beneficiary_balance(test.txn()) == 0);
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+    }
+
+    SECTION("finalization refused while open") {
+        CHECK(silkworm_fini(test.handle()) == SILKWORM_SESSIONS_STILL_OPEN);
+        // the instance is still alive and usable by the session
+        CHECK(silkworm_execution_session_execute(session, 5, kChainHeight, kBatchSize, &last_executed_block,
+                                                 &mdbx_error_code) == SILKWORM_OK);
+        CHECK(silkworm_execution_session_close(session) == SILKWORM_OK);
+    }
+}
+
+TEST_CASE("silkworm_execution_session invalid arguments", "[silkworm][capi]") {
+    CApiTest test;
+    uint64_t last_executed_block{0};
+    int mdbx_error_code{0};
+    SilkwormExecutionSessionHandle session{nullptr};
+
+    CHECK(silkworm_execution_session_open(nullptr, test.mdbx_txn(), kMainnetChainId, true, true, false, &session) ==
+          SILKWORM_INVALID_HANDLE);
+    CHECK(silkworm_execution_session_open(test.handle(), nullptr, kMainnetChainId, true, true, false, &session) ==
+          SILKWORM_INVALID_MDBX_TXN);
+    CHECK(silkworm_execution_session_open(test.handle(), test.mdbx_txn(), 0xDEADBEEF, true, true, false, &session) ==
+          SILKWORM_UNKNOWN_CHAIN_ID);
+    CHECK(silkworm_execution_session_open(test.handle(), test.mdbx_txn(), kMainnetChainId, true, true, false,
+                                          nullptr) == SILKWORM_INVALID_SESSION);
+    CHECK(session == nullptr);
+
+    CHECK(silkworm_execution_session_execute(nullptr, 1, kChainHeight, kBatchSize, &last_executed_block,
+                                             &mdbx_error_code) == SILKWORM_INVALID_SESSION);
+    CHECK(silkworm_execution_session_flush(nullptr, &mdbx_error_code) == SILKWORM_INVALID_SESSION);
+    CHECK(silkworm_execution_session_close(nullptr) == SILKWORM_INVALID_SESSION);
+}
+
+}  // namespace silkworm
@@ -35,8 +35,16 @@ namespace state {
 
         virtual void revert(IntraBlockState& state) noexcept = 0;
 
+        // The account changed
+        const evmc::address& address() const noexcept { return address_; }
+
+        // The storage location changed, if any
+        virtual const evmc::bytes32* storage_key() const noexcept { return nullptr; }
+
       protected:
-        Delta() = default;
+        explicit Delta(const evmc::address& address) noexcept : address_{address} {}
+
+        evmc::address address_;
     };
 
     // Account created.
@@ -45,9 +53,6 @@ namespace state {
         explicit CreateDelta(const evmc::address& address) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
     };
 
     // Account updated.
@@ -58,7 +63,6 @@ namespace state {
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
         Object previous_;
     };
 
@@ -71,7 +75,6 @@ namespace state {
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
         intx::uint256 previous_;
     };
 
@@ -81,9 +84,6 @@ namespace state {
         explicit SuicideDelta(const evmc::address& address) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
     };
 
     // Account touched.
@@ -92,9 +92,6 @@ namespace state {
         explicit TouchDelta(const evmc::address& address) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
     };
 
     // Storage value changed.
@@ -105,8 +102,9 @@ namespace state {
 
         void revert(IntraBlockState& state) noexcept override;
 
+        const evmc::bytes32* storage_key() const noexcept override { return &key_; }
+
       private:
-        evmc::address address_;
         evmc::bytes32 key_;
         evmc::bytes32 previous_;
     };
@@ -119,7 +117,6 @@ namespace state {
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
         Storage storage_;
     };
 
@@ -129,9 +126,6 @@ namespace state {
         explicit StorageCreateDelta(const evmc::address& address) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
     };
 
     // Storage accessed (see EIP-2929).
@@ -142,7 +136,6 @@ namespace state {
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
         evmc::bytes32 key_;
     };
 
@@ -152,9 +145,6 @@ namespace state {
         explicit AccountAccessDelta(const evmc::address& address) noexcept;
 
         void revert(IntraBlockState& state) noexcept override;
-
-      private:
-        evmc::address address_;
     };
 
     /// Transient storage add/modify/delete delta.
@@ -166,7 +156,6 @@ namespace state {
         void revert(IntraBlockState& state) noexcept override;
 
       private:
-        evmc::address address_;
         evmc::bytes32 key_;
         evmc::bytes32 previous_;
     };
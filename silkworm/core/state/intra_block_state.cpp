@@ -347,6 +347,53 @@ void IntraBlockState::write_to_db(uint64_t block_number) {
     }
 }
 
+void IntraBlockState::write_journal_to_db(uint64_t block_number) {
+    db_.begin_block(block_number);
+
+    FlatHashSet<evmc::address> changed_accounts;
+    FlatHashMap<evmc::address, FlatHashSet<evmc::bytes32>> changed_storage;
+    for (const auto& delta : journal_) {
+        changed_accounts.insert(delta->address());
+        if (const auto* key{delta->storage_key()}) {
+            changed_storage[delta->address()].insert(*key);
+        }
+    }
+
+    for (const auto& [address, keys] : changed_storage) {
+        const auto it1{objects_.find(address)};
+        const auto it2{storage_.find(address)};
+        if (it1 == objects_.end() || !it1->second.current || it2 == storage_.end()) {
+            continue;
+        }
+        for (const auto& key : keys) {
+            if (const auto it3{it2->second.committed.find(key)}; it3 != it2->second.committed.end()) {
+                db_.update_storage(address, it1->second.current->incarnation, key, it3->second.initial,
+                                   it3->second.original);
+            }
+        }
+    }
+
+    for (const auto& address : changed_accounts) {
+        const auto it{objects_.find(address)};
+        if (it == objects_.end()) {
+            continue;
+        }
+        const state::Object& obj{it->second};
+        db_.update_account(address, obj.initial, obj.current);
+        if (!obj.current.has_value()) {
+            continue;
+        }
+        const auto& code_hash{obj.current->code_hash};
+        if (code_hash != kEmptyHash &&
+            (!obj.initial.has_value() || obj.initial->incarnation != obj.current->incarnation)) {
+            if (auto it_code{new_code_.find(code_hash)}; it_code != new_code_.end()) {
+                ByteView code_view{it_code->second.data(), it_code->second.size()};
+                db_.update_account_code(address, obj.current->incarnation, code_hash, code_view);
+            }
+        }
+    }
+}
+
 IntraBlockState::Snapshot IntraBlockState::take_snapshot() const noexcept {
     IntraBlockState::Snapshot snapshot;
     snapshot.journal_size_ = journal_.size();
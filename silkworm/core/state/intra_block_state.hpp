@@ -98,6 +98,10 @@ class IntraBlockState {
 
     void write_to_db(uint64_t block_number);
 
+    // Writes only the accounts and storage changed since the last clear_journal_and_substate, i.e. by the current
+    // transaction once finalized, instead of the whole block so far
+    void write_journal_to_db(uint64_t block_number);
+
     Snapshot take_snapshot() const noexcept;
     void revert_to_snapshot(const Snapshot& snapshot) noexcept;
 
@@ -99,4 +99,43 @@ TEST_CASE("Code view stability") {
     }
 }
 
+TEST_CASE("Write journal to db") {
+    static constexpr evmc::address kAlice{0x00000000000000000000000000000000000000a1_address};
+    static constexpr evmc::address kBob{0x00000000000000000000000000000000000000b0_address};
+    static constexpr evmc::bytes32 kLocation{0x01_bytes32};
+
+    InMemoryState db;
+    IntraBlockState state{db};
+
+    // First transaction
+    state.create_contract(kAlice);
+    state.set_balance(kAlice, 10);
+    state.set_storage(kAlice, kLocation, 0x0a_bytes32);
+    state.finalize_transaction(EVMC_SHANGHAI);
+    state.write_journal_to_db(1);
+    state.clear_journal_and_substate();
+    REQUIRE(db.read_account(kAlice));
+    CHECK(db.read_account(kAlice)->balance == 10);
+    CHECK(db.read_storage(kAlice, kDefaultIncarnation, kLocation) == 0x0a_bytes32);
+
+    // Tamper with the first changes in db: they must not be written again
+    db.update_account(kAlice, std::nullopt, Account{.balance = 7, .incarnation = kDefaultIncarnation});
+    db.update_storage(kAlice, kDefaultIncarnation, kLocation, {}, 0x07_bytes32);
+
+    // Second transaction
+    state.set_balance(kBob, 20);
+    state.finalize_transaction(EVMC_SHANGHAI);
+    state.write_journal_to_db(1);
+    state.clear_journal_and_substate();
+    REQUIRE(db.read_account(kBob));
+    CHECK(db.read_account(kBob)->balance == 20);
+    CHECK(db.read_account(kAlice)->balance == 7);
+    CHECK(db.read_storage(kAlice, kDefaultIncarnation, kLocation) == 0x07_bytes32);
+
+    // The whole block is written instead by write_to_db
+    state.write_to_db(1);
+    CHECK(db.read_account(kAlice)->balance == 10);
+    CHECK(db.read_storage(kAlice, kDefaultIncarnation, kLocation) == 0x0a_bytes32);
+}
+
 }  // namespace silkworm
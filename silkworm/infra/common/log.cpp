@@ -16,11 +16,15 @@
 
 #include "log.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <ostream>
-#include <regex>
 #include <stdexcept>
 #include <thread>
 
@@ -34,12 +38,177 @@ namespace silkworm::log {
 //! The fixed size for thread name in log traces
 constexpr auto kThreadNameFixedSize{11};
 
+//! The max number of log lines waiting for the asynchronous writer, further ones get dropped (must be a power of 2)
+constexpr std::size_t kAsyncQueueCapacity{16 * 1024};
+
+//! The max time the asynchronous writer sleeps before checking for pending log lines
+constexpr std::chrono::milliseconds kAsyncWriterIdleTimeout{50};
+
 static Settings settings_{};
 static std::mutex out_mtx{};
 static std::unique_ptr<std::fstream> file_{nullptr};
 thread_local std::string thread_name_{};
+static std::atomic_uint64_t dropped_lines_{0};
+
+//! Remove the colorization escape sequences (i.e. ESC[<digits or ;>m) from the log line
+static std::string strip_colors(std::string_view line) {
+    std::string stripped;
+    stripped.reserve(line.size());
+    for (std::size_t i{0}; i < line.size(); ++i) {
+        if (line[i] == '\x1b' && i + 1 < line.size() && line[i + 1] == '[') {
+            std::size_t end{i + 2};
+            while (end < line.size() && ((line[end] >= '0' && line[end] <= '9') || line[end] == ';')) ++end;
+            if (end > i + 2 && end < line.size() && line[end] == 'm') {
+                i = end;
+                continue;
+            }
+        }
+        stripped.push_back(line[i]);
+    }
+    return stripped;
+}
+
+//! Write the log line to the console and to the tee file, if any
+//! \warning out_mtx must be held by the caller
+static void write_line(std::string_view line, bool colorized, bool flush) {
+    auto& out = settings_.log_std_out ? std::cout : std::cerr;
+    out << line << '\n';
+    if (flush) out.flush();
+    if (file_ && file_->is_open()) {
+        if (colorized) {
+            *file_ << strip_colors(line) << '\n';
+        } else {
+            *file_ << line << '\n';
+        }
+        if (flush) file_->flush();
+    }
+}
+
+namespace {
+
+    struct LogLine {
+        std::string text;
+        bool colorized{false};
+    };
+
+    //! Bounded lock-free queue of log lines for many producers and one consumer (D. Vyukov's algorithm)
+    class LogLineQueue {
+      public:
+        explicit LogLineQueue(std::size_t capacity) : cells_{std::make_unique<Cell[]>(capacity)}, mask_{capacity - 1} {
+            for (std::size_t i{0}; i < capacity; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        //! Enqueue the line unless the queue is full, callable from any thread
+        bool try_push(LogLine& line) {
+            Cell* cell{nullptr};
+            auto position{enqueue_position_.load(std::memory_order_relaxed)};
+            while (true) {
+                cell = &cells_[position & mask_];
+                const auto sequence{cell->sequence.load(std::memory_order_acquire)};
+                const auto difference{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position)};
+                if (difference == 0) {
+                    if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+                } else if (difference < 0) {
+                    return false;  // full
+                } else {
+                    position = enqueue_position_.load(std::memory_order_relaxed);
+                }
+            }
+            cell->line = std::move(line);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! Dequeue the oldest line if any, callable only from the consumer thread
+        bool try_pop(LogLine& line) {
+            Cell& cell{cells_[dequeue_position_ & mask_]};
+            if (cell.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1) return false;  // empty
+            line = std::move(cell.line);
+            cell.sequence.store(dequeue_position_ + mask_ + 1, std::memory_order_release);
+            ++dequeue_position_;
+            return true;
+        }
+
+      private:
+        struct Cell {
+            std::atomic_size_t sequence{0};
+            LogLine line;
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        const std::size_t mask_;
+        alignas(64) std::atomic_size_t enqueue_position_{0};
+        alignas(64) std::size_t dequeue_position_{0};
+    };
+
+    //! Background thread writing the log lines so that the logging threads never block on console or file output
+    class AsyncLogWriter {
+      public:
+        AsyncLogWriter() : queue_{kAsyncQueueCapacity}, thread_{[this]() { run(); }} {}
+        ~AsyncLogWriter() {
+            stopping_ = true;
+            wakeup_.notify_one();
+            thread_.join();
+        }
+
+        AsyncLogWriter(const AsyncLogWriter&) = delete;
+        AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+        //! Hand the line over to the writer or drop it if the writer is lagging behind, never blocks
+        void push(LogLine line) {
+            if (!queue_.try_push(line)) {
+                ++dropped_;
+                ++dropped_lines_;
+                return;
+            }
+            wakeup_.notify_one();  // a missed notification just delays the writer up to its idle timeout
+        }
+
+      private:
+        void run() {
+            while (true) {
+                const bool stopping{stopping_};  // read before draining so that no line pushed earlier is lost
+                write_pending_lines();
+                if (stopping) break;
+                std::unique_lock lock{wakeup_mutex_};
+                wakeup_.wait_for(lock, kAsyncWriterIdleTimeout);
+            }
+        }
+
+        void write_pending_lines() {
+            LogLine line;
+            std::size_t lines_written{0};
+            std::unique_lock out_lck{out_mtx};
+            while (queue_.try_pop(line)) {
+                write_line(line.text, line.colorized, /*flush=*/false);
+                ++lines_written;
+            }
+            if (const auto dropped{dropped_.exchange(0)}; dropped > 0) {
+                write_line("Log writer lagging behind, dropped " + std::to_string(dropped) + " log lines", false, false);
+                ++lines_written;
+            }
+            if (lines_written > 0) {
+                (settings_.log_std_out ? std::cout : std::cerr).flush();
+                if (file_ && file_->is_open()) file_->flush();
+            }
+        }
+
+        LogLineQueue queue_;
+        std::atomic_uint64_t dropped_{0};
+        std::atomic_bool stopping_{false};
+        std::mutex wakeup_mutex_;
+        std::condition_variable wakeup_;
+        std::thread thread_;
+    };
+
+}  // namespace
+
+static std::unique_ptr<AsyncLogWriter> async_writer_{nullptr};
 
 void init(Settings& settings) {
+    async_writer_.reset();  // drain the lines pending in asynchronous mode, if any
     settings_ = settings;
     if (!settings_.log_file.empty()) {
         tee_file(std::filesystem::path(settings.log_file));
@@ -50,8 +219,13 @@ void init(Settings& settings) {
         gpr_set_log_function(gpr_silkworm_log);
     }
     init_terminal();
+    if (settings_.log_async) {
+        async_writer_ = std::make_unique<AsyncLogWriter>();
+    }
 }
 
+uint64_t dropped_lines() { return dropped_lines_; }
+
 void tee_file(const std::filesystem::path& path) {
     file_ = std::make_unique<std::fstream>(path.string(), std::ios::out | std::ios::app);
     if (!file_->is_open()) {
@@ -113,11 +287,37 @@ void prepare_for_logging(std::ostream& ss) {
     }
 }
 
+//! The locale with the configured thousands separator, built once per thread instead of once per log line
+static const std::locale& thousands_locale() {
+    thread_local char separator{0};
+    thread_local std::locale locale;
+    if (separator != settings_.log_thousands_sep) {
+        separator = settings_.log_thousands_sep;
+        locale = std::locale(std::locale{}, new separate_thousands(separator));
+    }
+    return locale;
+}
+
+//! Append the timestamp with millisecond precision, formatting the date and time just once per second per thread
+static void append_timestamp(std::ostream& out, absl::Time now, const absl::TimeZone& tz) {
+    thread_local int64_t last_second{-1};
+    thread_local std::string last_second_text;
+    const int64_t now_ms{absl::ToUnixMillis(now)};
+    const int64_t second{now_ms / 1000};
+    if (second != last_second) {
+        last_second_text = absl::FormatTime("%m-%d|%H:%M:%S", absl::FromUnixSeconds(second), tz);
+        last_second = second;
+    }
+    const auto ms{static_cast<int>(now_ms % 1000)};
+    const char ms_text[]{'.', static_cast<char>('0' + ms / 100), static_cast<char>('0' + ms / 10 % 10), static_cast<char>('0' + ms % 10)};
+    out << last_second_text << std::string_view{ms_text, sizeof(ms_text)};
+}
+
 BufferBase::BufferBase(Level level) : should_print_(level <= settings_.log_verbosity) {
     if (!should_print_) return;
 
     if (settings_.log_thousands_sep != 0) {
-        ss_.imbue(std::locale(ss_.getloc(), new separate_thousands(settings_.log_thousands_sep)));
+        ss_.imbue(thousands_locale());
     }
 
     auto [log_level, color] = get_level_settings(level);
@@ -131,10 +331,12 @@ BufferBase::BufferBase(Level level) : should_print_(level <= settings_.log_verbo
 
     // TimeStamp
     static const absl::TimeZone tz{settings_.log_utc ? absl::UTCTimeZone() : absl::LocalTimeZone()};
+    static const std::string tz_name{" " + tz.name()};
     absl::Time now{absl::Now()};
 
-    auto log_timezone{settings_.log_timezone ? std::string{" "} + tz.name() : ""};
-    ss_ << kColorWhite << "[" << absl::FormatTime("%m-%d|%H:%M:%E3S", now, tz) << log_timezone << "] " << kColorReset;
+    ss_ << kColorWhite << "[";
+    append_timestamp(ss_, now, tz);
+    ss_ << (settings_.log_timezone ? std::string_view{tz_name} : std::string_view{}) << "] " << kColorReset;
 
     // ThreadId
     if (settings_.log_threads) {
@@ -149,24 +351,18 @@ BufferBase::BufferBase(Level level, std::string_view msg, const Args& args) : Bu
 void BufferBase::flush() {
     if (!should_print_) return;
 
-    // Pattern to identify colorization
-    static const std::regex color_pattern("(\\\x1b\\[[0-9;]{1,}m)");
-
     bool colorized{true};
     std::string line{ss_.str()};
     if (settings_.log_nocolor) {
-        line = std::regex_replace(line, color_pattern, "");
+        line = strip_colors(line);
         colorized = false;
     }
-    std::unique_lock out_lck{out_mtx};
-    auto& out = settings_.log_std_out ? std::cout : std::cerr;
-    out << line << std::endl;
-    if (file_ && file_->is_open()) {
-        if (colorized) {
-            line = std::regex_replace(line, color_pattern, "");
-        }
-        *file_ << line << std::endl;
+    if (async_writer_) {
+        async_writer_->push({std::move(line), colorized});
+        return;
     }
+    std::unique_lock out_lck{out_mtx};
+    write_line(line, colorized, /*flush=*/true);
 }
 
 }  // namespace silkworm::log
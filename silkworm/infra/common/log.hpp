@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <sstream>
 #include <vector>
@@ -47,12 +48,16 @@ struct Settings {
     std::string log_file;               // Log to file
     char log_thousands_sep{'\''};       // Thousands separator
     bool log_grpc{true};                // Include GRPC library internal logs
+    bool log_async{false};              // Whether log lines are written by a background thread (dropped if it lags)
 };
 
 //! \brief Initializes logging facilities
 //! \note This function is not thread safe as it's meant to be used at start of process and never called again
 void init(Settings& settings);
 
+//! \brief Get the number of log lines dropped so far because the asynchronous writer could not keep up
+uint64_t dropped_lines();
+
 //! \brief Get the current logging verbosity
 //! \note This function is not thread safe as it's meant to be used in tests
 Level get_verbosity();
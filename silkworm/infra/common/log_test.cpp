@@ -178,6 +178,23 @@ TEST_CASE("LogBuffer", "[silkworm][common][log]") {
         CHECK(cerr_output2.find(prettified_key_value("key4", "value4")) == std::string::npos);
     }
 
+    SECTION("Settings enable asynchronous output") {
+        Settings log_settings{.log_async = true};
+        init(log_settings);
+        for (int i{0}; i < 10; ++i) {
+            LogBuffer_ForTest<Level::kInfo>{"async" + std::to_string(i), {}};  // temporary log object, flush on dtor
+        }
+
+        // Switching back to synchronous output writes all the pending lines
+        log_settings.log_async = false;
+        init(log_settings);
+        const auto cerr_output{string_cerr.str()};
+        for (int i{0}; i < 10; ++i) {
+            CHECK(cerr_output.find("async" + std::to_string(i)) != std::string::npos);
+        }
+        CHECK(dropped_lines() == 0);
+    }
+
     SECTION("Variable arguments: constructor") {
         auto log_buffer = LogBuffer_ForTest<Level::kInfo>("test", {"key1", "value1", "key2", "value2"});
         CHECK(log_buffer.content().find("test") != std::string::npos);
@@ -17,8 +17,6 @@
 #include "awaitable_condition_variable.hpp"
 
 #include <mutex>
-#include <set>
-#include <tuple>
 
 #include <boost/asio/this_coro.hpp>
 
@@ -38,7 +36,8 @@ class AwaitableConditionVariableImpl {
         return [this, waiter_version]() -> Task<void> {
             auto executor = co_await boost::asio::this_coro::executor;
 
-            decltype(waiters_)::iterator waiter;
+            // the waiter lives in the coroutine frame, so waiting does not allocate anything else
+            Waiter waiter{executor};
             {
                 std::scoped_lock lock(mutex_);
 
@@ -48,29 +47,89 @@ class AwaitableConditionVariableImpl {
                     co_return;
                 }
 
-                std::tie(waiter, std::ignore) = waiters_.insert(std::make_unique<EventNotifier>(executor));
+                link(waiter);
             }
+            WaiterGuard guard{*this, waiter};
 
-            co_await (*waiter)->wait();
-
-            {
-                std::scoped_lock lock(mutex_);
-                waiters_.erase(waiter);
-            }
+            co_await waiter.notifier.wait();
+            guard.resumed = true;
         };
     }
 
     void notify_all() {
         std::scoped_lock lock(mutex_);
         version_++;
-        for (auto& waiter : waiters_) {
-            waiter->notify();
+        while (head_) {
+            notify(*head_);
         }
     }
 
+    void notify_one() {
+        std::scoped_lock lock(mutex_);
+        notify_one_locked();
+    }
+
   private:
+    struct Waiter {
+        explicit Waiter(const boost::asio::any_io_executor& executor) : notifier{executor} {}
+
+        EventNotifier notifier;
+        Waiter* previous{nullptr};
+        Waiter* next{nullptr};
+        bool linked{false};
+    };
+
+    //! Unlink a waiter going away, or hand its notification over to another one if it has not been resumed
+    struct WaiterGuard {
+        WaiterGuard(AwaitableConditionVariableImpl& cond_var, Waiter& waiter) : cond_var{cond_var}, waiter{waiter} {}
+        ~WaiterGuard() {
+            std::scoped_lock lock(cond_var.mutex_);
+            if (waiter.linked) {
+                cond_var.unlink(waiter);
+            } else if (!resumed) {
+                cond_var.notify_one_locked();
+            }
+        }
+
+        WaiterGuard(const WaiterGuard&) = delete;
+        WaiterGuard& operator=(const WaiterGuard&) = delete;
+
+        AwaitableConditionVariableImpl& cond_var;
+        Waiter& waiter;
+        bool resumed{false};
+    };
+
+    void notify_one_locked() {
+        if (head_) {
+            notify(*head_);
+        } else {
+            version_++;
+        }
+    }
+
+    void notify(Waiter& waiter) {
+        unlink(waiter);
+        waiter.notifier.notify();
+    }
+
+    void link(Waiter& waiter) {
+        waiter.previous = tail_;
+        waiter.next = nullptr;
+        (tail_ ? tail_->next : head_) = &waiter;
+        tail_ = &waiter;
+        waiter.linked = true;
+    }
+
+    void unlink(Waiter& waiter) {
+        (waiter.previous ? waiter.previous->next : head_) = waiter.next;
+        (waiter.next ? waiter.next->previous : tail_) = waiter.previous;
+        waiter.previous = waiter.next = nullptr;
+        waiter.linked = false;
+    }
+
     std::mutex mutex_;
-    std::set<std::unique_ptr<EventNotifier>> waiters_;
+    Waiter* head_{nullptr};  // waiters in arrival order
+    Waiter* tail_{nullptr};
     size_t version_{0};
 };
 
@@ -89,4 +148,8 @@ void AwaitableConditionVariable::notify_all() {
     p_impl_->notify_all();
 }
 
+void AwaitableConditionVariable::notify_one() {
+    p_impl_->notify_one();
+}
+
 }  // namespace silkworm::concurrency
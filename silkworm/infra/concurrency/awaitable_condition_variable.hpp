@@ -57,6 +57,8 @@ class AwaitableConditionVariable {
 
     Waiter waiter();
     void notify_all();
+    //! Wake up the longest waiting coroutine, or all the coroutines preparing to wait if none is waiting yet
+    void notify_one();
 
   private:
     std::unique_ptr<AwaitableConditionVariableImpl> p_impl_;
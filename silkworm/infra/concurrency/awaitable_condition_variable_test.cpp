@@ -88,4 +88,38 @@ TEST_CASE("AwaitableConditionVariable.notify_all_awakes_multiple_waiters") {
     runner.poll_context_until_future_is_ready(future3);
 }
 
+TEST_CASE("AwaitableConditionVariable.notify_one_awakes_waiters_one_by_one") {
+    using namespace std::chrono_literals;
+
+    test_util::TaskRunner runner;
+    AwaitableConditionVariable cond_var;
+    auto waiter1 = cond_var.waiter();
+    auto waiter2 = cond_var.waiter();
+
+    // schedule waiting
+    auto future1 = runner.spawn_future(waiter1());
+    auto future2 = runner.spawn_future(waiter2());
+    // run until it blocks
+    while (runner.context().poll_one() > 0) {
+    }
+
+    cond_var.notify_one();
+    runner.poll_context_until_future_is_ready(future1);
+    CHECK(future2.wait_for(0s) == std::future_status::timeout);
+
+    cond_var.notify_one();
+    runner.poll_context_until_future_is_ready(future2);
+}
+
+TEST_CASE("AwaitableConditionVariable.notify_one_not_blocking_when_notified_before_waiting") {
+    test_util::TaskRunner runner;
+    AwaitableConditionVariable cond_var;
+    auto waiter1 = cond_var.waiter();
+    auto waiter2 = cond_var.waiter();
+
+    cond_var.notify_one();
+    runner.run(waiter1());
+    runner.run(waiter2());
+}
+
 }  // namespace silkworm::concurrency
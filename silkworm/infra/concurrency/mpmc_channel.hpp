@@ -0,0 +1,251 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "task.hpp"
+
+#include <boost/asio/experimental/channel_error.hpp>
+#include <boost/system/system_error.hpp>
+
+#include "awaitable_condition_variable.hpp"
+
+namespace silkworm::concurrency {
+
+/**
+
+A bounded multi-producer multi-consumer channel built on a lock-free ring buffer.
+Unlike Channel, sending and receiving never allocate nor lock as long as the buffer is neither full nor empty:
+only the coroutines that actually have to wait go through AwaitableConditionVariable.
+
+Closing is compatible with Channel: both send and receive throw boost::system::system_error with the
+boost::asio::experimental::error::channel_closed code, and waiting coroutines are woken up to do so.
+Values already buffered when closing are still delivered to the receivers until the buffer is drained.
+Closing is linearizable with sending: the closed flag lives in the enqueue position, so a value is either sent
+before closing, and then delivered, or refused.
+Unlike Channel, an unbuffered (i.e. zero capacity) channel is not supported.
+
+ */
+template <typename T>
+class MpmcChannel {
+  public:
+    //! The capacity is rounded up to the next power of 2, at least 2
+    explicit MpmcChannel(std::size_t capacity)
+        : mask_{std::bit_ceil(std::max(capacity, std::size_t{2})) - 1},
+          cells_{std::make_unique<Cell[]>(mask_ + 1)} {
+        for (std::size_t i{0}; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcChannel(const MpmcChannel&) = delete;
+    MpmcChannel& operator=(const MpmcChannel&) = delete;
+
+    [[nodiscard]] std::size_t capacity() const { return mask_ + 1; }
+
+    Task<void> send(T value) {
+        while (!try_send_or_throw(value)) {
+            WaitingGuard guard{waiting_senders_};
+            auto waiter = not_full_.waiter();
+            if (try_send_or_throw(value)) break;
+            co_await waiter();
+        }
+    }
+
+    //! Send the value unless the channel is full or closed
+    bool try_send(T value) {
+        if (try_push(value) != PushResult::kPushed) return false;
+        notify_waiting(not_empty_, waiting_receivers_);
+        return true;
+    }
+
+    Task<T> receive() {
+        std::optional<T> value;
+        while (!(value = try_receive())) {
+            WaitingGuard guard{waiting_receivers_};
+            auto waiter = not_empty_.waiter();
+            if ((value = try_receive())) break;
+            co_await waiter();
+        }
+        co_return std::move(*value);
+    }
+
+    //! Receive one value if available, throw if the channel is closed and drained
+    std::optional<T> try_receive() {
+        std::optional<T> value = try_pop();
+        if (!value) {
+            const auto enqueue_position{enqueue_position_.load(std::memory_order_acquire)};
+            if ((enqueue_position & kClosedBit) == 0) return std::nullopt;
+            // Values sent before closing may still be being written into their cells: wait for them
+            const auto sent_count{enqueue_position & ~kClosedBit};
+            while (!(value = try_pop())) {
+                if (dequeue_position_.load(std::memory_order_acquire) >= sent_count) throw_closed();
+                std::this_thread::yield();
+            }
+        }
+        notify_waiting(not_full_, waiting_senders_);
+        return value;
+    }
+
+    //! Append up to max_count available values to the output, returning how many have been received.
+    //! Throw if the channel is closed and drained.
+    std::size_t try_receive_many(std::vector<T>& values, std::size_t max_count) {
+        std::size_t count{0};
+        while (count < max_count) {
+            auto value = try_pop();
+            if (!value) break;
+            values.push_back(std::move(*value));
+            ++count;
+        }
+        if (count > 0) {
+            notify_waiting(not_full_, waiting_senders_, /*all=*/count > 1);
+        } else if (max_count > 0 && (enqueue_position_.load(std::memory_order_acquire) & kClosedBit) != 0) {
+            values.push_back(*try_receive());  // either a value sent right before closing or throw
+            ++count;
+        }
+        return count;
+    }
+
+    void close() {
+        enqueue_position_.fetch_or(kClosedBit, std::memory_order_acq_rel);
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+  private:
+    struct Cell {
+        std::atomic_size_t sequence{0};
+        std::optional<T> value;
+    };
+
+    //! Keep track of the coroutines about to wait, so that producers and consumers notify only when needed
+    class WaitingGuard {
+      public:
+        explicit WaitingGuard(std::atomic_size_t& waiting) : waiting_{waiting} {
+            waiting_.fetch_add(1, std::memory_order_relaxed);
+            // pairs with the fence in notify_waiting: either the waiter sees the new state or gets notified
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        ~WaitingGuard() { waiting_.fetch_sub(1, std::memory_order_relaxed); }
+
+        WaitingGuard(const WaitingGuard&) = delete;
+        WaitingGuard& operator=(const WaitingGuard&) = delete;
+
+      private:
+        std::atomic_size_t& waiting_;
+    };
+
+    //! One value makes one waiter progress, so waking all of them would just make the others wait again
+    static void notify_waiting(AwaitableConditionVariable& cond_var, const std::atomic_size_t& waiting, bool all = false) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed) > 0) {
+            if (all) {
+                cond_var.notify_all();
+            } else {
+                cond_var.notify_one();
+            }
+        }
+    }
+
+    [[noreturn]] static void throw_closed() {
+        throw boost::system::system_error(boost::asio::experimental::error::channel_closed);
+    }
+
+    bool try_send_or_throw(T& value) {
+        const auto result{try_push(value)};
+        if (result == PushResult::kClosed) throw_closed();
+        if (result == PushResult::kFull) return false;
+        notify_waiting(not_empty_, waiting_receivers_);
+        return true;
+    }
+
+    enum class PushResult {
+        kPushed,
+        kFull,
+        kClosed,
+    };
+
+    //! Enqueue the value unless the buffer is full or the channel closed, leaving the value untouched in such cases
+    PushResult try_push(T& value) {
+        Cell* cell{nullptr};
+        auto position{enqueue_position_.load(std::memory_order_acquire)};
+        while (true) {
+            if ((position & kClosedBit) != 0) return PushResult::kClosed;
+            cell = &cells_[position & mask_];
+            const auto sequence{cell->sequence.load(std::memory_order_acquire)};
+            const auto difference{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position)};
+            if (difference == 0) {
+                // fails if closed meanwhile, since the closed bit is part of the position
+                if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+            } else if (difference < 0) {
+                return PushResult::kFull;
+            } else {
+                position = enqueue_position_.load(std::memory_order_acquire);
+            }
+        }
+        cell->value.emplace(std::move(value));
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return PushResult::kPushed;
+    }
+
+    //! Dequeue the oldest value if any
+    std::optional<T> try_pop() {
+        Cell* cell{nullptr};
+        auto position{dequeue_position_.load(std::memory_order_relaxed)};
+        while (true) {
+            cell = &cells_[position & mask_];
+            const auto sequence{cell->sequence.load(std::memory_order_acquire)};
+            const auto difference{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1)};
+            if (difference == 0) {
+                if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+            } else if (difference < 0) {
+                return std::nullopt;  // empty
+            } else {
+                position = dequeue_position_.load(std::memory_order_relaxed);
+            }
+        }
+        std::optional<T> value{std::move(cell->value)};
+        cell->value.reset();
+        cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+    //! The highest bit of the enqueue position flags the channel as closed
+    static constexpr std::size_t kClosedBit{std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 1)};
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic_size_t enqueue_position_{0};
+    alignas(64) std::atomic_size_t dequeue_position_{0};
+    alignas(64) std::atomic_size_t waiting_senders_{0};
+    std::atomic_size_t waiting_receivers_{0};
+    AwaitableConditionVariable not_full_;
+    AwaitableConditionVariable not_empty_;
+};
+
+}  // namespace silkworm::concurrency
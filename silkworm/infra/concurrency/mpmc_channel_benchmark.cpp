@@ -0,0 +1,148 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <cstdint>
+#include <future>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <silkworm/infra/concurrency/channel.hpp>
+#include <silkworm/infra/concurrency/mpmc_channel.hpp>
+
+namespace silkworm::concurrency {
+
+//! Buffer size of the channels under test
+static constexpr std::size_t kChannelCapacity{1'024};
+
+//! Number of messages sent by each producer
+static constexpr int64_t kMessagesPerProducer{100'000};
+
+//! Number of messages sent one at a time to idle consumers
+static constexpr int64_t kIdleMessages{10'000};
+
+template <typename TChannel>
+static TChannel make_channel(boost::asio::thread_pool& pool);
+
+template <>
+Channel<uint64_t> make_channel(boost::asio::thread_pool& pool) {
+    return Channel<uint64_t>{pool.get_executor(), kChannelCapacity};
+}
+
+template <>
+MpmcChannel<uint64_t> make_channel(boost::asio::thread_pool&) {
+    return MpmcChannel<uint64_t>{kChannelCapacity};
+}
+
+//! Send messages from range(0) producers to range(1) consumers running on a pool of range(0) + range(1) threads
+template <typename TChannel>
+static void channel_send_receive(benchmark::State& state) {
+    const auto num_producers{static_cast<std::size_t>(state.range(0))};
+    const auto num_consumers{static_cast<std::size_t>(state.range(1))};
+
+    for ([[maybe_unused]] auto _ : state) {
+        boost::asio::thread_pool pool{num_producers + num_consumers};
+        TChannel channel{make_channel<TChannel>(pool)};
+
+        auto produce = [&]() -> Task<void> {
+            for (int64_t i{0}; i < kMessagesPerProducer; ++i) {
+                co_await channel.send(static_cast<uint64_t>(i));
+            }
+        };
+        auto consume = [&]() -> Task<uint64_t> {
+            uint64_t sum{0};
+            try {
+                while (true) {
+                    sum += co_await channel.receive();
+                }
+            } catch (const boost::system::system_error&) {
+            }
+            co_return sum;
+        };
+
+        std::vector<std::future<void>> producers;
+        for (std::size_t p{0}; p < num_producers; ++p) {
+            producers.push_back(boost::asio::co_spawn(pool, produce(), boost::asio::use_future));
+        }
+        std::vector<std::future<uint64_t>> consumers;
+        for (std::size_t c{0}; c < num_consumers; ++c) {
+            consumers.push_back(boost::asio::co_spawn(pool, consume(), boost::asio::use_future));
+        }
+        for (auto& producer : producers) {
+            producer.get();
+        }
+        channel.close();
+        uint64_t sum{0};
+        for (auto& consumer : consumers) {
+            sum += consumer.get();
+        }
+        benchmark::DoNotOptimize(sum);
+        pool.join();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * kMessagesPerProducer);
+}
+//! Send messages one at a time from one producer to range(0) consumers mostly waiting on an empty channel
+template <typename TChannel>
+static void channel_idle_consumers(benchmark::State& state) {
+    const auto num_consumers{static_cast<std::size_t>(state.range(0))};
+
+    for ([[maybe_unused]] auto _ : state) {
+        boost::asio::thread_pool pool{2};
+        TChannel channel{make_channel<TChannel>(pool)};
+        TChannel acks{make_channel<TChannel>(pool)};
+
+        // the producer waits for each message to be consumed, so that the consumers are always waiting
+        auto produce = [&]() -> Task<void> {
+            for (int64_t i{0}; i < kIdleMessages; ++i) {
+                co_await channel.send(static_cast<uint64_t>(i));
+                co_await acks.receive();
+            }
+        };
+        auto consume = [&]() -> Task<void> {
+            try {
+                while (true) {
+                    co_await acks.send(co_await channel.receive());
+                }
+            } catch (const boost::system::system_error&) {
+            }
+        };
+
+        std::vector<std::future<void>> consumers;
+        for (std::size_t c{0}; c < num_consumers; ++c) {
+            consumers.push_back(boost::asio::co_spawn(pool, consume(), boost::asio::use_future));
+        }
+        boost::asio::co_spawn(pool, produce(), boost::asio::use_future).get();
+        channel.close();
+        for (auto& consumer : consumers) {
+            consumer.get();
+        }
+        pool.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kIdleMessages);
+}
+
+BENCHMARK(channel_send_receive<Channel<uint64_t>>)->Args({1, 1})->Args({4, 1})->Args({4, 4})->UseRealTime();
+BENCHMARK(channel_send_receive<MpmcChannel<uint64_t>>)->Args({1, 1})->Args({4, 1})->Args({4, 4})->UseRealTime();
+BENCHMARK(channel_idle_consumers<Channel<uint64_t>>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK(channel_idle_consumers<MpmcChannel<uint64_t>>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+
+}  // namespace silkworm::concurrency
@@ -0,0 +1,278 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "mpmc_channel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
+#include <boost/system/system_error.hpp>
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/test_util/task_runner.hpp>
+
+namespace silkworm::concurrency {
+
+using namespace std::chrono_literals;
+
+//! Run until all the spawned tasks block
+static void poll_until_blocked(test_util::TaskRunner& runner) {
+    while (runner.context().poll_one() > 0) {
+    }
+}
+
+static auto channel_closed_matcher() {
+    return Catch::Predicate<const boost::system::system_error&>(
+        [](const auto& ex) { return ex.code() == boost::asio::experimental::error::channel_closed; });
+}
+
+TEST_CASE("MpmcChannel.capacity") {
+    CHECK(MpmcChannel<int>{0}.capacity() == 2);
+    CHECK(MpmcChannel<int>{2}.capacity() == 2);
+    CHECK(MpmcChannel<int>{3}.capacity() == 4);
+    CHECK(MpmcChannel<int>{1000}.capacity() == 1024);
+}
+
+TEST_CASE("MpmcChannel.try_send_and_try_receive") {
+    MpmcChannel<int> channel{4};
+    CHECK(!channel.try_receive());
+    for (int i{0}; i < 4; ++i) {
+        CHECK(channel.try_send(i));
+    }
+    CHECK(!channel.try_send(4));  // full
+    for (int i{0}; i < 4; ++i) {
+        CHECK(channel.try_receive() == i);
+    }
+    CHECK(!channel.try_receive());
+}
+
+TEST_CASE("MpmcChannel.try_receive_many") {
+    MpmcChannel<std::unique_ptr<int>> channel{8};
+    for (int i{0}; i < 5; ++i) {
+        CHECK(channel.try_send(std::make_unique<int>(i)));
+    }
+    std::vector<std::unique_ptr<int>> values;
+    CHECK(channel.try_receive_many(values, 3) == 3);
+    CHECK(channel.try_receive_many(values, 3) == 2);
+    CHECK(channel.try_receive_many(values, 3) == 0);
+    REQUIRE(values.size() == 5);
+    for (int i{0}; i < 5; ++i) {
+        CHECK(*values[static_cast<std::size_t>(i)] == i);
+    }
+}
+
+TEST_CASE("MpmcChannel.wraps_around") {
+    MpmcChannel<int> channel{2};
+    for (int i{0}; i < 10; ++i) {
+        CHECK(channel.try_send(i));
+        CHECK(channel.try_receive() == i);
+    }
+}
+
+TEST_CASE("MpmcChannel.receive_waits_for_send") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> channel{2};
+
+    auto future = runner.spawn_future(channel.receive());
+    poll_until_blocked(runner);
+    CHECK(future.wait_for(0s) == std::future_status::timeout);
+
+    CHECK(channel.try_send(1));
+    runner.poll_context_until_future_is_ready(future);
+    CHECK(future.get() == 1);
+}
+
+TEST_CASE("MpmcChannel.send_waits_for_receive") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> channel{2};
+    runner.run(channel.send(1));
+    runner.run(channel.send(2));
+
+    auto future = runner.spawn_future(channel.send(3));
+    poll_until_blocked(runner);
+    CHECK(future.wait_for(0s) == std::future_status::timeout);
+
+    CHECK(channel.try_receive() == 1);
+    runner.poll_context_until_future_is_ready(future);
+    CHECK(channel.try_receive() == 2);
+    CHECK(channel.try_receive() == 3);
+}
+
+TEST_CASE("MpmcChannel.close_and_send") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> channel{2};
+    channel.close();
+    CHECK_THROWS_MATCHES(runner.run(channel.send(1)), boost::system::system_error, channel_closed_matcher());
+    CHECK(!channel.try_send(1));
+}
+
+TEST_CASE("MpmcChannel.close_and_receive") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> channel{2};
+    channel.close();
+    CHECK_THROWS_MATCHES(runner.run(channel.receive()), boost::system::system_error, channel_closed_matcher());
+    CHECK_THROWS_AS(channel.try_receive(), boost::system::system_error);
+    std::vector<int> values;
+    CHECK_THROWS_AS(channel.try_receive_many(values, 1), boost::system::system_error);
+}
+
+TEST_CASE("MpmcChannel.close_delivers_buffered_values") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> channel{4};
+    CHECK(channel.try_send(1));
+    CHECK(channel.try_send(2));
+    channel.close();
+    CHECK(runner.run(channel.receive()) == 1);
+    CHECK(channel.try_receive() == 2);
+    CHECK_THROWS_AS(channel.try_receive(), boost::system::system_error);
+}
+
+TEST_CASE("MpmcChannel.close_awakes_waiters") {
+    test_util::TaskRunner runner;
+    MpmcChannel<int> empty_channel{2};
+    MpmcChannel<int> full_channel{2};
+    CHECK(full_channel.try_send(1));
+    CHECK(full_channel.try_send(2));
+
+    auto receive_future = runner.spawn_future(empty_channel.receive());
+    auto send_future = runner.spawn_future(full_channel.send(3));
+    poll_until_blocked(runner);
+
+    empty_channel.close();
+    full_channel.close();
+    runner.poll_context_until_future_is_ready(receive_future);
+    runner.poll_context_until_future_is_ready(send_future);
+    CHECK_THROWS_MATCHES(receive_future.get(), boost::system::system_error, channel_closed_matcher());
+    CHECK_THROWS_MATCHES(send_future.get(), boost::system::system_error, channel_closed_matcher());
+}
+
+TEST_CASE("MpmcChannel.multiple_producers_and_consumers") {
+    constexpr int kProducers{4};
+    constexpr int kConsumers{4};
+    constexpr int kValuesPerProducer{10'000};
+
+    boost::asio::thread_pool pool{4};
+    MpmcChannel<int> channel{16};
+
+    auto produce = [&](int producer) -> Task<void> {
+        for (int i{0}; i < kValuesPerProducer; ++i) {
+            co_await channel.send(producer * kValuesPerProducer + i);
+        }
+    };
+    auto consume = [&]() -> Task<std::vector<int>> {
+        std::vector<int> values;
+        try {
+            while (true) {
+                values.push_back(co_await channel.receive());
+            }
+        } catch (const boost::system::system_error&) {
+        }
+        co_return values;
+    };
+
+    std::vector<std::future<void>> producers;
+    for (int p{0}; p < kProducers; ++p) {
+        producers.push_back(boost::asio::co_spawn(pool, produce(p), boost::asio::use_future));
+    }
+    std::vector<std::future<std::vector<int>>> consumers;
+    for (int c{0}; c < kConsumers; ++c) {
+        consumers.push_back(boost::asio::co_spawn(pool, consume(), boost::asio::use_future));
+    }
+    for (auto& producer : producers) {
+        producer.get();
+    }
+    channel.close();
+
+    std::vector<int> received;
+    for (auto& consumer : consumers) {
+        const auto values{consumer.get()};
+        received.insert(received.end(), values.begin(), values.end());
+    }
+    pool.join();
+
+    std::sort(received.begin(), received.end());
+    std::vector<int> expected(kProducers * kValuesPerProducer);
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(received == expected);
+}
+
+TEST_CASE("MpmcChannel.close_while_sending") {
+    constexpr int kRounds{100};
+    constexpr int kProducers{2};
+    constexpr int kConsumers{2};
+
+    // Every value whose sending succeeds must be received, however sending and closing interleave
+    for (int round{0}; round < kRounds; ++round) {
+        boost::asio::thread_pool pool{kProducers + kConsumers};
+        MpmcChannel<int> channel{4};
+        std::atomic_int sent_count{0};
+
+        auto produce = [&]() -> Task<void> {
+            try {
+                while (true) {
+                    co_await channel.send(1);
+                    sent_count.fetch_add(1, std::memory_order_relaxed);
+                }
+            } catch (const boost::system::system_error&) {
+            }
+        };
+        auto consume = [&]() -> Task<int> {
+            int received_count{0};
+            try {
+                while (true) {
+                    received_count += co_await channel.receive();
+                }
+            } catch (const boost::system::system_error&) {
+            }
+            co_return received_count;
+        };
+
+        std::vector<std::future<void>> producers;
+        for (int p{0}; p < kProducers; ++p) {
+            producers.push_back(boost::asio::co_spawn(pool, produce(), boost::asio::use_future));
+        }
+        std::vector<std::future<int>> consumers;
+        for (int c{0}; c < kConsumers; ++c) {
+            consumers.push_back(boost::asio::co_spawn(pool, consume(), boost::asio::use_future));
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds{round * 10});
+        channel.close();
+
+        for (auto& producer : producers) {
+            producer.get();
+        }
+        int received_count{0};
+        for (auto& consumer : consumers) {
+            received_count += consumer.get();
+        }
+        pool.join();
+
+        CHECK(received_count == sent_count.load());
+    }
+}
+
+}  // namespace silkworm::concurrency
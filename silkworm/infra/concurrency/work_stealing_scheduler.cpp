@@ -0,0 +1,178 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::concurrency {
+
+//! The scheduler owning the current thread, if any, and the index of the current thread within its workers
+static thread_local const WorkStealingScheduler* current_scheduler{nullptr};
+static thread_local std::size_t current_worker_index{0};
+
+static constexpr std::size_t kBackgroundIndex{static_cast<std::size_t>(TaskPriority::kBackground)};
+
+WorkStealingScheduler::WorkStealingScheduler(std::size_t num_workers, std::size_t max_background_workers)
+    : max_background_workers_{max_background_workers > 0 ? std::min(max_background_workers, std::max(num_workers, std::size_t{1}))
+                                                         : std::max(num_workers, std::size_t{2}) - 1} {
+    workers_.reserve(std::max(num_workers, std::size_t{1}));
+    for (std::size_t i{0}; i < workers_.capacity(); ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // Start the threads only when all the workers exist, because each one may steal from any other
+    for (std::size_t i{0}; i < workers_.size(); ++i) {
+        workers_[i]->thread = std::thread{[this, i]() { run(i); }};
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::scoped_lock lock{idle_mutex_};
+        stopping_ = true;
+    }
+    idle_cond_var_.notify_all();
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+}
+
+void WorkStealingScheduler::wait_for_tasks() {
+    std::unique_lock lock{idle_mutex_};
+    done_cond_var_.wait(lock, [&]() { return pending_tasks_.load(std::memory_order_acquire) == 0; });
+}
+
+void WorkStealingScheduler::push(TaskPriority priority, Task task) {
+    pending_tasks_.fetch_add(1, std::memory_order_acq_rel);
+
+    const auto priority_index{static_cast<std::size_t>(priority)};
+    const std::size_t worker_index{current_scheduler == this
+                                       ? current_worker_index
+                                       : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size()};
+    Worker& worker{*workers_[worker_index]};
+    {
+        std::scoped_lock lock{worker.mutex};
+        // Counted under the queue lock, so that the counter never falls behind the queued tasks
+        queued_tasks_[priority_index].fetch_add(1, std::memory_order_release);
+        worker.queues[priority_index].push_back(std::move(task));
+    }
+
+    { std::scoped_lock lock{idle_mutex_}; }
+    idle_cond_var_.notify_one();
+}
+
+void WorkStealingScheduler::run(std::size_t worker_index) {
+    current_scheduler = this;
+    current_worker_index = worker_index;
+    log::set_thread_name(("sched-" + std::to_string(worker_index)).c_str());
+
+    Task task;
+    TaskPriority priority{TaskPriority::kBackground};
+    while (true) {
+        if (try_pop(worker_index, task, priority)) {
+            task();
+            task = nullptr;
+            on_task_completed(priority);
+            continue;
+        }
+
+        // When stopping, wait anyway for the queued background tasks that cannot be run here because of the limit
+        std::unique_lock lock{idle_mutex_};
+        idle_cond_var_.wait(lock, [&]() { return has_runnable_tasks() || (stopping_ && !has_queued_tasks()); });
+        if (stopping_ && !has_queued_tasks()) return;
+    }
+}
+
+bool WorkStealingScheduler::try_pop(std::size_t worker_index, Task& task, TaskPriority& priority) {
+    const std::size_t num_workers{workers_.size()};
+    for (std::size_t priority_index{0}; priority_index < kNumTaskPriorities; ++priority_index) {
+        if (queued_tasks_[priority_index].load(std::memory_order_acquire) == 0) continue;
+
+        const bool background{priority_index == kBackgroundIndex};
+        if (background && !try_reserve_background_worker()) continue;
+
+        // Own queue first, then steal from the other workers
+        for (std::size_t offset{0}; offset < num_workers; ++offset) {
+            if (try_pop_from(*workers_[(worker_index + offset) % num_workers], priority_index, task)) {
+                priority = static_cast<TaskPriority>(priority_index);
+                return true;
+            }
+        }
+
+        if (background) running_background_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    return false;
+}
+
+bool WorkStealingScheduler::try_pop_from(Worker& worker, std::size_t priority_index, Task& task) {
+    std::scoped_lock lock{worker.mutex};
+    auto& queue{worker.queues[priority_index]};
+    if (queue.empty()) return false;
+    task = std::move(queue.front());
+    queue.pop_front();
+    queued_tasks_[priority_index].fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+bool WorkStealingScheduler::has_runnable_tasks() const {
+    for (std::size_t priority_index{0}; priority_index < kBackgroundIndex; ++priority_index) {
+        if (queued_tasks_[priority_index].load(std::memory_order_acquire) > 0) return true;
+    }
+    return queued_tasks_[kBackgroundIndex].load(std::memory_order_acquire) > 0 &&
+           running_background_tasks_.load(std::memory_order_acquire) < max_background_workers_;
+}
+
+bool WorkStealingScheduler::has_queued_tasks() const {
+    return std::any_of(queued_tasks_.cbegin(), queued_tasks_.cend(),
+                       [](const auto& count) { return count.load(std::memory_order_acquire) > 0; });
+}
+
+bool WorkStealingScheduler::try_reserve_background_worker() {
+    auto running{running_background_tasks_.load(std::memory_order_acquire)};
+    while (running < max_background_workers_) {
+        if (running_background_tasks_.compare_exchange_weak(running, running + 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingScheduler::on_task_completed(TaskPriority priority) {
+    const bool background{priority == TaskPriority::kBackground};
+    if (background) {
+        running_background_tasks_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+    const bool all_done{pending_tasks_.fetch_sub(1, std::memory_order_acq_rel) == 1};
+    if (!background && !all_done) return;
+
+    { std::scoped_lock lock{idle_mutex_}; }
+    if (background) {
+        idle_cond_var_.notify_all();  // a worker waiting for a background slot can now take it
+    }
+    if (all_done) {
+        done_cond_var_.notify_all();
+    }
+}
+
+WorkStealingScheduler& shared_scheduler() {
+    static WorkStealingScheduler scheduler;
+    return scheduler;
+}
+
+}  // namespace silkworm::concurrency
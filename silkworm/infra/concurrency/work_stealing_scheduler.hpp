@@ -0,0 +1,126 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace silkworm::concurrency {
+
+//! The priority classes of the tasks run by WorkStealingScheduler, from the most to the least urgent
+enum class TaskPriority : uint8_t {
+    kConsensus = 0,   // block validation and execution on the chain tip
+    kRpc = 1,         // serving external requests
+    kBackground = 2,  // bulk work with no latency requirement, e.g. indexing
+};
+
+inline constexpr std::size_t kNumTaskPriorities{3};
+
+/**
+
+A fixed set of worker threads shared by the node subsystems, each one with its own task queue per priority class.
+Workers always pick the most urgent task available: first from their own queue, then stealing the oldest task from
+the queues of the other workers, and only when no more urgent task is queued anywhere they move to the next class.
+Tasks submitted by a worker go into its own queue, tasks submitted by other threads are spread round-robin.
+
+Since a running task is never preempted, background tasks are allowed to occupy at most max_background_workers
+workers at a time, so that the remaining ones are always available for consensus and RPC tasks.
+
+ */
+class WorkStealingScheduler {
+  public:
+    //! \param num_workers the number of worker threads, at least 1
+    //! \param max_background_workers the max number of workers running background tasks at the same time, if zero
+    //! all the workers but one (at least 1)
+    explicit WorkStealingScheduler(std::size_t num_workers = std::thread::hardware_concurrency(),
+                                   std::size_t max_background_workers = 0);
+
+    //! Wait for all the queued tasks to complete, then join the worker threads
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    [[nodiscard]] std::size_t num_workers() const { return workers_.size(); }
+    [[nodiscard]] std::size_t max_background_workers() const { return max_background_workers_; }
+
+    //! The number of unfinished tasks, either queued or running
+    [[nodiscard]] std::size_t pending_tasks() const { return pending_tasks_.load(std::memory_order_acquire); }
+
+    //! Queue the task with the given priority, its result or exception is delivered through the returned future
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(TaskPriority priority, F&& task) {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged_task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+        auto result = packaged_task->get_future();
+        push(priority, [packaged_task = std::move(packaged_task)]() { (*packaged_task)(); });
+        return result;
+    }
+
+    //! Block until all the tasks submitted so far have completed
+    void wait_for_tasks();
+
+  private:
+    using Task = std::function<void()>;
+
+    struct Worker {
+        std::mutex mutex;
+        std::array<std::deque<Task>, kNumTaskPriorities> queues;
+        std::thread thread;
+    };
+
+    void push(TaskPriority priority, Task task);
+    void run(std::size_t worker_index);
+    bool try_pop(std::size_t worker_index, Task& task, TaskPriority& priority);
+    bool try_pop_from(Worker& worker, std::size_t priority_index, Task& task);
+    [[nodiscard]] bool has_runnable_tasks() const;
+    [[nodiscard]] bool has_queued_tasks() const;
+    bool try_reserve_background_worker();
+    void on_task_completed(TaskPriority priority);
+
+    const std::size_t max_background_workers_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::array<std::atomic_size_t, kNumTaskPriorities> queued_tasks_{};
+    std::atomic_size_t pending_tasks_{0};
+    std::atomic_size_t running_background_tasks_{0};
+    std::atomic_size_t next_worker_{0};
+
+    //! Idle workers and wait_for_tasks callers wait here, state changes are notified holding the mutex to avoid
+    //! lost wake-ups
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cond_var_;
+    std::condition_variable done_cond_var_;
+    bool stopping_{false};
+};
+
+//! The scheduler shared by all the node subsystems, created on first use with one worker per hardware thread
+WorkStealingScheduler& shared_scheduler();
+
+}  // namespace silkworm::concurrency
@@ -0,0 +1,93 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/infra/concurrency/thread_pool.hpp>
+#include <silkworm/infra/concurrency/work_stealing_scheduler.hpp>
+
+namespace silkworm::concurrency {
+
+using namespace std::chrono_literals;
+
+//! Number of worker threads of the pools under test
+static constexpr std::size_t kNumWorkers{4};
+
+//! Background load: a flood of long CPU-bound tasks submitted all at once, e.g. snapshot indexing
+static constexpr std::size_t kBackgroundTasks{64};
+static constexpr auto kBackgroundTaskDuration{2ms};
+
+//! Latency-sensitive load: short tasks submitted at regular intervals, e.g. sender recovery at the chain tip
+static constexpr std::size_t kConsensusTasks{16};
+static constexpr auto kConsensusTaskInterval{500us};
+
+static void spin_for(std::chrono::steady_clock::duration duration) {
+    const auto deadline{std::chrono::steady_clock::now() + duration};
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+template <typename F>
+static auto submit(ThreadPool& pool, TaskPriority /*priority*/, F&& task) {
+    return pool.submit(std::forward<F>(task));
+}
+
+template <typename F>
+static auto submit(WorkStealingScheduler& scheduler, TaskPriority priority, F&& task) {
+    return scheduler.submit(priority, std::forward<F>(task));
+}
+
+//! Measure the average time consensus tasks wait before starting while the workers are flooded by background tasks
+template <typename TPool>
+static void mixed_load(benchmark::State& state) {
+    double total_latency_us{0};
+    for ([[maybe_unused]] auto _ : state) {
+        TPool pool{kNumWorkers};
+
+        std::vector<std::future<void>> background_results;
+        for (std::size_t i{0}; i < kBackgroundTasks; ++i) {
+            background_results.push_back(submit(pool, TaskPriority::kBackground, []() { spin_for(kBackgroundTaskDuration); }));
+        }
+
+        std::vector<std::future<std::chrono::steady_clock::duration>> consensus_results;
+        for (std::size_t i{0}; i < kConsensusTasks; ++i) {
+            const auto submit_time{std::chrono::steady_clock::now()};
+            consensus_results.push_back(submit(pool, TaskPriority::kConsensus, [submit_time]() {
+                return std::chrono::steady_clock::now() - submit_time;
+            }));
+            std::this_thread::sleep_for(kConsensusTaskInterval);
+        }
+
+        for (auto& result : consensus_results) {
+            total_latency_us += std::chrono::duration<double, std::micro>(result.get()).count();
+        }
+        for (auto& result : background_results) {
+            result.get();
+        }
+    }
+    state.counters["consensus_latency_us"] = total_latency_us / static_cast<double>(state.iterations() * kConsensusTasks);
+}
+BENCHMARK(mixed_load<ThreadPool>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(mixed_load<WorkStealingScheduler>)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace silkworm::concurrency
@@ -0,0 +1,188 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::concurrency {
+
+using namespace std::chrono_literals;
+
+//! Occupy one worker until released, so that the tasks submitted meanwhile stay queued
+class WorkerBlocker {
+  public:
+    explicit WorkerBlocker(WorkStealingScheduler& scheduler, TaskPriority priority = TaskPriority::kConsensus) {
+        auto started = std::make_shared<std::promise<void>>();
+        auto started_future = started->get_future();
+        result_ = scheduler.submit(priority, [started, release = release_.get_future().share()]() {
+            started->set_value();
+            release.wait();
+        });
+        started_future.wait();
+    }
+    ~WorkerBlocker() { release(); }
+
+    WorkerBlocker(const WorkerBlocker&) = delete;
+    WorkerBlocker& operator=(const WorkerBlocker&) = delete;
+
+    void release() {
+        if (!released_) {
+            release_.set_value();
+            result_.wait();
+            released_ = true;
+        }
+    }
+
+  private:
+    std::promise<void> release_;
+    std::future<void> result_;
+    bool released_{false};
+};
+
+TEST_CASE("WorkStealingScheduler.settings") {
+    CHECK(WorkStealingScheduler{0}.num_workers() == 1);
+    CHECK(WorkStealingScheduler{1}.max_background_workers() == 1);
+    CHECK(WorkStealingScheduler{4}.max_background_workers() == 3);
+    CHECK(WorkStealingScheduler{4, 2}.max_background_workers() == 2);
+    CHECK(WorkStealingScheduler{4, 8}.max_background_workers() == 4);
+}
+
+TEST_CASE("WorkStealingScheduler.submit") {
+    WorkStealingScheduler scheduler{4};
+
+    SECTION("result") {
+        std::vector<std::future<int>> results;
+        for (int i{0}; i < 100; ++i) {
+            results.push_back(scheduler.submit(static_cast<TaskPriority>(i % kNumTaskPriorities), [i]() { return i; }));
+        }
+        for (int i{0}; i < 100; ++i) {
+            CHECK(results[static_cast<std::size_t>(i)].get() == i);
+        }
+    }
+
+    SECTION("exception") {
+        auto result = scheduler.submit(TaskPriority::kRpc, []() -> int { throw std::runtime_error{"error"}; });
+        CHECK_THROWS_AS(result.get(), std::runtime_error);
+        // the worker survives the failed task
+        CHECK(scheduler.submit(TaskPriority::kRpc, []() { return 1; }).get() == 1);
+    }
+}
+
+TEST_CASE("WorkStealingScheduler.most_urgent_task_first") {
+    WorkStealingScheduler scheduler{1};
+    std::mutex order_mutex;
+    std::vector<TaskPriority> order;
+    auto record = [&](TaskPriority priority) {
+        return [&, priority]() {
+            std::scoped_lock lock{order_mutex};
+            order.push_back(priority);
+        };
+    };
+
+    WorkerBlocker blocker{scheduler};
+    scheduler.submit(TaskPriority::kBackground, record(TaskPriority::kBackground));
+    scheduler.submit(TaskPriority::kRpc, record(TaskPriority::kRpc));
+    scheduler.submit(TaskPriority::kBackground, record(TaskPriority::kBackground));
+    scheduler.submit(TaskPriority::kConsensus, record(TaskPriority::kConsensus));
+    scheduler.submit(TaskPriority::kRpc, record(TaskPriority::kRpc));
+    blocker.release();
+    scheduler.wait_for_tasks();
+
+    CHECK(order == std::vector<TaskPriority>{TaskPriority::kConsensus, TaskPriority::kRpc, TaskPriority::kRpc,
+                                             TaskPriority::kBackground, TaskPriority::kBackground});
+}
+
+TEST_CASE("WorkStealingScheduler.idle_worker_steals_tasks") {
+    WorkStealingScheduler scheduler{2};
+
+    // The nested task goes into the queue of the outer task worker, which is blocked waiting for it
+    auto outer = scheduler.submit(TaskPriority::kConsensus, [&]() {
+        const auto outer_thread_id{std::this_thread::get_id()};
+        auto inner = scheduler.submit(TaskPriority::kConsensus, []() { return std::this_thread::get_id(); });
+        return inner.get() != outer_thread_id;
+    });
+    CHECK(outer.get());
+}
+
+TEST_CASE("WorkStealingScheduler.background_workers_limit") {
+    WorkStealingScheduler scheduler{2, /*max_background_workers=*/1};
+
+    std::promise<void> release;
+    std::shared_future<void> released{release.get_future().share()};
+    std::atomic_int running_background{0};
+    std::atomic_int max_running_background{0};
+    std::vector<std::future<void>> results;
+    for (int i{0}; i < 4; ++i) {
+        results.push_back(scheduler.submit(TaskPriority::kBackground, [&, released]() {
+            const int running{++running_background};
+            int max_running{max_running_background.load()};
+            while (running > max_running && !max_running_background.compare_exchange_weak(max_running, running)) {
+            }
+            released.wait();
+            --running_background;
+        }));
+    }
+
+    // A consensus task is served by the worker kept available despite the blocked background tasks
+    auto consensus_result = scheduler.submit(TaskPriority::kConsensus, []() {});
+    CHECK(consensus_result.wait_for(10s) == std::future_status::ready);
+
+    release.set_value();
+    for (auto& result : results) {
+        result.get();
+    }
+    CHECK(max_running_background == 1);
+}
+
+TEST_CASE("WorkStealingScheduler.wait_for_tasks") {
+    WorkStealingScheduler scheduler{2};
+    std::atomic_int completed{0};
+    for (int i{0}; i < 20; ++i) {
+        scheduler.submit(TaskPriority::kBackground, [&]() {
+            std::this_thread::sleep_for(1ms);
+            ++completed;
+        });
+    }
+    scheduler.wait_for_tasks();
+    CHECK(scheduler.pending_tasks() == 0);
+    CHECK(completed == 20);
+}
+
+TEST_CASE("WorkStealingScheduler.destructor_runs_queued_tasks") {
+    std::atomic_int completed{0};
+    {
+        WorkStealingScheduler scheduler{2, /*max_background_workers=*/1};
+        WorkerBlocker blocker{scheduler, TaskPriority::kBackground};
+        for (int i{0}; i < 10; ++i) {
+            scheduler.submit(TaskPriority::kBackground, [&]() { ++completed; });
+            scheduler.submit(TaskPriority::kRpc, [&]() { ++completed; });
+        }
+        blocker.release();
+    }
+    CHECK(completed == 20);
+}
+
+}  // namespace silkworm::concurrency
@@ -16,6 +16,7 @@
 
 #include "backend_kv_server.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>  // DO NOT remove: used for std::condition_variable, CLion suggestion is buggy
 #include <functional>          // DO NOT remove: used for std::function, CLion suggestion is buggy
@@ -650,6 +651,26 @@ TEST_CASE("BackEndKvServer E2E: KV", "[silkworm][node][rpc]") {
         CHECK(responses[2].cursor_id() == 0);
     }
 
+    SECTION("Tx OK: cursor operations counted") {
+        const auto open_stats_before = TxCall::op_stats(remote::Op::OPEN);
+        const auto close_stats_before = TxCall::op_stats(remote::Op::CLOSE);
+        remote::Cursor open;
+        open.set_op(remote::Op::OPEN);
+        open.set_bucket_name(kTestMap.name);
+        remote::Cursor close;
+        close.set_op(remote::Op::CLOSE);
+        close.set_cursor(0);
+        std::vector<remote::Cursor> requests{open, close};
+        std::vector<remote::Pair> responses;
+        const auto status = kv_client.tx(requests, responses);
+        CHECK(status.ok());
+        CHECK(responses.size() == 3);
+        const auto open_stats = TxCall::op_stats(remote::Op::OPEN);
+        CHECK(open_stats.count == open_stats_before.count + 1);
+        CHECK(open_stats.total_duration >= open_stats_before.total_duration);
+        CHECK(TxCall::op_stats(remote::Op::CLOSE).count == close_stats_before.count + 1);
+    }
+
     SECTION("Tx OK: cursor dup_sort opened then closed") {
         remote::Cursor open;
         open.set_op(remote::Op::OPEN_DUP_SORT);
@@ -982,6 +1003,80 @@ TEST_CASE("BackEndKvServer E2E: Tx max opened cursors exceeded", "[silkworm][nod
     CHECK(status.error_message().find("maximum cursors per txn") != std::string::npos);
 }
 
+TEST_CASE("BackEndKvServer E2E: Tx closed cursors beyond idle cap", "[silkworm][node][rpc]") {
+    BackEndKvE2eTest test;
+    test.fill_tables();
+    auto kv_client = *test.kv_client;
+
+    grpc::ClientContext context;
+    const auto tx_stream = kv_client.tx_start(&context);
+    // You must read at least the first unsolicited incoming message (TxID announcement).
+    remote::Pair response;
+    REQUIRE(tx_stream->Read(&response));
+    REQUIRE(response.tx_id() != 0);
+    response.clear_tx_id();
+
+    // Open more cursors than can be kept idle after closing, then close them all
+    constexpr std::size_t kNumCursors{kMaxTxIdleCursors + 2};
+    std::vector<uint32_t> cursor_ids;
+    for (std::size_t i{0}; i < kNumCursors; ++i) {
+        remote::Cursor open;
+        open.set_op(remote::Op::OPEN);
+        open.set_bucket_name(kTestMap.name);
+        REQUIRE(tx_stream->Write(open));
+        response.clear_cursor_id();
+        REQUIRE(tx_stream->Read(&response));
+        REQUIRE(response.cursor_id() != 0);
+        cursor_ids.push_back(response.cursor_id());
+    }
+    for (const auto cursor_id : cursor_ids) {
+        remote::Cursor close;
+        close.set_op(remote::Op::CLOSE);
+        close.set_cursor(cursor_id);
+        REQUIRE(tx_stream->Write(close));
+        response.clear_cursor_id();
+        REQUIRE(tx_stream->Read(&response));
+        REQUIRE(response.cursor_id() == 0);
+    }
+
+    // Reopen the same number of cursors: the idle ones are reused, the others created again, all start unpositioned
+    std::vector<uint32_t> reopened_cursor_ids;
+    for (std::size_t i{0}; i < kNumCursors; ++i) {
+        remote::Cursor open;
+        open.set_op(remote::Op::OPEN);
+        open.set_bucket_name(kTestMap.name);
+        REQUIRE(tx_stream->Write(open));
+        response.clear_cursor_id();
+        REQUIRE(tx_stream->Read(&response));
+        REQUIRE(response.cursor_id() != 0);
+        reopened_cursor_ids.push_back(response.cursor_id());
+    }
+    for (const auto cursor_id : reopened_cursor_ids) {
+        CHECK(std::find(cursor_ids.cbegin(), cursor_ids.cend(), cursor_id) == cursor_ids.cend());
+        remote::Cursor next;
+        next.set_op(remote::Op::NEXT);
+        next.set_cursor(cursor_id);
+        REQUIRE(tx_stream->Write(next));
+        response.clear_k();
+        response.clear_v();
+        REQUIRE(tx_stream->Read(&response));
+        CHECK(response.k() == "AA");
+        CHECK(response.v() == "00");
+    }
+
+    // Closed cursors are unknown even when their handles have been reused
+    remote::Cursor next;
+    next.set_op(remote::Op::NEXT);
+    next.set_cursor(cursor_ids.front());
+    REQUIRE(tx_stream->Write(next));
+    CHECK(!tx_stream->Read(&response));
+    REQUIRE(tx_stream->WritesDone());
+    auto status = tx_stream->Finish();
+    CHECK(!status.ok());
+    CHECK(status.error_code() == grpc::StatusCode::INVALID_ARGUMENT);
+    CHECK(status.error_message().find("unknown cursor") != std::string::npos);
+}
+
 class TxIdleTimeoutGuard {
   public:
     explicit TxIdleTimeoutGuard(uint8_t t) { TxCall::set_max_idle_duration(std::chrono::milliseconds{t}); }
@@ -2365,6 +2460,49 @@ TEST_CASE("BackEndKvServer E2E: bidirectional max TTL duration", "[silkworm][nod
         CHECK(status.ok());
     }
 
+    SECTION("Tx: idle cursor reused after renew sees changes") {
+        grpc::ClientContext context;
+        // Start Tx RPC, open and close one cursor for TestMap table so that it becomes idle
+        const auto tx_reader_writer = kv_client.tx_start(&context);
+        remote::Pair response;
+        CHECK(tx_reader_writer->Read(&response));
+        CHECK(response.tx_id() != 0);
+        remote::Cursor open;
+        open.set_op(remote::Op::OPEN);
+        open.set_bucket_name(kTestMap.name);
+        CHECK(tx_reader_writer->Write(open));
+        response.clear_tx_id();
+        CHECK(tx_reader_writer->Read(&response));
+        const auto closed_cursor_id = response.cursor_id();
+        CHECK(closed_cursor_id != 0);
+        remote::Cursor close;
+        close.set_op(remote::Op::CLOSE);
+        close.set_cursor(closed_cursor_id);
+        CHECK(tx_reader_writer->Write(close));
+        CHECK(tx_reader_writer->Read(&response));
+        CHECK(response.cursor_id() == 0);
+        // Change database content *after* Tx RPC has been opened
+        test.alter_tables();
+        // Let the max TTL timer expire causing server-side tx renewal, including the idle cursors
+        std::this_thread::sleep_for(kCustomMaxTimeToLive);
+        // The cursor opened now reuses the idle one and can see the changes
+        CHECK(tx_reader_writer->Write(open));
+        CHECK(tx_reader_writer->Read(&response));
+        const auto cursor_id = response.cursor_id();
+        CHECK(cursor_id != 0);
+        remote::Cursor last;
+        last.set_op(remote::Op::LAST);
+        last.set_cursor(cursor_id);
+        CHECK(tx_reader_writer->Write(last));
+        response.clear_cursor_id();
+        CHECK(tx_reader_writer->Read(&response));
+        CHECK(response.k() == "CC");
+        CHECK(response.v() == "22");
+        tx_reader_writer->WritesDone();
+        auto status = tx_reader_writer->Finish();
+        CHECK(status.ok());
+    }
+
 #endif  // _WIN32
 }
 #endif  // SILKWORM_SANITIZE
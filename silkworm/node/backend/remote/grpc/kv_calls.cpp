@@ -70,11 +70,23 @@ Task<void> KvVersionCall::operator()(const EthereumBackEnd& /*backend*/) {
 }
 
 std::chrono::milliseconds TxCall::max_ttl_duration_{kMaxTxDuration};
+std::array<TxCall::OpCounters, remote::Op_ARRAYSIZE> TxCall::op_counters_;
 
 void TxCall::set_max_ttl_duration(const std::chrono::milliseconds& max_ttl_duration) {
     TxCall::max_ttl_duration_ = max_ttl_duration;
 }
 
+TxCall::OpStats TxCall::op_stats(remote::Op op) {
+    if (!remote::Op_IsValid(op)) {
+        return {};
+    }
+    const auto& op_counters = op_counters_[static_cast<std::size_t>(op)];
+    return {
+        op_counters.count.load(std::memory_order_relaxed),
+        std::chrono::nanoseconds{op_counters.total_nanoseconds.load(std::memory_order_relaxed)},
+    };
+}
+
 Task<void> TxCall::operator()(const EthereumBackEnd& backend) {
     auto chaindata_env = backend.chaindata_env();
     SILK_TRACE << "TxCall peer: " << peer() << " MDBX readers: " << chaindata_env->get_info().mi_numreaders;
@@ -180,6 +192,7 @@ Task<void> TxCall::operator()(const EthereumBackEnd& backend) {
 
 void TxCall::handle(const remote::Cursor* request, remote::Pair& response) {
     SILK_TRACE << "TxCall::handle " << this << " request: " << request << " START";
+    const auto start_time = std::chrono::steady_clock::now();
 
     // Handle separately main use cases: cursor OPEN, cursor CLOSE and any other cursor operation.
     const auto cursor_op = request->op();
@@ -191,14 +204,25 @@ void TxCall::handle(const remote::Cursor* request, remote::Pair& response) {
         handle_cursor_operation(request, response);
     }
 
-    SILK_TRACE << "TxCall::handle " << this << " request: " << request << " END";
+    const auto elapsed = std::chrono::steady_clock::now() - start_time;
+    if (remote::Op_IsValid(cursor_op)) {
+        auto& op_counters = op_counters_[static_cast<std::size_t>(cursor_op)];
+        op_counters.count.fetch_add(1, std::memory_order_relaxed);
+        op_counters.total_nanoseconds.fetch_add(std::chrono::nanoseconds{elapsed}.count(), std::memory_order_relaxed);
+    }
+
+    SILK_TRACE << "TxCall::handle " << this << " request: " << request << " END elapsed: "
+               << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us";
 }
 
 void TxCall::handle_cursor_open(const remote::Cursor* request, remote::Pair& response) {
     const std::string& bucket_name = request->bucket_name();
 
+    // Reuse any cursor previously closed on the same bucket: it avoids looking up the map by name and allocating
+    auto cursor = reuse_idle_cursor(bucket_name);
+
     // Bucket name must be a valid MDBX map name
-    if (!db::has_map(read_only_txn_, bucket_name.c_str())) {
+    if (!cursor && !db::has_map(read_only_txn_, bucket_name.c_str())) {
         const auto err = "unknown bucket: " + request->bucket_name();
         SILK_ERROR << "Tx peer: " << peer() << " op=" << remote::Op_Name(request->op()) << " " << err;
         throw_with_error(grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, err});
@@ -211,13 +235,15 @@ void TxCall::handle_cursor_open(const remote::Cursor* request, remote::Pair& res
         throw_with_error(grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED, err});
     }
 
-    // Create a new database cursor tracking also bucket name (needed for reopening). We create a read-only dup-sort
-    // cursor so that it works for both single-value and multi-value tables.
-    const db::MapConfig map_config{
-        .name = bucket_name.c_str(),
-        .value_mode = request->op() == remote::Op::OPEN ? ::mdbx::value_mode::single : ::mdbx::value_mode::multi,
-    };
-    auto cursor = read_only_txn_.ro_cursor_dup_sort(map_config);
+    // Create a new database cursor tracking also bucket name (needed for reopening). We create a dup-sort cursor so
+    // that it works for both single-value and multi-value tables.
+    if (!cursor) {
+        const db::MapConfig map_config{
+            .name = bucket_name.c_str(),
+            .value_mode = request->op() == remote::Op::OPEN ? ::mdbx::value_mode::single : ::mdbx::value_mode::multi,
+        };
+        cursor = std::make_unique<db::PooledCursor>(read_only_txn_, map_config);
+    }
     const auto [cursor_it, inserted] = cursors_.insert({++last_cursor_id_, TxCursor{std::move(cursor), bucket_name}});
 
     SILKWORM_ASSERT(cursor_it->first == last_cursor_id_);
@@ -257,10 +283,31 @@ void TxCall::handle_cursor_close(const remote::Cursor* request) {
         SILK_ERROR << "Tx peer: " << peer() << " op: " << remote::Op_Name(request->op()) << " " << error_message;
         throw_with_error(grpc::Status{grpc::StatusCode::INVALID_ARGUMENT, error_message});
     }
+    // Keep a bounded number of closed cursors for reuse by subsequent OPEN operations on the same bucket
+    if (idle_cursors_.size() < kMaxTxIdleCursors) {
+        auto& [cursor, bucket_name] = cursor_it->second;
+        idle_cursors_.emplace(std::move(bucket_name), std::move(cursor));
+    }
     cursors_.erase(cursor_it);
     SILK_DEBUG << "Tx peer: " << peer() << " closed cursor: " << request->cursor();
 }
 
+std::unique_ptr<db::PooledCursor> TxCall::reuse_idle_cursor(const std::string& bucket_name) {
+    const auto idle_cursor_it = idle_cursors_.find(bucket_name);
+    if (idle_cursor_it == idle_cursors_.end()) {
+        return nullptr;
+    }
+    auto cursor = std::move(idle_cursor_it->second);
+    idle_cursors_.erase(idle_cursor_it);
+
+    // Binding again to the same map drops the previous position, so the cursor behaves as a newly opened one
+    cursor->bind(read_only_txn_, cursor->map());
+    if (!cursor->is_dangling()) {
+        return nullptr;
+    }
+    return cursor;
+}
+
 void TxCall::handle_operation(const remote::Cursor* request, db::ROCursorDupSort& cursor, remote::Pair& response) {
     SILK_DEBUG << "Tx peer=" << peer() << " op=" << remote::Op_Name(request->op()) << " cursor=" << request->cursor();
 
@@ -322,9 +369,7 @@ void TxCall::handle_operation(const remote::Cursor* request, db::ROCursorDupSort
     SILK_TRACE << "TxCall::handle_operation " << this << " op=" << remote::Op_Name(request->op()) << " END";
 }
 
-void TxCall::handle_max_ttl_timer_expired(const EthereumBackEnd& backend) {
-    auto chaindata_env = backend.chaindata_env();
-
+void TxCall::handle_max_ttl_timer_expired(const EthereumBackEnd& /*backend*/) {
     // Save the whole state of the transaction (i.e. all cursor positions)
     std::vector<CursorPosition> positions;
     const bool save_success = save_cursors(positions);
@@ -333,9 +378,12 @@ void TxCall::handle_max_ttl_timer_expired(const EthereumBackEnd& backend) {
     }
     SILK_DEBUG << "Tx peer: " << peer() << " #cursors: " << cursors_.size() << " saved";
 
-    // Close and reopen to avoid long-lived transactions (resource-consuming for MDBX)
-    read_only_txn_.abort();
-    read_only_txn_ = db::ROTxnManaged{*chaindata_env};
+    // Renew to avoid long-lived transactions (resource-consuming for MDBX): reset and renewal keep the reader slot
+    // and the opened map handles, so we just need to renew the cursors instead of opening them again
+    read_only_txn_.renew();
+    for (auto& [_, idle_cursor] : idle_cursors_) {
+        idle_cursor->renew(read_only_txn_);
+    }
 
     // Restore the whole state of the transaction (i.e. all cursor positions)
     const bool restore_success = restore_cursors(positions);
@@ -372,11 +420,10 @@ bool TxCall::restore_cursors(std::vector<CursorPosition>& positions) {
 
     for (auto& [cursor_id, tx_cursor] : cursors_) {
         const std::string& bucket_name = tx_cursor.bucket_name;
-        const db::MapConfig map_config{bucket_name.c_str()};
 
-        // Bind each cursor to the renewed transaction.
+        // Renew each cursor on the renewed transaction.
         auto& cursor = tx_cursor.cursor;
-        cursor->bind(read_only_txn_, map_config);
+        cursor->renew(read_only_txn_);
 
         const auto& [current_key, current_value] = *position_iterator;
         ++position_iterator;
@@ -386,12 +433,12 @@ bool TxCall::restore_cursors(std::vector<CursorPosition>& positions) {
         }
 
         SILK_DEBUG << "Tx restore cursor " << cursor_id << " current_key: " << *current_key << " current_value: " << *current_value;
-        mdbx::slice key{current_key->c_str()};
+        mdbx::slice key{current_key->data(), current_key->size()};
 
         // Restore each cursor saved position.
         if (cursor->is_multi_value()) {
             /* multi-value table */
-            mdbx::slice value{current_value->c_str()};
+            mdbx::slice value{current_value->data(), current_value->size()};
             const auto lbm_result = cursor->lower_bound_multivalue(key, value, /*throw_notfound=*/false);
             SILK_DEBUG << "Tx restore cursor " << cursor_id << " for: " << bucket_name << " lbm_result: " << db::detail::dump_mdbx_result(lbm_result);
             // It may happen that key where we stopped disappeared after transaction reopen, then just move to next key
@@ -661,13 +708,13 @@ Task<void> StateChangesCall::operator()(const EthereumBackEnd& backend) {
     auto coroutine_executor = co_await boost::asio::this_coro::executor;
     auto notifying_timer = steady_timer{coroutine_executor};
 
-    std::optional<remote::StateChangeBatch> incoming_batch;
+    std::shared_ptr<const remote::StateChangeBatch> incoming_batch;
 
     // Register subscription to receive state change batch notifications
-    StateChangeConsumer state_change_consumer = [&](std::optional<remote::StateChangeBatch> batch) {
-        // Make the batch handling logic execute on the scheduler associated to the RPC
-        boost::asio::dispatch(coroutine_executor, [&, batch = std::move(batch)]() {
-            incoming_batch = batch;
+    StateChangeConsumer state_change_consumer = [&](std::shared_ptr<const remote::StateChangeBatch> batch) {
+        // Make the batch handling logic execute on the scheduler associated to the RPC, the batch is shared not copied
+        boost::asio::dispatch(coroutine_executor, [&, batch = std::move(batch)]() mutable {
+            incoming_batch = std::move(batch);
             notifying_timer.cancel();
         });
     };
@@ -16,10 +16,15 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <exception>
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -57,6 +62,9 @@ constexpr std::chrono::milliseconds kMaxTxDuration{60'000};
 //! The max number of opened cursors for each remote transaction (arbitrary limit on this KV implementation).
 constexpr std::size_t kMaxTxCursors{100};
 
+//! The max number of closed cursors kept for reuse by each remote transaction.
+constexpr std::size_t kMaxTxIdleCursors{16};
+
 //! Unary RPC for Version method of 'ethbackend' gRPC protocol.
 class KvVersionCall : public server::UnaryCall<google::protobuf::Empty, types::VersionReply> {
   public:
@@ -77,14 +85,27 @@ class TxCall : public server::BidiStreamingCall<remote::Cursor, remote::Pair> {
 
     static void set_max_ttl_duration(const std::chrono::milliseconds& max_ttl_duration);
 
+    struct OpStats {
+        uint64_t count{0};
+        std::chrono::nanoseconds total_duration{0};
+    };
+
+    //! The number of requests of the given operation handled by all the calls so far and the total time spent on them
+    static OpStats op_stats(remote::Op op);
+
     Task<void> operator()(const EthereumBackEnd& backend);
 
   private:
     struct TxCursor {
-        std::unique_ptr<db::ROCursorDupSort> cursor;
+        std::unique_ptr<db::PooledCursor> cursor;
         std::string bucket_name;
     };
 
+    struct OpCounters {
+        std::atomic_uint64_t count{0};
+        std::atomic_int64_t total_nanoseconds{0};
+    };
+
     struct CursorPosition {
         std::optional<std::string> current_key;
         std::optional<std::string> current_value;
@@ -98,6 +119,8 @@ class TxCall : public server::BidiStreamingCall<remote::Cursor, remote::Pair> {
 
     void handle_cursor_close(const remote::Cursor* request);
 
+    std::unique_ptr<db::PooledCursor> reuse_idle_cursor(const std::string& bucket_name);
+
     void handle_operation(const remote::Cursor* request, db::ROCursorDupSort& cursor, remote::Pair& response);
 
     void handle_max_ttl_timer_expired(const EthereumBackEnd& backend);
@@ -143,9 +166,11 @@ class TxCall : public server::BidiStreamingCall<remote::Cursor, remote::Pair> {
     void throw_with_error(grpc::Status&& status);
 
     static std::chrono::milliseconds max_ttl_duration_;
+    static std::array<OpCounters, remote::Op_ARRAYSIZE> op_counters_;
 
     db::ROTxnManaged read_only_txn_;
     std::map<uint32_t, TxCursor> cursors_;
+    std::multimap<std::string, std::unique_ptr<db::PooledCursor>> idle_cursors_;
     uint32_t last_cursor_id_{0};
 };
 
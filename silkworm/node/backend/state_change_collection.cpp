@@ -52,9 +52,10 @@ void StateChangeCollection::start_new_batch(BlockNum block_height, const evmc::b
     SILK_TRACE << "StateChangeCollection::start_new_batch " << this << " block: " << block_height
                << " unwind:" << unwind << " START";
 
-    SILKWORM_ASSERT(latest_change_ == nullptr);
-
+    // Each block gets its own state change within the current batch, so change indexes are per block
     latest_change_ = state_changes_.add_change_batch();
+    account_change_index_.clear();
+    storage_change_index_.clear();
     latest_change_->set_block_height(block_height);
     latest_change_->set_allocated_block_hash(rpc::H256_from_bytes32(block_hash).release());
     latest_change_->set_direction(unwind ? remote::Direction::UNWIND : remote::Direction::FORWARD);
@@ -204,11 +205,12 @@ void StateChangeCollection::notify_batch(uint64_t pending_base_fee, uint64_t gas
     state_changes_.set_block_gas_limit(gas_limit);
     state_changes_.set_state_version_id(tx_id_);
 
+    // Freeze the batch just once, all consumers share it and can keep it alive as long as they need it
+    const auto frozen_batch{std::make_shared<const remote::StateChangeBatch>(std::move(state_changes_))};
+
     std::unique_lock consumers_lock{consumers_mutex_};
     for (const auto& [_, batch_callback] : consumers_) {
-        // Make a copy of state change batch for every consumer because lifecycle is independent
-        const std::optional<remote::StateChangeBatch> frozen_batch = state_changes_;
-        SILK_DEBUG << "Notify callback=" << &batch_callback << " batch=" << &frozen_batch;
+        SILK_DEBUG << "Notify callback=" << &batch_callback << " batch=" << frozen_batch.get();
         batch_callback(frozen_batch);
         SILK_DEBUG << "Notify callback=" << &batch_callback << " done";
     }
@@ -221,7 +223,7 @@ void StateChangeCollection::close() {
     std::unique_lock consumers_lock{consumers_mutex_};
     for (const auto& [_, batch_callback] : consumers_) {
         SILK_DEBUG << "Notify close to callback=" << &batch_callback;
-        batch_callback(std::nullopt);
+        batch_callback(nullptr);
         SILK_DEBUG << "Notify close to callback=" << &batch_callback << " done";
     }
     reset(0);
@@ -30,7 +30,9 @@
 
 namespace silkworm {
 
-using StateChangeConsumer = std::function<void(std::optional<remote::StateChangeBatch>)>;
+//! The consumer of state change batches: the batch is shared by all consumers and must not be modified, a null
+//! batch signals that the collection has been closed
+using StateChangeConsumer = std::function<void(std::shared_ptr<const remote::StateChangeBatch>)>;
 
 struct StateChangeFilter {
     bool with_storage{false};
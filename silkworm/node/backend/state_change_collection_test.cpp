@@ -102,7 +102,7 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
 
     SECTION("OK: notifies batch w/o changes to single consumer") {
         uint32_t notification_count{0};
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->state_version_id() == 0);
@@ -116,7 +116,7 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
 
     SECTION("OK: notifies batch w/o changes to multiple consumers") {
         uint32_t notification_count1{0}, notification_count2{0};
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->state_version_id() == 0);
@@ -124,7 +124,7 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
             ++notification_count1;
         },
                       StateChangeFilter{});
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->state_version_id() == 0);
@@ -135,6 +135,30 @@ TEST_CASE("StateChangeCollection::notify_batch", "[silkworm][rpc][state_change_c
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
         CHECK((notification_count1 == 1 && notification_count2 == 1));
     }
+
+    SECTION("OK: shares the same batch among multiple consumers") {
+        std::shared_ptr<const remote::StateChangeBatch> batch1, batch2;
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) { batch1 = std::move(batch); },
+                      StateChangeFilter{});
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) { batch2 = std::move(batch); },
+                      StateChangeFilter{});
+        scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+        REQUIRE(batch1);
+        CHECK(batch1 == batch2);
+        CHECK(batch1->block_gas_limit() == kTestGasLimit);
+    }
+}
+
+TEST_CASE("StateChangeCollection::close", "[silkworm][rpc][state_change_collection]") {
+    StateChangeCollection scc;
+    uint32_t notification_count{0};
+    scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
+        CHECK(batch == nullptr);
+        ++notification_count;
+    },
+                  StateChangeFilter{});
+    scc.close();
+    CHECK(notification_count == 1);
 }
 
 TEST_CASE("StateChangeCollection::reset", "[silkworm][rpc][state_change_collection]") {
@@ -142,14 +166,14 @@ TEST_CASE("StateChangeCollection::reset", "[silkworm][rpc][state_change_collecti
 
     SECTION("OK: notifies batch w/o changes with expected transaction ID") {
         REQUIRE(scc.tx_id() == 0);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->state_version_id() == scc.tx_id());
         },
                       StateChangeFilter{});
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
         scc.reset(kTestDatabaseViewId);
         CHECK(scc.tx_id() == kTestDatabaseViewId);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->state_version_id() == scc.tx_id());
         },
                       StateChangeFilter{});
@@ -162,7 +186,7 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
 
     SECTION("OK: one new batch in FORWARD direction") {
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, std::vector<silkworm::Bytes>{}, /*unwind=*/false);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->state_version_id() == 0);
@@ -178,7 +202,7 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
 
     SECTION("OK: two new batches in FORWARD and UNWIND directions") {
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/false);
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -204,13 +228,37 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/true);
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
     }
+
+    SECTION("OK: one batch w/ changes in UNWIND and FORWARD directions for the same account") {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
+            CHECK(batch->state_version_id() == kTestDatabaseViewId);
+            CHECK(batch->change_batch_size() == 2);
+            const remote::StateChange& state_change0 = batch->change_batch(0);
+            CHECK(state_change0.direction() == remote::Direction::UNWIND);
+            CHECK(state_change0.block_height() == kTestBlockNumber);
+            CHECK(state_change0.changes_size() == 1);
+            CHECK(state_change0.changes(0).data() == to_hex(kTestData1));
+            const remote::StateChange& state_change1 = batch->change_batch(1);
+            CHECK(state_change1.direction() == remote::Direction::FORWARD);
+            CHECK(state_change1.block_height() == kTestBlockNumber);
+            CHECK(state_change1.changes_size() == 1);
+            CHECK(state_change1.changes(0).data() == to_hex(kTestData2));
+        },
+                      StateChangeFilter{});
+        scc.reset(kTestDatabaseViewId);
+        scc.start_new_batch(kTestBlockNumber, kTestBlockHash, std::vector<silkworm::Bytes>{}, /*unwind=*/true);
+        scc.change_account(kTestAddress, kTestIncarnation, kTestData1);
+        scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/false);
+        scc.change_account(kTestAddress, kTestIncarnation, kTestData2);
+        scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+    }
 }
 
 TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change_collection]") {
     StateChangeCollection scc;
 
     SECTION("OK: change one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -236,7 +284,7 @@ TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -270,7 +318,7 @@ TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change account after changing code") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -301,7 +349,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     StateChangeCollection scc;
 
     SECTION("OK: change code of one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -327,7 +375,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code of one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -361,7 +409,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing storage in new incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -398,7 +446,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing storage in same incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -428,7 +476,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing account in new incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -463,7 +511,7 @@ TEST_CASE("StateChangeCollection::change_code", "[silkworm][rpc][state_change_co
     }
 
     SECTION("OK: change code after changing account in same incarnation") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -495,7 +543,7 @@ TEST_CASE("StateChangeCollection::change_storage", "[silkworm][rpc][state_change
     StateChangeCollection scc;
 
     SECTION("OK: change storage of one account once") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -524,7 +572,7 @@ TEST_CASE("StateChangeCollection::change_storage", "[silkworm][rpc][state_change
     }
 
     SECTION("OK: change storage of one account twice") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->change_batch_size() == 1);
@@ -568,7 +616,7 @@ TEST_CASE("StateChangeCollection::delete_account", "[silkworm][rpc][state_change
     StateChangeCollection scc;
 
     SECTION("OK: delete one account once in forward direction") {
-        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+        scc.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
             CHECK(batch->pending_block_base_fee() == kTestPendingBaseFee);
             CHECK(batch->block_gas_limit() == kTestGasLimit);
             CHECK(batch->state_version_id() == 0);
@@ -185,6 +185,14 @@ evmc::bytes32 write_header_ex(RWTxn& txn, const BlockHeader& header, bool with_h
     return header_hash;
 }
 
+void delete_header(RWTxn& txn, BlockNum number, const evmc::bytes32& hash) {
+    auto key{db::block_key(number, hash.bytes)};
+    auto headers_cursor = txn.rw_cursor(table::kHeaders);
+    (void)headers_cursor->erase(to_slice(key));
+    auto header_numbers_cursor = txn.rw_cursor(table::kHeaderNumbers);
+    (void)header_numbers_cursor->erase(to_slice(hash));
+}
+
 std::optional<ByteView> read_rlp_encoded_header(ROTxn& txn, BlockNum bn, const evmc::bytes32& hash) {
     auto header_cursor = txn.ro_cursor(db::table::kHeaders);
     auto key = db::block_key(bn, hash.bytes);
@@ -530,6 +538,22 @@ void write_raw_body(RWTxn& txn, const BlockBody& body, const evmc::bytes32& hash
     write_transactions(txn, body.transactions, body_for_storage.base_txn_id);
 }
 
+void delete_body(RWTxn& txn, const evmc::bytes32& hash, BlockNum bn) {
+    auto key{db::block_key(bn, hash.bytes)};
+    auto bodies_cursor = txn.rw_cursor(table::kBlockBodies);
+    const auto data{bodies_cursor->find(to_slice(key), /*throw_notfound=*/false)};
+    if (!data) return;
+
+    ByteView data_view{from_slice(data.value)};
+    const auto body{detail::decode_stored_block_body(data_view)};
+    auto transactions_cursor = txn.rw_cursor(table::kBlockTransactions);
+    for (uint64_t txn_id{body.base_txn_id}; txn_id < body.base_txn_id + body.txn_count; ++txn_id) {
+        const auto txn_key{db::block_key(txn_id)};
+        (void)transactions_cursor->erase(to_slice(txn_key));
+    }
+    (void)bodies_cursor->erase();
+}
+
 static ByteView read_senders_raw(ROTxn& txn, const Bytes& key) {
     auto cursor = txn.ro_cursor(table::kSenders);
     auto data{cursor->find(to_slice(key), /*throw_notfound = */ false)};
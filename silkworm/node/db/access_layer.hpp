@@ -88,6 +88,9 @@ void write_header(RWTxn& txn, const BlockHeader& header, bool with_header_number
 //! \brief Writes given header to table::kHeaders and returns its hash
 evmc::bytes32 write_header_ex(RWTxn& txn, const BlockHeader& header, bool with_header_numbers);
 
+//! \brief Deletes the header from table::kHeaders and its hash from table::kHeaderNumbers
+void delete_header(RWTxn& txn, BlockNum number, const evmc::bytes32& hash);
+
 //! \brief Read block number from hash
 std::optional<BlockNum> read_block_number(ROTxn& txn, const evmc::bytes32& hash);
 
@@ -126,6 +129,10 @@ void write_body(RWTxn& txn, const BlockBody& body, const evmc::bytes32& hash, Bl
 void write_body(RWTxn& txn, const BlockBody& body, const uint8_t (&hash)[kHashLength], BlockNum number);
 void write_raw_body(RWTxn& txn, const BlockBody& body, const evmc::bytes32& hash, BlockNum bn);
 
+//! \brief Deletes block body from table::kBlockBodies along with its range of ids in table::kBlockTransactions
+//! \remarks The transaction sequence is left untouched: ids of deleted transactions are never reused
+void delete_body(RWTxn& txn, const evmc::bytes32& hash, BlockNum bn);
+
 // See Erigon ReadTd
 std::optional<intx::uint256> read_total_difficulty(ROTxn& txn, BlockNum, const evmc::bytes32& hash);
 std::optional<intx::uint256> read_total_difficulty(ROTxn& txn, BlockNum, const uint8_t (&hash)[kHashLength]);
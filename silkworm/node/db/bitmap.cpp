@@ -16,7 +16,13 @@
 
 #include "bitmap.hpp"
 
+#include <algorithm>
+#include <future>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/infra/common/binary_search.hpp>
@@ -44,23 +50,120 @@ RoaringMap parse_impl(const ByteView data) {
     return RoaringMap::readSafe(byte_ptr_cast(&data[0]), data.size());
 }
 
-template <typename RoaringMap>
-void remove_range_impl(RoaringMap& bm, uint64_t min, uint64_t max);
+//! Incremental estimate of the serialized size of a run-optimized bitmap built by adding values in increasing order.
+//! Each container takes the type having the smallest size: when sizes tie the type depends on how the container was
+//! built, so the estimate takes the largest one and never falls below the actual size
+class SerializedSizeEstimator {
+  public:
+    explicit SerializedSizeEstimator(bool is_64bit) : is_64bit_{is_64bit} {}
+
+    //! The serialized size of the bitmap if value were added
+    [[nodiscard]] size_t size_with(uint64_t value) const { return size_of(with_value(state_, value)); }
+
+    void add(uint64_t value) { state_ = with_value(state_, value); }
+
+  private:
+    struct State {
+        bool empty{true};
+        uint64_t last_value{0};
+        size_t closed_buckets_size{0};     // Serialized size of the 32-bit buckets before the current one (64-bit only)
+        size_t closed_containers{0};       // Number of containers before the current one in the current bucket
+        size_t closed_containers_size{0};  // Serialized size of the containers before the current one in the current bucket
+        size_t cardinality{0};             // Cardinality of the current container
+        size_t runs{0};                    // Number of runs of consecutive values in the current container
+    };
+
+    static constexpr size_t kMaxArrayContainerCardinality{4096};
+    static constexpr size_t kBitsetContainerSize{8192};
+
+    static size_t header_size(size_t containers) {
+        const size_t header_without_runs{8 + 8 * containers};
+        const size_t header_with_runs{4 + (containers + 7) / 8 + 8 * containers};
+        return std::max(header_without_runs, header_with_runs);
+    }
 
-template <>
-[[maybe_unused]] void remove_range_impl<roaring::Roaring>(roaring::Roaring& bm, uint64_t min, uint64_t max) {
-    roaring::api::roaring_bitmap_remove_range(&bm.roaring, min, max);
-}
+    static size_t container_size(size_t cardinality, size_t runs) {
+        const size_t run_size{2 + 4 * runs};
+        const bool is_array{cardinality <= kMaxArrayContainerCardinality};
+        const size_t non_run_size{is_array ? 2 * cardinality : kBitsetContainerSize};
+        // Roaring compares run size against array size including its 2-byte cardinality
+        const size_t non_run_threshold{is_array ? 2 * cardinality + 2 : kBitsetContainerSize};
+        if (run_size < std::min(non_run_threshold, kBitsetContainerSize)) {
+            return run_size;
+        }
+        if (run_size > non_run_threshold) {
+            return non_run_size;
+        }
+        return std::max(run_size, non_run_size);
+    }
+
+    static size_t bitmap32_size(const State& state) {
+        return header_size(state.closed_containers + 1) + state.closed_containers_size + container_size(state.cardinality, state.runs);
+    }
+
+    static State with_value(const State& state, uint64_t value) {
+        State next{state};
+        const bool same_bucket{!state.empty && (value >> 32) == (state.last_value >> 32)};
+        const bool same_container{same_bucket && (value >> 16) == (state.last_value >> 16)};
+        if (!state.empty && !same_bucket) {
+            next.closed_buckets_size += sizeof(uint32_t) + bitmap32_size(state);
+            next.closed_containers = 0;
+            next.closed_containers_size = 0;
+        } else if (!state.empty && !same_container) {
+            ++next.closed_containers;
+            next.closed_containers_size += container_size(state.cardinality, state.runs);
+        }
+        if (!same_container) {
+            next.cardinality = 0;
+            next.runs = 0;
+        }
+        if (!same_container || value != state.last_value + 1) {
+            ++next.runs;
+        }
+        ++next.cardinality;
+        next.last_value = value;
+        next.empty = false;
+        return next;
+    }
 
-template <>
-[[maybe_unused]] void remove_range_impl(roaring::Roaring64Map& bm, uint64_t min, uint64_t max) {
-    for (uint64_t k = min; k < max; ++k) {
-        bm.remove(k);
+    [[nodiscard]] size_t size_of(const State& state) const {
+        if (is_64bit_) {
+            return sizeof(uint64_t) + state.closed_buckets_size + sizeof(uint32_t) + bitmap32_size(state);
+        }
+        return bitmap32_size(state);
     }
+
+    bool is_64bit_;
+    State state_;
+};
+
+//! Max number of values walked to find a cutting point before giving up: long runs of consecutive values, typical of
+//! dense bitmaps, take few bytes for many values and are cut faster by binary search
+constexpr size_t kMaxShardValuesToWalk{1 << 18};
+
+//! Find the last value of the longest left part of the bitmap whose serialized size does not exceed the limit,
+//! accumulating the size in one pass over its values
+template <typename RoaringMap>
+std::optional<uint64_t> find_shard_last_value(const RoaringMap& bm, uint64_t size_limit) {
+    SerializedSizeEstimator size_estimator{std::is_same_v<RoaringMap, roaring::Roaring64Map>};
+    std::optional<uint64_t> shard_last_value;
+    size_t walked_values{0};
+    for (const uint64_t value : bm) {
+        if (size_estimator.size_with(value) > size_limit) {
+            // Shards must never be empty
+            return shard_last_value ? shard_last_value : value;
+        }
+        if (++walked_values > kMaxShardValuesToWalk) {
+            return std::nullopt;
+        }
+        size_estimator.add(value);
+        shard_last_value = value;
+    }
+    return shard_last_value;
 }
 
 template <typename RoaringMap>
-RoaringMap cut_left_impl(RoaringMap& bm, uint64_t size_limit) {
+RoaringMap cut_left_by_search_impl(RoaringMap& bm, uint64_t size_limit) {
     if (bm.getSizeInBytes() <= size_limit) {
         RoaringMap res = bm;
         res.runOptimize();
@@ -82,10 +185,94 @@ RoaringMap cut_left_impl(RoaringMap& bm, uint64_t size_limit) {
     RoaringMap res(roaring::api::roaring_bitmap_from_range(from, from + cutting_point, 1));
     res &= bm;
     res.runOptimize();
-    remove_range_impl<RoaringMap>(bm, from, from + cutting_point);
+    bm -= res;
     return res;
 }
 
+template <typename RoaringMap>
+RoaringMap cut_left_impl(RoaringMap& bm, uint64_t size_limit) {
+    if (bm.getSizeInBytes() <= size_limit) {
+        RoaringMap res = bm;
+        res.runOptimize();
+        bm = RoaringMap();
+        return res;
+    }
+
+    if (const auto shard_last_value{find_shard_last_value(bm, size_limit)}) {
+        RoaringMap res(roaring::api::roaring_bitmap_from_range(bm.minimum(), *shard_last_value + 1, 1));
+        res &= bm;
+        res.runOptimize();
+        // The estimate cannot be too low, but an oversized shard would not fit the page: better safe than sorry
+        if (res.getSizeInBytes() <= size_limit) {
+            bm -= res;
+            return res;
+        }
+    }
+    return cut_left_by_search_impl(bm, size_limit);
+}
+
+//! Min number of keys whose bitmaps are merged by the same worker
+constexpr size_t kMinKeysPerMergeTask{64};
+
+//! Max number of keys whose bitmaps are merged in parallel before writing their shards
+constexpr size_t kMaxKeysPerMergeBatch{8192};
+
+//! The bitmaps to be merged for one key and the resulting shards
+struct BitmapsMerge {
+    Bytes shard_key;                              // Key of the last shard
+    std::vector<Bytes> bitmaps;                   // Last shard in the index (if any) followed by the collected bitmaps
+    std::vector<std::pair<Bytes, Bytes>> shards;  // Shard keys and values to be written
+};
+
+template <typename RoaringMap, typename BlockUpperBound>
+void build_shards(std::span<BitmapsMerge> merges, size_t optimal_shard_size) {
+    for (auto& merge : merges) {
+        auto bitmap{parse_impl<RoaringMap>(merge.bitmaps.front())};
+        for (size_t i{1}; i < merge.bitmaps.size(); ++i) {
+            bitmap |= parse_impl<RoaringMap>(merge.bitmaps[i]);
+        }
+        merge.bitmaps.clear();
+
+        // Consume bitmap splitting in shards
+        Bytes shard_key{merge.shard_key};
+        while (!bitmap.isEmpty()) {
+            auto shard{cut_left_impl<RoaringMap>(bitmap, optimal_shard_size)};
+            const bool consumed_to_last_chunk{bitmap.isEmpty()};
+            const BlockUpperBound suffix{consumed_to_last_chunk ? std::numeric_limits<BlockUpperBound>::max() : shard.maximum()};
+            intx::be::unsafe::store<BlockUpperBound>(&shard_key[shard_key.size() - sizeof(BlockUpperBound)], suffix);
+            merge.shards.emplace_back(shard_key, db::bitmap::to_bytes(shard));
+        }
+    }
+}
+
+template <typename RoaringMap, typename BlockUpperBound>
+void build_shards_in_parallel(ThreadPool* worker_pool, std::vector<BitmapsMerge>& merges, size_t optimal_shard_size) {
+    if (!worker_pool) {
+        build_shards<RoaringMap, BlockUpperBound>(merges, optimal_shard_size);
+        return;
+    }
+    const size_t keys_per_task{std::max(kMinKeysPerMergeTask, (merges.size() + worker_pool->get_thread_count() - 1) / worker_pool->get_thread_count())};
+    if (merges.size() <= keys_per_task) {
+        build_shards<RoaringMap, BlockUpperBound>(merges, optimal_shard_size);
+        return;
+    }
+
+    std::vector<std::future<void>> tasks;
+    for (size_t first{0}; first < merges.size(); first += keys_per_task) {
+        const std::span<BitmapsMerge> key_range{&merges[first], std::min(keys_per_task, merges.size() - first)};
+        tasks.push_back(worker_pool->submit([key_range, optimal_shard_size]() {
+            build_shards<RoaringMap, BlockUpperBound>(key_range, optimal_shard_size);
+        }));
+    }
+    // Every task must be done before rethrowing any failure, as they all refer to the merges
+    for (auto& task : tasks) {
+        task.wait();
+    }
+    for (auto& task : tasks) {
+        task.get();
+    }
+}
+
 template <typename RoaringMap, typename BlockUpperBound>
 void IndexLoader::merge_bitmaps_impl(RWTxn& txn, size_t key_size, etl::Collector* bitmaps_collector) {
     // Cannot use db::block_key because we need block number serialized in sizeof(BlockUpperBound) bytes
@@ -94,40 +281,51 @@ void IndexLoader::merge_bitmaps_impl(RWTxn& txn, size_t key_size, etl::Collector
     const size_t optimal_shard_size{
         db::max_value_size_for_leaf_page(*txn, key_size + /*shard upper_bound*/ sizeof(BlockUpperBound))};
 
-    db::PooledCursor target(txn, index_config_);
-    etl::LoadFunc load_func{[&last_shard_suffix, &optimal_shard_size](const etl::Entry& entry,
-                                                                      RWCursorDupSort& index_cursor,
-                                                                      MDBX_put_flags_t put_flags) -> void {
-        auto new_bitmap{db::bitmap::parse_impl<RoaringMap>(entry.value)};  // Bitmap being merged
+    // Bitmaps are merged and split in shards in parallel for batches of keys, then shards are written in key order
+    std::vector<BitmapsMerge> merge_batch;
+    const auto write_merge_batch{[&](RWCursorDupSort& index_cursor, MDBX_put_flags_t put_flags) {
+        build_shards_in_parallel<RoaringMap, BlockUpperBound>(merge_workers_, merge_batch, optimal_shard_size);
+        for (const auto& merge : merge_batch) {
+            for (const auto& [shard_key, shard_bytes] : merge.shards) {
+                mdbx::slice k{db::to_slice(shard_key)};
+                mdbx::slice v{db::to_slice(shard_bytes)};
+                mdbx::error::success_or_throw(index_cursor.put(k, &v, put_flags));
+            }
+        }
+        merge_batch.clear();
+    }};
 
-        // Check whether we have any previous shard to merge with
+    db::PooledCursor target(txn, index_config_);
+    etl::LoadFunc load_func{[&](const etl::Entry& entry,
+                                RWCursorDupSort& index_cursor,
+                                MDBX_put_flags_t put_flags) -> void {
         Bytes shard_key{
             entry.key
                 .substr(0, entry.key.size() - sizeof(uint16_t)) /* remove etl ordering suffix */
                 .append(last_shard_suffix)};                    /* and append const suffix for last key */
 
-        if (auto index_data{index_cursor.find(db::to_slice(shard_key), /*throw_notfound=*/false)}; index_data.done) {
-            // Merge previous and current bitmap
-            new_bitmap |= db::bitmap::parse_impl<RoaringMap>(index_data.value);
-            index_cursor.erase();  // Delete currently found record as it'll be rewritten
+        // Bitmaps collected in subsequent flushes for the same key come one after the other
+        if (!merge_batch.empty() && merge_batch.back().shard_key == shard_key) {
+            merge_batch.back().bitmaps.push_back(entry.value);
+            return;
+        }
+        if (merge_batch.size() == kMaxKeysPerMergeBatch) {
+            write_merge_batch(index_cursor, put_flags);
         }
 
-        // Consume bitmap splitting in shards
-        while (!new_bitmap.isEmpty()) {
-            auto shard{db::bitmap::cut_left_impl<RoaringMap>(new_bitmap, optimal_shard_size)};
-            const bool consumed_to_last_chunk{new_bitmap.isEmpty()};
-            const BlockUpperBound suffix{consumed_to_last_chunk ? std::numeric_limits<BlockUpperBound>::max() : shard.maximum()};
-            intx::be::unsafe::store<BlockUpperBound>(&shard_key[shard_key.size() - sizeof(BlockUpperBound)], suffix);
-            Bytes shard_bytes{db::bitmap::to_bytes(shard)};
-            mdbx::slice k{db::to_slice(shard_key)};
-            mdbx::slice v{db::to_slice(shard_bytes)};
-            mdbx::error::success_or_throw(index_cursor.put(k, &v, put_flags));
+        auto& merge{merge_batch.emplace_back()};
+        // Check whether we have any previous shard to merge with
+        if (auto index_data{index_cursor.find(db::to_slice(shard_key), /*throw_notfound=*/false)}; index_data.done) {
+            merge.bitmaps.emplace_back(db::from_slice(index_data.value));
+            index_cursor.erase();  // Delete currently found record as it'll be rewritten
         }
+        merge.bitmaps.push_back(entry.value);
+        merge.shard_key = std::move(shard_key);
     }};
 
-    bitmaps_collector->load(target,
-                            load_func,
-                            target.empty() ? MDBX_put_flags_t::MDBX_APPEND : MDBX_put_flags_t::MDBX_UPSERT);
+    const auto put_flags{target.empty() ? MDBX_put_flags_t::MDBX_APPEND : MDBX_put_flags_t::MDBX_UPSERT};
+    bitmaps_collector->load(target, load_func, put_flags);
+    write_merge_batch(target, put_flags);
     bitmaps_collector->clear();
 }
 
@@ -305,6 +503,14 @@ roaring::Roaring64Map cut_left(roaring::Roaring64Map& bitmap, uint64_t size_limi
     return cut_left_impl(bitmap, size_limit);
 }
 
+roaring::Roaring cut_left_by_search(roaring::Roaring& bitmap, uint64_t size_limit) {
+    return cut_left_by_search_impl(bitmap, size_limit);
+}
+
+roaring::Roaring64Map cut_left_by_search(roaring::Roaring64Map& bitmap, uint64_t size_limit) {
+    return cut_left_by_search_impl(bitmap, size_limit);
+}
+
 template <typename RoaringMap>
 Bytes bitmap_to_bytes(RoaringMap& bitmap) {
     if (!bitmap.isEmpty()) {
@@ -37,6 +37,7 @@
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/db/mdbx.hpp>
 
 namespace silkworm::etl {
@@ -47,7 +48,10 @@ namespace silkworm::db::bitmap {
 
 class IndexLoader {
   public:
-    explicit IndexLoader(const db::MapConfig& index_config) : index_config_{index_config} {}
+    //! \param index_config [in] : The config of the index table
+    //! \param merge_workers [in] : The pool merging the bitmaps of different keys in parallel, sequential merge if null
+    explicit IndexLoader(const db::MapConfig& index_config, ThreadPool* merge_workers = nullptr)
+        : index_config_{index_config}, merge_workers_{merge_workers} {}
 
     //! \brief Merges a list of bitmaps, previously collected, into index table ensuring
     //! all bitmaps are properly sharded and that last bitmap is marked with an UINT64_MAX upper bound
@@ -99,6 +103,7 @@ class IndexLoader {
     void prune_bitmaps_impl(RWTxn& txn, BlockNum threshold);
 
     const db::MapConfig& index_config_;  // The bucket config holding the index of maps
+    ThreadPool* merge_workers_;          // The pool merging bitmaps in parallel (if any)
     mutable std::mutex log_mtx_;         // To get progress status
     std::string current_key_;            // Key being processed
 };
@@ -114,6 +119,11 @@ roaring::Roaring64Map cut_left(roaring::Roaring64Map& bitmap, uint64_t size_limi
 // Remove from a bitmap and return its biggest left part not exceeding a given size
 roaring::Roaring cut_left(roaring::Roaring& bitmap, uint64_t size_limit);
 
+// Same as cut_left, but searching the cutting point by repeated intersections with ranges of values: much slower,
+// it is used as fallback and as reference
+roaring::Roaring64Map cut_left_by_search(roaring::Roaring64Map& bitmap, uint64_t size_limit);
+roaring::Roaring cut_left_by_search(roaring::Roaring& bitmap, uint64_t size_limit);
+
 //! \brief Return bytes of Roaring64Map data
 Bytes to_bytes(roaring::Roaring64Map& bitmap);
 
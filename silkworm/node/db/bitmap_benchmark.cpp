@@ -0,0 +1,66 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/node/db/bitmap.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+
+namespace silkworm::db::bitmap {
+
+//! Last block number in the benchmark bitmaps
+static constexpr uint64_t kLastBlock{10'000'000};
+
+//! Shard size limit for 4KB pages and address keys, as in the log address index
+static const uint64_t kShardSizeLimit{db::max_value_size_for_leaf_page(4_Kibi, kAddressLength + sizeof(uint32_t))};
+
+//! Build the bitmap of the blocks touching a key: a run of run_length consecutive blocks every step blocks
+static roaring::Roaring make_bitmap(uint64_t step, uint64_t run_length) {
+    roaring::Roaring bitmap;
+    for (uint64_t block{1}; block < kLastBlock; block += step) {
+        bitmap.addRange(block, block + run_length);
+    }
+    return bitmap;
+}
+
+template <typename CutLeft>
+static void cut_all_shards(benchmark::State& state, CutLeft cut) {
+    const auto bitmap{make_bitmap(static_cast<uint64_t>(state.range(0)), static_cast<uint64_t>(state.range(1)))};
+    for ([[maybe_unused]] auto _ : state) {
+        auto remaining{bitmap};
+        size_t shards{0};
+        while (!remaining.isEmpty()) {
+            benchmark::DoNotOptimize(cut(remaining, kShardSizeLimit));
+            ++shards;
+        }
+        state.counters["shards"] = static_cast<double>(shards);
+    }
+}
+
+static void cut_left_by_walk(benchmark::State& state) {
+    cut_all_shards(state, [](roaring::Roaring& bitmap, uint64_t size_limit) { return cut_left(bitmap, size_limit); });
+}
+
+static void cut_left_by_binary_search(benchmark::State& state) {
+    cut_all_shards(state, [](roaring::Roaring& bitmap, uint64_t size_limit) { return cut_left_by_search(bitmap, size_limit); });
+}
+
+// Arguments are step and run length: sparse, clustered, half full and long runs
+BENCHMARK(cut_left_by_walk)->Args({1'000, 1})->Args({100, 10})->Args({2, 1})->Args({10'000, 5'000});
+BENCHMARK(cut_left_by_binary_search)->Args({1'000, 1})->Args({100, 10})->Args({2, 1})->Args({10'000, 5'000});
+
+}  // namespace silkworm::db::bitmap
@@ -16,18 +16,23 @@
 
 #include "bitmap.hpp"
 
+#include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include <absl/container/btree_map.h>
 #include <catch2/catch.hpp>
 
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/etl/collector.hpp>
 #include <silkworm/node/test/context.hpp>
 
 namespace silkworm::db::bitmap {
 
-static void cut_everything(roaring::Roaring& bm, uint64_t limit) {
+template <typename RoaringMap>
+static void cut_everything(RoaringMap& bm, uint64_t limit) {
     while (bm.cardinality() > 0) {
         const auto original{bm};
         const auto left{cut_left(bm, limit)};
@@ -96,6 +101,50 @@ TEST_CASE("Roaring Bitmaps") {
         SECTION("limit=2048") { cut_everything(bm, 2048); }
     }
 
+    SECTION("cut_left sparse") {
+        roaring::Roaring bm;
+        for (uint64_t j{0}; j < 5'000'000; j += 997) {
+            bm.add(static_cast<uint32_t>(j));
+        }
+
+        SECTION("limit=1024") { cut_everything(bm, 1024); }
+        SECTION("limit=4096") { cut_everything(bm, 4096); }
+    }
+
+    SECTION("cut_left long runs") {
+        roaring::Roaring bm;
+        for (uint64_t j{0}; j < 50'000'000; j += 10'000) {
+            bm.addRange(j, j + 5'000);
+        }
+
+        SECTION("limit=1024") { cut_everything(bm, 1024); }
+    }
+
+    SECTION("cut_left 64-bit") {
+        roaring::Roaring64Map bm;
+        for (uint64_t j{0}; j < 1'000'000; j += 20) {
+            bm.addRange(j, j + 3);
+        }
+
+        SECTION("limit=1024") { cut_everything(bm, 1024); }
+        SECTION("limit=4096") { cut_everything(bm, 4096); }
+    }
+
+    SECTION("cut_left consistent with cut_left_by_search") {
+        roaring::Roaring bm;
+        for (uint64_t j{0}; j < 10'000; j += 20) {
+            bm.addRange(j, j + 10);
+        }
+        auto bm_by_search{bm};
+
+        const uint64_t limit{1024};
+        const auto left{cut_left(bm, limit)};
+        const auto left_by_search{cut_left_by_search(bm_by_search, limit)};
+        CHECK(left.maximum() <= left_by_search.maximum());
+        CHECK(left.getSizeInBytes() > limit - 256);
+        CHECK((left | bm) == (left_by_search | bm_by_search));
+    }
+
     SECTION("cut_left3") {
         roaring::Roaring bm;
         bm.add(1);
@@ -212,4 +261,68 @@ TEST_CASE("Bitmap Index Loader") {
     REQUIRE(bm_loader.get_current_key().empty());
 }
 
+TEST_CASE("Bitmap Index Loader merges in parallel like sequentially") {
+    // More keys than a merge batch, so that the batch is written and refilled in the middle of the load
+    static constexpr uint32_t kKeyCount{10'000};
+    static constexpr uint16_t kFlushCount{3};
+
+    const auto make_key{[](uint32_t i) {
+        Bytes key(kAddressLength, '\0');
+        endian::store_big_u32(&key[kAddressLength - sizeof(uint32_t)], i);
+        return key;
+    }};
+
+    // Load the collected bitmaps into an index already holding the even keys and return the index content
+    const auto load_index{[&](ThreadPool* merge_workers) {
+        test::Context context;
+        db::RWTxn& txn{context.rw_txn()};
+        const auto etl_path{context.node_settings().data_directory->etl().path()};
+
+        etl::Collector initial_collector(etl_path);
+        absl::btree_map<Bytes, roaring::Roaring64Map> initial_bitmaps;
+        for (uint32_t i{0}; i < kKeyCount; i += 2) {
+            initial_bitmaps.emplace(make_key(i), roaring::Roaring64Map{roaring::api::roaring_bitmap_from_range(1, 2 + i % 100, 1)});
+        }
+        IndexLoader::flush_bitmaps_to_etl(initial_bitmaps, &initial_collector, /*flush_count=*/1);
+        IndexLoader{db::table::kLogAddressIndex}.merge_bitmaps(txn, kAddressLength, &initial_collector);
+
+        etl::Collector collector(etl_path);
+        for (uint16_t flush_count{1}; flush_count <= kFlushCount; ++flush_count) {
+            absl::btree_map<Bytes, roaring::Roaring64Map> bitmaps;
+            for (uint32_t i{0}; i < kKeyCount; ++i) {
+                const uint64_t first_block{1'000 + 100'000 * flush_count};
+                // Some keys get dense enough bitmaps to need several shards
+                const uint64_t last_block{first_block + (i % 1'000 == 0 ? 90'000 : i % 50)};
+                bitmaps.emplace(make_key(i), roaring::Roaring64Map{roaring::api::roaring_bitmap_from_range(first_block, last_block + 1, 1 + i % 3)});
+            }
+            IndexLoader::flush_bitmaps_to_etl(bitmaps, &collector, flush_count);
+        }
+        IndexLoader{db::table::kLogAddressIndex, merge_workers}.merge_bitmaps(txn, kAddressLength, &collector);
+
+        std::vector<std::pair<Bytes, Bytes>> index;
+        PooledCursor index_cursor(txn, table::kLogAddressIndex);
+        for (auto data{index_cursor.to_first(/*throw_notfound=*/false)}; data; data = index_cursor.to_next(/*throw_notfound=*/false)) {
+            index.emplace_back(db::from_slice(data.key), db::from_slice(data.value));
+        }
+        return index;
+    }};
+
+    const auto sequential_index{load_index(nullptr)};
+    // Several workers so that the keys of each batch are split in merge tasks whatever the hardware
+    ThreadPool merge_workers{4};
+    const auto parallel_index{load_index(&merge_workers)};
+
+    REQUIRE(sequential_index.size() > kKeyCount);
+    CHECK(parallel_index == sequential_index);
+
+    // The existing shard of the even keys is merged with the collected bitmaps
+    Bytes key{make_key(42)};
+    key.append(db::block_key(UINT64_MAX));
+    const auto last_shard{std::find_if(parallel_index.cbegin(), parallel_index.cend(), [&](const auto& entry) { return entry.first == key; })};
+    REQUIRE(last_shard != parallel_index.cend());
+    const auto last_bitmap{bitmap::parse(last_shard->second)};
+    CHECK(last_bitmap.minimum() == 1);
+    CHECK(last_bitmap.maximum() == 1'000 + 100'000 * kFlushCount + 42);
+}
+
 }  // namespace silkworm::db::bitmap
@@ -317,6 +317,11 @@ void PooledCursor::bind(::mdbx::txn& txn, const MapConfig& config) {
     ::mdbx::cursor::bind(txn, map);
 }
 
+void PooledCursor::renew(ROTxn& txn) {
+    if (!handle_) throw std::runtime_error("cannot renew a closed cursor");
+    ::mdbx::cursor::renew(*txn);
+}
+
 void PooledCursor::close() {
     ::mdbx_cursor_close(handle_);
     handle_ = nullptr;
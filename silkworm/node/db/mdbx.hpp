@@ -241,6 +241,13 @@ class ROTxnManaged : public ROTxn {
 
     void abort() override { managed_txn_.abort(); }
 
+    //! \brief Move this transaction onto the latest database snapshot keeping its reader slot
+    //! \remarks Cursors bound to this transaction must be renewed before being used again
+    void renew() {
+        managed_txn_.reset_reading();
+        managed_txn_.renew_reading();
+    }
+
   protected:
     explicit ROTxnManaged(mdbx::txn_managed&& source) : ROTxn{managed_txn_}, managed_txn_{std::move(source)} {}
 
@@ -426,6 +433,9 @@ class PooledCursor : public RWCursorDupSort, protected ::mdbx::cursor {
 
     void bind(ROTxn& txn, const MapConfig& config) override { bind(*txn, config); }
 
+    //! \brief Reuse current cursor on the same map of provided read-only transaction after its renewal
+    void renew(ROTxn& txn);
+
     //! \brief Closes cursor causing de-allocation of MDBX_cursor handle
     //! \remarks After this call the cursor is not reusable and the handle does not return to the cache
     void close();
@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <map>
+#include <stdexcept>
 #include <thread>
 
 #include <catch2/catch.hpp>
@@ -231,6 +232,53 @@ TEST_CASE("Cursor") {
     REQUIRE(other_thread_size2 == 0);
 }
 
+TEST_CASE("Cursor renew") {
+    const TemporaryDirectory tmp_dir;
+    db::EnvConfig db_config{tmp_dir.path().string(), /*create*/ true};
+    db_config.in_memory = true;
+    auto env{db::open_env(db_config)};
+
+    const db::MapConfig map_config{"GeneticCode"};
+
+    {
+        auto rw_txn{env.start_write()};
+        db::PooledCursor rw_cursor{rw_txn, map_config};
+        rw_cursor.upsert(mdbx::slice{"AAA"}, mdbx::slice{kGeneticCode.at("AAA")});
+        rw_txn.commit();
+    }
+
+    db::ROTxnManaged ro_txn{env};
+    db::PooledCursor cursor{ro_txn, map_config};
+    CHECK(cursor.size() == 1);
+
+    {
+        auto rw_txn{env.start_write()};
+        db::PooledCursor rw_cursor{rw_txn, map_config};
+        rw_cursor.upsert(mdbx::slice{"AAC"}, mdbx::slice{kGeneticCode.at("AAC")});
+        rw_txn.commit();
+    }
+
+    // The cursor still reads the snapshot taken when the transaction started
+    CHECK(cursor.size() == 1);
+    CHECK_FALSE(cursor.find(mdbx::slice{"AAC"}, /*throw_notfound=*/false).done);
+
+    SECTION("renewed cursor sees the new snapshot") {
+        ro_txn.renew();
+        cursor.renew(ro_txn);
+        CHECK(cursor.size() == 2);
+        const auto result{cursor.find(mdbx::slice{"AAC"}, /*throw_notfound=*/false)};
+        REQUIRE(result.done);
+        CHECK(result.value.as_string() == kGeneticCode.at("AAC"));
+        CHECK(cursor.to_first(/*throw_notfound=*/false).key.as_string() == "AAA");
+    }
+
+    SECTION("closed cursor cannot be renewed") {
+        ro_txn.renew();
+        cursor.close();
+        CHECK_THROWS_AS(cursor.renew(ro_txn), std::runtime_error);
+    }
+}
+
 TEST_CASE("RWTxn") {
     const TemporaryDirectory tmp_dir;
     db::EnvConfig db_config{tmp_dir.path().string(), /*create*/ true};
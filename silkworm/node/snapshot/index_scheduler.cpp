@@ -0,0 +1,111 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "index_scheduler.hpp"
+
+#include <exception>
+#include <system_error>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::snapshot {
+
+void SegmentIndexScheduler::build_index(Index& index) {
+    const auto index_file{index.path().filename()};
+    SILK_INFO << "SnapshotSync: build index: " << index_file << " start";
+    try {
+        index.build();
+        SILK_INFO << "SnapshotSync: build index: " << index_file << " end";
+    } catch (const std::exception& ex) {
+        // Any index not built here will be built again after download completion
+        SILK_WARN << "SnapshotSync: build index: " << index_file << " failed: " << ex.what();
+        std::error_code ec;
+        std::filesystem::remove(index.path().path(), ec);
+    }
+}
+
+SegmentIndexScheduler::~SegmentIndexScheduler() {
+    stop();
+}
+
+void SegmentIndexScheduler::on_download_completed(const std::filesystem::path& snapshot_file) {
+    const auto segment_path{SnapshotPath::parse(snapshot_file)};
+    if (!segment_path || !segment_path->is_segment()) {
+        return;
+    }
+    const BlockRange block_range{segment_path->block_from(), segment_path->block_to()};
+
+    std::scoped_lock lock{mutex_};
+    switch (segment_path->type()) {
+        case SnapshotType::headers: {
+            schedule(std::make_shared<HeaderIndex>(*segment_path));
+            break;
+        }
+        case SnapshotType::bodies: {
+            schedule(std::make_shared<BodyIndex>(*segment_path));
+            downloaded_bodies_.insert(block_range);
+            if (const auto it{waiting_for_bodies_.find(block_range)}; it != waiting_for_bodies_.end()) {
+                schedule(std::make_shared<TransactionIndex>(it->second));
+                waiting_for_bodies_.erase(it);
+            }
+            break;
+        }
+        case SnapshotType::transactions: {
+            if (downloaded_bodies_.contains(block_range)) {
+                schedule(std::make_shared<TransactionIndex>(*segment_path));
+            } else {
+                waiting_for_bodies_.emplace(block_range, *segment_path);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+std::size_t SegmentIndexScheduler::pending_builds() const {
+    std::scoped_lock lock{mutex_};
+    return pending_builds_;
+}
+
+void SegmentIndexScheduler::wait() {
+    std::unique_lock lock{mutex_};
+    builds_completed_.wait(lock, [&]() { return pending_builds_ == 0; });
+}
+
+void SegmentIndexScheduler::stop() {
+    stopping_ = true;
+    wait();
+}
+
+void SegmentIndexScheduler::schedule(std::shared_ptr<Index> index) {
+    if (index->path().exists()) {
+        return;
+    }
+    ++pending_builds_;
+    scheduler_.submit(concurrency::TaskPriority::kBackground, [this, index = std::move(index)]() {
+        if (!stopping_) {
+            builder_(*index);
+        }
+        std::scoped_lock lock{mutex_};
+        if (--pending_builds_ == 0) {
+            builds_completed_.notify_all();
+        }
+    });
+}
+
+}  // namespace silkworm::snapshot
@@ -0,0 +1,82 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/infra/concurrency/work_stealing_scheduler.hpp>
+#include <silkworm/node/snapshot/index.hpp>
+#include <silkworm/node/snapshot/path.hpp>
+
+namespace silkworm::snapshot {
+
+//! Schedule the index build of each segment as background task as soon as its download has completed, so that indexing
+//! overlaps with downloading. Transaction index needs the bodies segment in the same block range, so it waits for it.
+class SegmentIndexScheduler {
+  public:
+    using IndexBuilder = std::function<void(Index&)>;
+
+    //! Build the index logging any failure, the partially built index file is removed so that it gets built again later
+    static void build_index(Index& index);
+
+    explicit SegmentIndexScheduler(concurrency::WorkStealingScheduler& scheduler, IndexBuilder builder = build_index)
+        : scheduler_{scheduler}, builder_{std::move(builder)} {}
+
+    //! Skip the index builds not started yet and wait for the running ones
+    ~SegmentIndexScheduler();
+
+    SegmentIndexScheduler(const SegmentIndexScheduler&) = delete;
+    SegmentIndexScheduler& operator=(const SegmentIndexScheduler&) = delete;
+
+    void on_download_completed(const std::filesystem::path& snapshot_file);
+
+    //! The number of index builds scheduled and not completed yet
+    [[nodiscard]] std::size_t pending_builds() const;
+
+    //! Block until all the index builds scheduled so far have completed
+    void wait();
+
+    //! Skip the index builds not started yet, then wait for the running ones
+    void stop();
+
+  private:
+    using BlockRange = std::pair<BlockNum, BlockNum>;
+
+    void schedule(std::shared_ptr<Index> index);
+
+    concurrency::WorkStealingScheduler& scheduler_;
+    IndexBuilder builder_;
+    std::atomic_bool stopping_{false};
+
+    mutable std::mutex mutex_;
+    std::condition_variable builds_completed_;
+    std::size_t pending_builds_{0};
+    std::set<BlockRange> downloaded_bodies_;
+    std::map<BlockRange, SnapshotPath> waiting_for_bodies_;
+};
+
+}  // namespace silkworm::snapshot
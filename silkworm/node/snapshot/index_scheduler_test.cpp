@@ -0,0 +1,111 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "index_scheduler.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/common/directories.hpp>
+
+namespace silkworm::snapshot {
+
+//! Record the index builds in order w/o building anything
+class IndexBuildRecorder {
+  public:
+    SegmentIndexScheduler::IndexBuilder builder() {
+        return [this](Index& index) {
+            std::scoped_lock lock{mutex_};
+            built_.push_back(index.path().filename());
+        };
+    }
+
+    std::vector<std::string> built() {
+        std::scoped_lock lock{mutex_};
+        return built_;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::string> built_;
+};
+
+TEST_CASE("SegmentIndexScheduler", "[silkworm][snapshot][sync]") {
+    const TemporaryDirectory tmp_dir;
+    const auto segment_file = [&](SnapshotType type, BlockNum block_from = 0) {
+        return SnapshotPath::from(tmp_dir.path(), kSnapshotV1, block_from, block_from + 500'000, type).path();
+    };
+
+    // A single worker runs the builds in the order they are scheduled
+    concurrency::WorkStealingScheduler scheduler{1};
+    IndexBuildRecorder recorder;
+    SegmentIndexScheduler index_scheduler{scheduler, recorder.builder()};
+
+    SECTION("transactions wait for bodies") {
+        index_scheduler.on_download_completed(segment_file(SnapshotType::transactions));
+        index_scheduler.on_download_completed(segment_file(SnapshotType::headers));
+        index_scheduler.wait();
+        CHECK(recorder.built() == std::vector<std::string>{"v1-000000-000500-headers.idx"});
+
+        index_scheduler.on_download_completed(segment_file(SnapshotType::bodies));
+        index_scheduler.wait();
+        CHECK(index_scheduler.pending_builds() == 0);
+        CHECK(recorder.built() == std::vector<std::string>{
+                                      "v1-000000-000500-headers.idx",
+                                      "v1-000000-000500-bodies.idx",
+                                      "v1-000000-000500-transactions.idx",
+                                  });
+    }
+
+    SECTION("transactions after bodies") {
+        index_scheduler.on_download_completed(segment_file(SnapshotType::bodies));
+        index_scheduler.on_download_completed(segment_file(SnapshotType::transactions));
+        index_scheduler.wait();
+        CHECK(recorder.built() == std::vector<std::string>{
+                                      "v1-000000-000500-bodies.idx",
+                                      "v1-000000-000500-transactions.idx",
+                                  });
+    }
+
+    SECTION("bodies in another block range") {
+        index_scheduler.on_download_completed(segment_file(SnapshotType::transactions));
+        index_scheduler.on_download_completed(segment_file(SnapshotType::bodies, 500'000));
+        index_scheduler.wait();
+        CHECK(recorder.built() == std::vector<std::string>{"v1-000500-001000-bodies.idx"});
+    }
+
+    SECTION("existing index and non-segment files are skipped") {
+        std::ofstream{SnapshotPath::from(tmp_dir.path(), kSnapshotV1, 0, 500'000, SnapshotType::headers).index_file().path()};
+        index_scheduler.on_download_completed(segment_file(SnapshotType::headers));
+        index_scheduler.on_download_completed(tmp_dir.path() / "v1-000000-000500-bodies.seg.torrent");
+        index_scheduler.on_download_completed(tmp_dir.path() / "unknown.seg");
+        index_scheduler.wait();
+        CHECK(recorder.built().empty());
+    }
+
+    SECTION("stop skips the builds not started yet") {
+        index_scheduler.stop();
+        index_scheduler.on_download_completed(segment_file(SnapshotType::headers));
+        index_scheduler.wait();
+        CHECK(recorder.built().empty());
+    }
+}
+
+}  // namespace silkworm::snapshot
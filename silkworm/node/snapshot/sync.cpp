@@ -26,10 +26,12 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/infra/concurrency/thread_safe_queue.hpp>
+#include <silkworm/infra/concurrency/work_stealing_scheduler.hpp>
 #include <silkworm/node/db/stages.hpp>
 #include <silkworm/node/etl/collector.hpp>
 #include <silkworm/node/snapshot/config.hpp>
 #include <silkworm/node/snapshot/index.hpp>
+#include <silkworm/node/snapshot/index_scheduler.hpp>
 #include <silkworm/node/snapshot/path.hpp>
 
 namespace silkworm::snapshot {
@@ -152,10 +154,13 @@ bool SnapshotSync::download_snapshots(const std::vector<std::string>& snapshot_f
     };
     const auto stats_connection = client_.stats_subscription.connect(log_stats);
 
+    SegmentIndexScheduler index_scheduler{concurrency::shared_scheduler()};
+
     std::latch download_done{num_snapshots};
     auto log_completed = [&](const std::filesystem::path& snapshot_file) {
         SILK_INFO << "SnapshotSync: download completed for: " << snapshot_file.filename().string()
                   << " [" << ++completed << "/" << num_snapshots << "]";
+        index_scheduler.on_download_completed(snapshot_file);
         download_done.count_down();
     };
     const auto completed_connection = client_.completed_subscription.connect(log_completed);
@@ -181,6 +186,12 @@ bool SnapshotSync::download_snapshots(const std::vector<std::string>& snapshot_f
     completed_connection.disconnect();
     stats_connection.disconnect();
 
+    // Wait for the indexes of the last downloaded segments or stop request, any index still missing will be built afterwards
+    while (index_scheduler.pending_builds() > 0 and not is_stopping()) {
+        std::this_thread::sleep_for(kCheckCompletionInterval);
+    }
+    index_scheduler.stop();
+
     reopen();
     return true;
 }
@@ -221,7 +232,11 @@ void SnapshotSync::build_missing_indexes() {
         });
     }
 
-    // Wait for all missing indexes to be built or stop request
+    wait_for_workers(workers);
+}
+
+void SnapshotSync::wait_for_workers(ThreadPool& workers) {
+    // Wait for all tasks to be completed or stop request
     while (workers.get_tasks_total() and not is_stopping()) {
         std::this_thread::sleep_for(kCheckCompletionInterval);
     }
@@ -22,6 +22,7 @@
 
 #include <silkworm/core/chain/config.hpp>
 #include <silkworm/infra/concurrency/stoppable.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/bittorrent/client.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/snapshot/repository.hpp>
@@ -43,6 +44,7 @@ class SnapshotSync : public Stoppable {
   private:
     void reopen();
     void build_missing_indexes();
+    void wait_for_workers(ThreadPool& workers);
     void update_database(db::RWTxn& txn, BlockNum max_block_available);
     void update_block_headers(db::RWTxn& txn, BlockNum max_block_available);
     void update_block_bodies(db::RWTxn& txn, BlockNum max_block_available);
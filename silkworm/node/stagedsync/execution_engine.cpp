@@ -51,6 +51,10 @@ BlockId ExecutionEngine::last_fork_choice() const {
     return last_fork_choice_;
 }
 
+void ExecutionEngine::set_state_change_collection(StateChangeCollection* collection) {
+    main_chain_.set_state_change_collection(collection);
+}
+
 BlockId ExecutionEngine::last_finalized_block() const {
     return last_finalized_block_;
 }
@@ -78,6 +82,16 @@ bool ExecutionEngine::insert_block(const std::shared_ptr<Block>& block) {
         return true;
     }
 
+    // fast path: a block extending the canonical head goes directly into the main chain
+    if (can_extend_main_chain(block->header)) {
+        SILK_DEBUG << "ExecutionEngine: extending the canonical chain";
+
+        main_chain_.insert_block(*block);  // BLOCKING
+        canonical_extension_head_ = {.number = block->header.number, .hash = header_hash};
+        canonical_extension_status_.reset();
+        return true;
+    }
+
     // find attachment point at fork heads
     auto f = find_fork_to_extend(forks_, block->header);
 
@@ -89,22 +103,61 @@ bool ExecutionEngine::insert_block(const std::shared_ptr<Block>& block) {
     } else {
         // the block must be put to a new fork
         // (to avoid complicated code we ignore the case whether the attaching point is inside a current fork)
+        if (create_fork(block, header_hash) == forks_.end()) return false;
+    }
 
-        auto forking_path = find_forking_point(block->header);
-        if (!forking_path) return false;
-        if (forking_path->forking_point.number < last_finalized_block().number) return false;  // ignore
-        forking_path->blocks.push_back(block);
+    return true;
+}
 
-        SILK_DEBUG << "ExecutionEngine: creating new fork";
+ForkContainer::iterator ExecutionEngine::create_fork(const std::shared_ptr<Block>& head_block, const Hash& head_hash) {
+    auto forking_path = find_forking_point(head_block->header);
+    if (!forking_path) return forks_.end();
+    if (forking_path->forking_point.number < last_finalized_block().number) return forks_.end();  // ignore
+    forking_path->blocks.push_back(head_block);
 
-        forks_.push_back(main_chain_.fork(forking_path->forking_point));
+    // an invalid canonical extension cannot be chosen and prevents forking, so drop it
+    if (canonical_extension_head_ && canonical_extension_status_ &&
+        !std::holds_alternative<ValidChain>(*canonical_extension_status_)) {
+        discard_canonical_extension();
+    }
 
-        auto& new_fork = forks_.back();
-        BlockId new_head = {.number = block->header.number, .hash = header_hash};
-        new_fork->start_with(new_head, std::move(forking_path->blocks));
+    // keep the number of validated forks bounded: an evicted fork is re-created by recreate_fork when needed
+    if (forks_.size() >= kMaxForks) {
+        discard_oldest_fork();
     }
 
-    return true;
+    SILK_DEBUG << "ExecutionEngine: creating new fork";
+
+    forks_.push_back(main_chain_.fork(forking_path->forking_point));
+
+    auto& new_fork = forks_.back();
+    BlockId new_head = {.number = head_block->header.number, .hash = head_hash};
+    new_fork->start_with(new_head, std::move(forking_path->blocks));
+
+    return std::prev(forks_.end());
+}
+
+bool ExecutionEngine::can_extend_main_chain(const BlockHeader& header) const {
+    if (canonical_extension_head_) {
+        const bool extension_invalid = canonical_extension_status_ &&
+                                       !std::holds_alternative<ValidChain>(*canonical_extension_status_);
+        return !extension_invalid && header.parent_hash == canonical_extension_head_->hash;
+    }
+
+    return header.parent_hash == last_fork_choice_.hash && main_chain_.current_head() == last_fork_choice_;
+}
+
+bool ExecutionEngine::is_canonical_extension_head(const Hash& header_hash) const {
+    return canonical_extension_head_ && canonical_extension_head_->hash == header_hash;
+}
+
+void ExecutionEngine::discard_canonical_extension() {
+    const auto extension_head{*canonical_extension_head_};
+    canonical_extension_head_.reset();
+    canonical_extension_status_.reset();
+
+    main_chain_.unwind_to_last_fork_choice();                // BLOCKING
+    main_chain_.discard_uncommitted_blocks(extension_head);  // BLOCKING
 }
 
 std::optional<ExecutionEngine::ForkingPath> ExecutionEngine::find_forking_point(const BlockHeader& header) const {
@@ -141,14 +194,18 @@ concurrency::AwaitableFuture<VerificationResult> ExecutionEngine::verify_chain(H
         return promise.get_future();
     }
 
-    if (!fork_tracking_active_) {
+    if (!fork_tracking_active_ || is_canonical_extension_head(head_block_hash)) {
         auto verification = main_chain_.verify_chain(head_block_hash);  // BLOCKING
+        if (fork_tracking_active_) canonical_extension_status_ = verification;
         concurrency::AwaitablePromise<VerificationResult> promise{io_context_.get_executor()};
         promise.set_value(std::move(verification));
         return promise.get_future();
     }
 
     auto fork = find_fork_by_head(forks_, head_block_hash);
+    if (fork == forks_.end() && !main_chain_.is_finalized_canonical(head_block_hash)) {
+        fork = recreate_fork(head_block_hash);  // the fork was evicted, we need to execute it again
+    }
     if (fork == forks_.end()) {
         if (main_chain_.is_finalized_canonical(head_block_hash)) {
             SILK_DEBUG << "ExecutionEngine: chain " << head_block_hash.to_hex() << " already verified";
@@ -169,10 +226,16 @@ concurrency::AwaitableFuture<VerificationResult> ExecutionEngine::verify_chain(H
 bool ExecutionEngine::notify_fork_choice_update(Hash head_block_hash, std::optional<Hash> finalized_block_hash) {
     log::Info("ExecutionEngine") << "updating fork choice to " << head_block_hash.to_hex();
 
-    if (!fork_tracking_active_ || head_block_hash == last_fork_choice_.hash) {
+    if (!fork_tracking_active_ || head_block_hash == last_fork_choice_.hash || is_canonical_extension_head(head_block_hash)) {
         bool updated = main_chain_.notify_fork_choice_update(head_block_hash, finalized_block_hash);  // BLOCKING
         if (!updated) return false;
 
+        if (is_canonical_extension_head(head_block_hash)) {
+            canonical_extension_head_.reset();  // committed by the main chain
+            canonical_extension_status_.reset();
+            discard_all_forks();  // sibling forks are no more extensible
+        }
+
         last_fork_choice_ = main_chain_.last_chosen_head();
         if (head_block_hash == main_chain_.current_head().hash and node_settings_.parallel_fork_tracking_enabled) {
             log::Info("ExecutionEngine") << "activate parallel fork tracking at head " << head_block_hash.to_hex();
@@ -181,6 +244,10 @@ bool ExecutionEngine::notify_fork_choice_update(Hash head_block_hash, std::optio
     } else {
         // chose the fork with the given head
         auto f = find_fork_by_head(forks_, head_block_hash);
+        if (f == forks_.end() && !main_chain_.is_finalized_canonical(head_block_hash)) {
+            f = recreate_fork(head_block_hash);
+            if (f != forks_.end()) (*f)->verify_chain();  // fork operations are executed in order
+        }
 
         if (f == forks_.end()) {
             if (main_chain_.is_finalized_canonical(head_block_hash)) {
@@ -200,6 +267,9 @@ bool ExecutionEngine::notify_fork_choice_update(Hash head_block_hash, std::optio
         forks_.erase(f);
         discard_all_forks();  // remove all other forks
 
+        // the chosen fork has been validated over the last fork choice, so any canonical extension is stale
+        if (canonical_extension_head_) discard_canonical_extension();
+
         last_fork_choice_ = fork->current_head();
 
         main_chain_.reintegrate_fork(*fork);  // BLOCKING
@@ -217,6 +287,14 @@ bool ExecutionEngine::notify_fork_choice_update(Hash head_block_hash, std::optio
     return true;
 }
 
+ForkContainer::iterator ExecutionEngine::recreate_fork(const Hash& head_block_hash) {
+    auto head_block = block_cache_.get_as_copy(head_block_hash);
+    if (!head_block) return forks_.end();
+
+    SILK_DEBUG << "ExecutionEngine: re-creating fork with head " << head_block_hash.to_hex();
+    return create_fork(*head_block, head_block_hash);
+}
+
 void ExecutionEngine::discard_all_forks() {
     // remove all forks except the given one from forks_
     // ensure a clean exit of all those forks that can be busy in a VerifyChain
@@ -228,6 +306,12 @@ void ExecutionEngine::discard_all_forks() {
     forks_.clear();
 }
 
+void ExecutionEngine::discard_oldest_fork() {
+    SILK_DEBUG << "ExecutionEngine: discarding oldest fork";
+    forks_.front()->close();
+    forks_.erase(forks_.begin());
+}
+
 // TO IMPLEMENT OR REWORK ---------------------------------------------------------------------------------------------
 
 std::optional<BlockHeader> ExecutionEngine::get_header(Hash header_hash) const {
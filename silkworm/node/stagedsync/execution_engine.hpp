@@ -49,6 +49,13 @@ namespace asio = boost::asio;
  * - block insertion & chain verification immediately return
  * - notify_fork_choice_update need to block to set a consistent view of the chain
  * On main-chain operations are blocking because when there are no forks we do not need async execution
+ * When fork tracking is active, blocks that simply extend the canonical head are executed directly on the main chain
+ * (canonical extension) avoiding the fork setup and overlay overhead, while side chains are executed on forks over the
+ * last fork choice. The canonical extension stays on the main chain until a fork choice update either commits it or
+ * selects a fork, which discards it: it is never moved to a fork. Discarding the extension also removes its blocks
+ * not committed yet, since forks allocate transaction ids from the committed state. Validated forks are kept (up to kMaxForks, oldest
+ * evicted first) until a fork choice update selects one of them, whose state is then committed without re-execution;
+ * an evicted fork is re-created from the block cache and executed again when verified or chosen
  */
 class ExecutionEngine : public Stoppable {
   public:
@@ -82,6 +89,9 @@ class ExecutionEngine : public Stoppable {
     std::vector<BlockHeader> get_last_headers(uint64_t limit) const;
     std::optional<TotalDifficulty> get_header_td(Hash, std::optional<BlockNum> = std::nullopt) const;
 
+    // state change notification
+    void set_state_change_collection(StateChangeCollection* collection);
+
   protected:
     struct ForkingPath {
         BlockId forking_point;
@@ -90,16 +100,28 @@ class ExecutionEngine : public Stoppable {
 
     std::optional<ForkingPath> find_forking_point(const BlockHeader& header) const;
     void discard_all_forks();
+    void discard_oldest_fork();
+
+    ForkContainer::iterator create_fork(const std::shared_ptr<Block>& head_block, const Hash& head_hash);
+    ForkContainer::iterator recreate_fork(const Hash& head_block_hash);
+
+    bool can_extend_main_chain(const BlockHeader& header) const;
+    bool is_canonical_extension_head(const Hash& header_hash) const;
+    void discard_canonical_extension();
 
     asio::io_context& io_context_;
     NodeSettings& node_settings_;
 
     MainChain main_chain_;
-    ForkContainer forks_;
+    ForkContainer forks_;  // validated side chains, oldest first
+    static constexpr size_t kMaxForks = 8;
 
     static constexpr size_t kDefaultCacheSize = 1000;
     mutable lru_cache<Hash, std::shared_ptr<Block>> block_cache_;
 
+    std::optional<BlockId> canonical_extension_head_;  // head of the blocks executed beyond the last fork choice
+    std::optional<VerificationResult> canonical_extension_status_;
+
     BlockNum block_progress_{0};
     bool fork_tracking_active_{false};
     BlockId last_finalized_block_;
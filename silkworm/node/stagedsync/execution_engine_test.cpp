@@ -22,6 +22,7 @@
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/core/protocol/validation.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/infra/common/environment.hpp>
 #include <silkworm/infra/test_util/log.hpp>
@@ -95,10 +96,24 @@ static std::shared_ptr<Block> generateSampleChildrenBlock(const BlockHeader& par
     return block;
 }
 
+static void addSampleTransaction(Block& block, uint64_t nonce) {
+    Transaction transaction;
+    transaction.nonce = nonce;
+    transaction.max_priority_fee_per_gas = 1;
+    transaction.max_fee_per_gas = 1;
+    transaction.gas_limit = 21'000;
+    transaction.to = 0xe5ef458d37212a06e3f59d40c454e76150ae7c32_address;
+    transaction.r = 1;
+    transaction.s = 1;
+    block.transactions.push_back(transaction);
+    block.header.transactions_root = protocol::compute_transaction_root(block);
+}
+
 class ExecutionEngine_ForTest : public stagedsync::ExecutionEngine {
   public:
     using stagedsync::ExecutionEngine::ExecutionEngine;
     using stagedsync::ExecutionEngine::forks_;
+    using stagedsync::ExecutionEngine::kMaxForks;
     using stagedsync::ExecutionEngine::main_chain_;
 };
 
@@ -367,6 +382,184 @@ TEST_CASE("ExecutionEngine") {
         CHECK(exec_engine.get_header(block3_hash).has_value());   // we do not remove old blocks
         CHECK(exec_engine.get_header(block4_hash).has_value());   // we do not remove old blocks
     }
+
+    SECTION("blocks extending the canonical head with parallel fork tracking") {
+        context.node_settings().parallel_fork_tracking_enabled = true;
+
+        auto block1 = generateSampleChildrenBlock(*header0);
+        auto block1_hash = block1->header.hash();
+
+        // inserting, verifying & confirming the block (this activates fork tracking)
+        exec_engine.insert_block(block1);
+        auto verification = exec_engine.verify_chain(block1_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        auto fcu_updated = exec_engine.notify_fork_choice_update(block1_hash, header0_hash);
+        CHECK(fcu_updated);
+
+        // a block extending the canonical head is executed on the main chain without creating a fork
+        auto block2 = generateSampleChildrenBlock(block1->header);
+        auto block2_hash = block2->header.hash();
+
+        exec_engine.insert_block(block2);
+        CHECK(exec_engine.forks_.empty());
+
+        verification = exec_engine.verify_chain(block2_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        CHECK(std::get<ValidChain>(verification).current_head == BlockId{2, block2_hash});
+        CHECK(!exec_engine.is_canonical(block2_hash));  // the current head is not yet accepted
+
+        fcu_updated = exec_engine.notify_fork_choice_update(block2_hash, block1_hash);
+        CHECK(fcu_updated);
+        CHECK(exec_engine.forks_.empty());
+
+        CHECK(exec_engine.last_fork_choice() == BlockId{2, block2_hash});
+        CHECK(exec_engine.last_finalized_block() == BlockId{1, block1_hash});
+        CHECK(exec_engine.get_canonical_hash(2) == block2_hash);
+
+        auto [head_height, head_hash] = db::read_canonical_head(tx);
+        CHECK(head_height == 2);
+        CHECK(head_hash == block2_hash);
+    }
+
+    SECTION("side chains beyond the max number of forks with parallel fork tracking") {
+        context.node_settings().parallel_fork_tracking_enabled = true;
+
+        auto block1 = generateSampleChildrenBlock(*header0);
+        auto block1_hash = block1->header.hash();
+
+        // inserting, verifying & confirming the block (this activates fork tracking)
+        exec_engine.insert_block(block1);
+        auto verification = exec_engine.verify_chain(block1_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        auto fcu_updated = exec_engine.notify_fork_choice_update(block1_hash, header0_hash);
+        CHECK(fcu_updated);
+
+        // a block extending the canonical head is executed on the main chain
+        auto block2 = generateSampleChildrenBlock(block1->header);
+        addSampleTransaction(*block2, 2);
+        auto block2_hash = block2->header.hash();
+        exec_engine.insert_block(block2);
+        verification = exec_engine.verify_chain(block2_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+
+        // sibling side chains are validated on forks, the oldest one is evicted beyond the max number of forks
+        std::vector<Hash> sibling_hashes;
+        for (size_t i{0}; i <= ExecutionEngine_ForTest::kMaxForks; ++i) {
+            auto sibling = generateSampleChildrenBlock(block1->header);
+            sibling->header.extra_data = Bytes(1, static_cast<uint8_t>(i + 1));  // to make it different from block2
+            addSampleTransaction(*sibling, 100 + i);
+            auto sibling_hash = sibling->header.hash();
+
+            exec_engine.insert_block(sibling);
+            verification = exec_engine.verify_chain(sibling_hash).get();
+            REQUIRE(holds_alternative<ValidChain>(verification));
+            CHECK(std::get<ValidChain>(verification).current_head == BlockId{2, sibling_hash});
+            sibling_hashes.push_back(sibling_hash);
+        }
+        CHECK(exec_engine.forks_.size() == ExecutionEngine_ForTest::kMaxForks);
+        CHECK(find_fork_by_head(exec_engine.forks_, sibling_hashes[0]) == exec_engine.forks_.end());
+        for (size_t i{1}; i < sibling_hashes.size(); ++i) {
+            CHECK(find_fork_by_head(exec_engine.forks_, sibling_hashes[i]) != exec_engine.forks_.end());
+        }
+
+        const auto evicted_hash{sibling_hashes[0]};
+
+        SECTION("evicted fork re-created and executed again at verification") {
+            verification = exec_engine.verify_chain(evicted_hash).get();
+            REQUIRE(holds_alternative<ValidChain>(verification));
+            CHECK(std::get<ValidChain>(verification).current_head == BlockId{2, evicted_hash});
+
+            // the re-created fork takes the place of the oldest one
+            CHECK(exec_engine.forks_.size() == ExecutionEngine_ForTest::kMaxForks);
+            CHECK(find_fork_by_head(exec_engine.forks_, evicted_hash) != exec_engine.forks_.end());
+            CHECK(find_fork_by_head(exec_engine.forks_, sibling_hashes[1]) == exec_engine.forks_.end());
+
+            fcu_updated = exec_engine.notify_fork_choice_update(evicted_hash, block1_hash);
+            CHECK(fcu_updated);
+        }
+
+        SECTION("evicted fork re-created and executed again at fork choice") {
+            fcu_updated = exec_engine.notify_fork_choice_update(evicted_hash, block1_hash);
+            CHECK(fcu_updated);
+        }
+
+        // the chosen fork replaces the canonical extension and all other forks are discarded
+        CHECK(exec_engine.forks_.empty());
+        CHECK(exec_engine.last_fork_choice() == BlockId{2, evicted_hash});
+        CHECK(exec_engine.last_finalized_block() == BlockId{1, block1_hash});
+        CHECK(exec_engine.get_canonical_hash(2) == evicted_hash);
+        CHECK(!exec_engine.is_canonical(block2_hash));
+
+        auto [head_height, head_hash] = db::read_canonical_head(tx);
+        CHECK(head_height == 2);
+        CHECK(head_hash == evicted_hash);
+
+        // the re-created fork has written the body of its head with the transaction ids taken by the extension
+        BlockBody evicted_body;
+        REQUIRE(db::read_body(tx, evicted_hash, 2, evicted_body));
+        REQUIRE(evicted_body.transactions.size() == 1);
+        CHECK(evicted_body.transactions[0].nonce == 100);
+        BlockBody block2_body;
+        CHECK_FALSE(db::read_body(tx, block2_hash, 2, block2_body));
+    }
+
+    SECTION("canonical extension discarded by a chosen fork and chosen again with parallel fork tracking") {
+        context.node_settings().parallel_fork_tracking_enabled = true;
+
+        auto block1 = generateSampleChildrenBlock(*header0);
+        auto block1_hash = block1->header.hash();
+
+        // inserting, verifying & confirming the block (this activates fork tracking)
+        exec_engine.insert_block(block1);
+        auto verification = exec_engine.verify_chain(block1_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        auto fcu_updated = exec_engine.notify_fork_choice_update(block1_hash, header0_hash);
+        CHECK(fcu_updated);
+
+        // the canonical extension and the sibling fork both take the first free transaction ids
+        auto block2 = generateSampleChildrenBlock(block1->header);
+        addSampleTransaction(*block2, 2);
+        auto block2_hash = block2->header.hash();
+        exec_engine.insert_block(block2);
+        verification = exec_engine.verify_chain(block2_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+
+        auto block2b = generateSampleChildrenBlock(block1->header);
+        block2b->header.extra_data = Bytes(1, 1);  // to make it different from block2
+        addSampleTransaction(*block2b, 20);
+        addSampleTransaction(*block2b, 21);
+        auto block2b_hash = block2b->header.hash();
+        exec_engine.insert_block(block2b);
+        CHECK(exec_engine.forks_.size() == 1);
+        verification = exec_engine.verify_chain(block2b_hash).get();
+        REQUIRE(holds_alternative<ValidChain>(verification));
+
+        const auto check_body = [&](const Hash& block_hash, const Block& block) {
+            BlockBody body;
+            REQUIRE(db::read_body(tx, block_hash, block.header.number, body));
+            REQUIRE(body.transactions.size() == block.transactions.size());
+            for (size_t i{0}; i < body.transactions.size(); ++i) {
+                CHECK(body.transactions[i].nonce == block.transactions[i].nonce);
+            }
+        };
+
+        // choosing the fork drops the extension blocks, so that the fork transactions do not end up in them
+        fcu_updated = exec_engine.notify_fork_choice_update(block2b_hash, block1_hash);
+        CHECK(fcu_updated);
+        CHECK(exec_engine.get_canonical_hash(2) == block2b_hash);
+        check_body(block2b_hash, *block2b);
+        BlockBody discarded_body;
+        CHECK_FALSE(db::read_body(tx, block2_hash, 2, discarded_body));
+
+        // choosing the former extension again re-creates it on a fork from the block cache
+        fcu_updated = exec_engine.notify_fork_choice_update(block2_hash, block1_hash);
+        CHECK(fcu_updated);
+        CHECK(exec_engine.forks_.empty());
+        CHECK(exec_engine.last_fork_choice() == BlockId{2, block2_hash});
+        CHECK(exec_engine.get_canonical_hash(2) == block2_hash);
+        check_body(block2_hash, *block2);
+        check_body(block2b_hash, *block2b);
+    }
 }
 
 }  // namespace silkworm
@@ -61,6 +61,10 @@ BlockId Fork::finalized_head() const {
     return finalized_head_;
 }
 
+BlockId Fork::forking_point() const {
+    return canonical_chain_.initial_head();
+}
+
 std::optional<VerificationResult> Fork::head_status() const {
     return head_status_;
 }
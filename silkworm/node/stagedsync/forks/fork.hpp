@@ -56,6 +56,7 @@ class Fork {
     BlockId current_head() const;
     std::optional<VerificationResult> head_status() const;
     BlockId finalized_head() const;
+    BlockId forking_point() const;  // lowest block shared with the main chain
 
     // checks
     bool extends_head(const BlockHeader&) const;
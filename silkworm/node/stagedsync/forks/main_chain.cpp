@@ -16,11 +16,14 @@
 
 #include "main_chain.hpp"
 
+#include <algorithm>
 #include <set>
 
 #include <gsl/util>
 #include <magic_enum.hpp>
 
+#include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/core/types/transaction.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
 #include <silkworm/node/db/access_layer.hpp>
@@ -29,9 +32,6 @@
 
 namespace silkworm::stagedsync {
 
-//! The number of inserted blocks between two successive commits on db
-constexpr uint64_t kInsertedBlockBatch{1'000};
-
 MainChain::MainChain(boost::asio::io_context& ctx, NodeSettings& ns, const db::RWAccess dba)
     : io_context_{ctx},
       node_settings_{ns},
@@ -46,6 +46,7 @@ MainChain::MainChain(boost::asio::io_context& ctx, NodeSettings& ns, const db::R
 
 void MainChain::open() {
     tx_.reopen(*db_access_);  // comply to mdbx limitation: tx must be used from its creation thread
+    committed_txn_sequence_ = db::read_map_sequence(tx_, db::table::kBlockTransactions.name);
 
     // Load last finalized and last chosen blocks from persistence
     auto last_finalized_hash = db::read_last_finalized_block(tx_);
@@ -94,6 +95,10 @@ db::RWTxn& MainChain::tx() {
     return tx_;
 }
 
+void MainChain::set_state_change_collection(StateChangeCollection* collection) {
+    state_change_collection_ = collection;
+}
+
 BlockId MainChain::current_head() const {
     return canonical_chain_.current_head();
 }
@@ -145,12 +150,11 @@ void MainChain::insert_block(const Block& block) {
     const auto parent = get_header(block.header.number - 1, block.header.parent_hash);
     ensure_invariant(parent.has_value(), "inserting block must have parent");
 
-    // Commit inserted blocks once in a while not to lose downloading progress on restart
-    static uint64_t block_count{0};
-    if (++block_count == kInsertedBlockBatch) {
-        block_count = 0;
+    // Commit inserted blocks once in a while not to lose downloading progress on restart, but never while blocks
+    // executed on the canonical chain beyond the last fork choice are pending: only a fork choice can confirm them
+    if (++inserted_block_count_ >= kInsertedBlockBatch && !has_unconfirmed_canonical_blocks()) {
         StopWatch timing{StopWatch::kStart};
-        tx_.commit_and_renew();
+        commit();
         SILK_INFO << "MainChain::insert_block commit " << kInsertedBlockBatch << " blocks up to " << block.header.number
                   << " took " << StopWatch::format(timing.since_start());
     }
@@ -249,6 +253,7 @@ bool MainChain::notify_fork_choice_update(Hash head_block_hash, std::optional<Ha
 
     const auto head_block_number{get_block_number(head_block_hash)};
     ensure_invariant(head_block_number.has_value(), "unknown block number for head block hash");
+    const BlockNum last_notified_height{last_fork_choice_.number};
     if (is_canonical_head_ancestor(head_block_hash) and head_block_number <= last_fork_choice_.number) {
         // FCU selects an old canonical block already targeted by a previous FCU
         return true;
@@ -285,13 +290,65 @@ bool MainChain::notify_fork_choice_update(Hash head_block_hash, std::optional<Ha
         last_finalized_head_.hash = *finalized_block_hash;
     }
 
-    tx_.commit_and_renew();
+    const bool state_changes_collected{collect_state_changes(last_notified_height, last_fork_choice_)};
+
+    commit();
+
+    if (state_changes_collected) {
+        notify_state_changes(last_fork_choice_);
+    }
 
     is_first_sync_ = false;
 
     return true;
 }
 
+void MainChain::unwind_to_last_fork_choice() {
+    // same db commit policy as verify_chain: state beyond the last fork choice is never committed
+    bool commit_at_each_stage = is_first_sync_;
+    if (!commit_at_each_stage) tx_.disable_commit();
+    auto _ = gsl::finally([&]() { tx_.enable_commit(); });
+
+    if (canonical_chain_.current_head().number > last_fork_choice_.number) {
+        unwind(last_fork_choice_.number);
+    }
+    ensure_invariant(canonical_chain_.current_head() == last_fork_choice_,
+                     "canonical head not aligned with last fork choice after unwind");
+
+    canonical_head_status_ = ValidChain{last_fork_choice_};
+}
+
+void MainChain::discard_uncommitted_blocks(BlockId head) {
+    // Forks see only the committed state, so they allocate the same transaction ids as the blocks inserted since the
+    // last commit: such blocks must go away before a fork is flushed here, otherwise their bodies would be left
+    // pointing to the fork transactions. Committed blocks are kept instead, their ids have been skipped by the forks
+    while (head.number > last_fork_choice_.number) {
+        const auto header{get_header(head.number, head.hash)};
+        if (!header) break;
+
+        const auto key{db::block_key(head.number, head.hash.bytes)};
+        const auto stored_body{tx_.ro_cursor(db::table::kBlockBodies)->find(db::to_slice(key), /*throw_notfound=*/false)};
+        if (stored_body) {
+            ByteView stored_body_view{db::from_slice(stored_body.value)};
+            if (db::detail::decode_stored_block_body(stored_body_view).base_txn_id < committed_txn_sequence_) break;
+        }
+        db::delete_body(tx_, head.hash, head.number);
+        db::delete_header(tx_, head.number, head.hash);
+
+        head = {head.number - 1, header->parent_hash};
+    }
+}
+
+void MainChain::commit() {
+    tx_.commit_and_renew();
+    inserted_block_count_ = 0;
+    committed_txn_sequence_ = db::read_map_sequence(tx_, db::table::kBlockTransactions.name);
+}
+
+bool MainChain::has_unconfirmed_canonical_blocks() const {
+    return !is_first_sync_ && canonical_chain_.current_head().number > last_fork_choice_.number;
+}
+
 std::set<Hash> MainChain::collect_bad_headers(db::RWTxn& tx, InvalidChain& invalid_chain) {
     if (!invalid_chain.bad_block) return {};
 
@@ -330,6 +387,117 @@ std::set<Hash> MainChain::collect_bad_headers(db::RWTxn& tx, InvalidChain& inval
     return bad_headers;
 }
 
+void MainChain::record_unwound_blocks(BlockNum unwind_point) {
+    if (!state_change_collection_ || is_first_sync_) return;
+
+    // Subscribers must unwind just the blocks already notified, i.e. those up to last fork choice not unwound yet
+    const BlockNum last_notified_height{last_fork_choice_.number};
+    const BlockNum notified_height{std::min(last_notified_height, lowest_unwind_point_.value_or(last_notified_height))};
+    for (BlockNum block_number{notified_height}; block_number > unwind_point; --block_number) {
+        const auto block_hash{db::read_canonical_hash(tx_, block_number)};
+        ensure_invariant(block_hash.has_value(), "canonical chain must be complete");
+        unwound_blocks_.push_back({{block_number, *block_hash},
+                                   db::read_account_changes(tx_, block_number),
+                                   db::read_storage_changes(tx_, block_number)});
+    }
+    lowest_unwind_point_ = std::min(unwind_point, notified_height);
+}
+
+bool MainChain::collect_state_changes(BlockNum last_notified_height, BlockId new_head) {
+    // Pending unwinds are consumed by the next commit in any case
+    auto _ = gsl::finally([&]() {
+        unwound_blocks_.clear();
+        lowest_unwind_point_.reset();
+    });
+
+    // Do not notify the first sync because it may span the whole chain: subscribers just miss their caches
+    if (!state_change_collection_ || is_first_sync_) return false;
+
+    state_change_collection_->reset(tx_.id());
+
+    // Unwound blocks go first, from the highest down to the lowest
+    for (const auto& unwound_block : unwound_blocks_) {
+        state_change_collection_->start_new_batch(unwound_block.block.number, unwound_block.block.hash, {},
+                                                  /*unwind=*/true);
+        add_state_changes(unwound_block.account_changes, unwound_block.storage_changes, /*unwind=*/true);
+    }
+
+    // Then the blocks in the new canonical segment, one state change for each block
+    const BlockNum forking_height{std::min(last_notified_height, lowest_unwind_point_.value_or(last_notified_height))};
+    for (BlockNum block_number{forking_height + 1}; block_number <= new_head.number; ++block_number) {
+        const auto block_hash{db::read_canonical_hash(tx_, block_number)};
+        ensure_invariant(block_hash.has_value(), "canonical chain must be complete");
+
+        std::vector<Bytes> tx_rlps;
+        BlockBody body;
+        if (db::read_body(tx_, *block_hash, block_number, body)) {
+            tx_rlps.reserve(body.transactions.size());
+            for (const auto& transaction : body.transactions) {
+                Bytes tx_rlp;
+                rlp::encode(tx_rlp, transaction);
+                tx_rlps.push_back(std::move(tx_rlp));
+            }
+        }
+        state_change_collection_->start_new_batch(block_number, *block_hash, std::move(tx_rlps), /*unwind=*/false);
+        add_state_changes(db::read_account_changes(tx_, block_number), db::read_storage_changes(tx_, block_number),
+                          /*unwind=*/false);
+    }
+
+    return true;
+}
+
+void MainChain::add_state_changes(const db::AccountChanges& account_changes, const db::StorageChanges& storage_changes,
+                                  bool unwind) {
+    // Change sets tell us *which* keys have been touched, values are taken from the current state because
+    // subscribers apply the whole batch at once on top of the state version being committed
+    for (const auto& [address, encoded_initial_account] : account_changes) {
+        const auto account{db::read_account(tx_, address)};
+        if (!account) {
+            state_change_collection_->delete_account(address);
+            continue;
+        }
+        state_change_collection_->change_account(address, account->incarnation, account->encode_for_storage());
+
+        // Contract code is sent only when moving forward and the contract has been (re)created
+        if (unwind || account->code_hash == kEmptyHash) continue;
+        bool created{encoded_initial_account.empty()};
+        if (!created) {
+            const auto initial_incarnation{Account::incarnation_from_encoded_storage(encoded_initial_account)};
+            created = initial_incarnation && *initial_incarnation < account->incarnation;
+        }
+        if (created) {
+            const auto code{db::read_code(tx_, account->code_hash)};
+            if (code) {
+                state_change_collection_->change_code(address, account->incarnation, Bytes{*code});
+            }
+        }
+    }
+    for (const auto& [address, changed_incarnations] : storage_changes) {
+        const auto account{db::read_account(tx_, address)};
+        if (!account) continue;  // storage of deleted accounts has already been dropped by delete_account
+
+        // Only the storage of the current incarnation is alive
+        const auto changed_locations_it{changed_incarnations.find(account->incarnation)};
+        if (changed_locations_it == changed_incarnations.end()) continue;
+        for (const auto& [location, _] : changed_locations_it->second) {
+            const auto value{db::read_storage(tx_, address, account->incarnation, location)};
+            state_change_collection_->change_storage(address, account->incarnation, location,
+                                                     Bytes{zeroless_view(value.bytes)});
+        }
+    }
+}
+
+void MainChain::notify_state_changes(BlockId new_head) {
+    const auto head_header{get_header(new_head.number, new_head.hash)};
+    ensure_invariant(head_header.has_value(), "header of committed head not found");
+
+    uint64_t pending_base_fee{0};
+    if (head_header->base_fee_per_gas) {
+        pending_base_fee = static_cast<uint64_t>(protocol::expected_base_fee_per_gas(*head_header));
+    }
+    state_change_collection_->notify_batch(pending_base_fee, head_header->gas_limit);
+}
+
 std::unique_ptr<ExtendingFork> MainChain::fork(BlockId forking_point) {
     ensure(std::holds_alternative<ValidChain>(canonical_head_status_), "forking is allowed from a valid state");
     return std::make_unique<ExtendingFork>(forking_point, *this, io_context_);
@@ -341,9 +509,17 @@ void MainChain::reintegrate_fork(ExtendingFork& extending_fork) {
     ensure(fork->head_status() && std::holds_alternative<ValidChain>(*fork->head_status()),
            "fork to be reintegrated must be valid");
 
+    record_unwound_blocks(fork->forking_point().number);  // must be done before the fork state replaces ours
+
     fork->flush(tx_);  // this must be done here, in the tx_ thread, due to MDBX limitations
 
-    tx_.commit_and_renew();
+    const bool state_changes_collected{collect_state_changes(last_fork_choice_.number, fork->current_head())};
+
+    commit();
+
+    if (state_changes_collected) {
+        notify_state_changes(fork->current_head());
+    }
 
     canonical_chain_.set_current_head(fork->current_head());
     canonical_head_status_ = *fork->head_status();
@@ -489,11 +665,16 @@ void MainChain::forward(BlockNum head_height, const Hash& head_hash) {
 }
 
 void MainChain::unwind(BlockNum unwind_point) {
+    record_unwound_blocks(unwind_point);  // must be done before the state changes of unwound blocks are gone
+
     const auto unwind_result = pipeline_.unwind(tx_, unwind_point);
     success_or_throw(unwind_result);  // unwind must complete with success
 
     // Remove last part of canonical chain
     canonical_chain_.delete_down_to(unwind_point);
+
+    // Blocks inserted so far are counted again from scratch towards the next batch commit
+    inserted_block_count_ = 0;
 }
 
 }  // namespace silkworm::stagedsync
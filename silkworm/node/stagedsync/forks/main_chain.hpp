@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <concepts>
+#include <optional>
 #include <set>
 #include <variant>
 #include <vector>
@@ -26,7 +27,9 @@
 
 #include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/core/types/block.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/db/memory_mutation.hpp>
+#include <silkworm/node/db/util.hpp>
 #include <silkworm/node/stagedsync/execution_pipeline.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
@@ -38,6 +41,9 @@ namespace silkworm::stagedsync {
 class Fork;
 class ExtendingFork;
 
+//! The number of inserted blocks between two successive commits on db
+inline constexpr uint64_t kInsertedBlockBatch{1'000};
+
 class MainChain {
   public:
     explicit MainChain(boost::asio::io_context&, NodeSettings&, db::RWAccess);
@@ -60,6 +66,10 @@ class MainChain {
     VerificationResult verify_chain(Hash head_block_hash);
     // accept the current chain up to head_block_hash
     bool notify_fork_choice_update(Hash head_block_hash, std::optional<Hash> finalized_block_hash = std::nullopt);
+    // discard any block executed on the canonical chain beyond the last fork choice
+    void unwind_to_last_fork_choice();
+    // remove the blocks not yet committed from head down to the last fork choice, so that they cannot clash with a fork
+    void discard_uncommitted_blocks(BlockId head);
 
     // state
     BlockId last_chosen_head() const;  // set by notify_fork_choice_update(), is always valid
@@ -82,6 +92,9 @@ class MainChain {
     std::optional<BlockBody> get_body(Hash) const;
     std::optional<BlockNum> get_block_number(Hash) const;
 
+    // state change notification
+    void set_state_change_collection(StateChangeCollection* collection);
+
     NodeSettings& node_settings();
     db::RWTxn& tx();  // only for testing purposes due to MDBX limitations
 
@@ -90,24 +103,45 @@ class MainChain {
     void insert_body(const Block&, const Hash& block_hash);
     void forward(BlockNum head_height, const Hash& head_hash);
     void unwind(BlockNum unwind_point);
+    void commit();
 
     bool is_canonical(BlockNum block_height, const Hash& block_hash) const;
     bool is_canonical_head_ancestor(const Hash& block_hash) const;
+    // true if blocks executed on the canonical chain beyond the last fork choice are waiting for confirmation
+    bool has_unconfirmed_canonical_blocks() const;
 
     std::set<Hash> collect_bad_headers(db::RWTxn& tx, InvalidChain& invalid_chain);
 
+    // state changes committed by fork choice updates, notified to the state change subscribers
+    struct UnwoundBlock {
+        BlockId block;
+        db::AccountChanges account_changes;
+        db::StorageChanges storage_changes;
+    };
+    void record_unwound_blocks(BlockNum unwind_point);
+    bool collect_state_changes(BlockNum last_notified_height, BlockId new_head);
+    void add_state_changes(const db::AccountChanges& account_changes, const db::StorageChanges& storage_changes,
+                           bool unwind);
+    void notify_state_changes(BlockId new_head);
+
     boost::asio::io_context& io_context_;
     NodeSettings& node_settings_;
     db::RWAccess db_access_;
     mutable db::RWTxnManaged tx_;
     db::DataModel data_model_;
     bool is_first_sync_{true};
+    uint64_t inserted_block_count_{0};  // blocks inserted since last commit
+    uint64_t committed_txn_sequence_{0};  // first transaction id not committed yet
 
     ExecutionPipeline pipeline_;
     CanonicalChain canonical_chain_;
     VerificationResult canonical_head_status_;
     BlockId last_fork_choice_;
     BlockId last_finalized_head_;
+
+    StateChangeCollection* state_change_collection_{nullptr};
+    std::vector<UnwoundBlock> unwound_blocks_;     // already notified blocks unwound since last commit, top-down
+    std::optional<BlockNum> lowest_unwind_point_;  // lowest unwind point since last commit
 };
 
 }  // namespace silkworm::stagedsync
@@ -17,6 +17,8 @@
 #include "main_chain.hpp"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <catch2/catch.hpp>
@@ -24,7 +26,9 @@
 #include <silkworm/core/common/bytes_to_string.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/infra/common/environment.hpp>
+#include <silkworm/infra/grpc/common/conversion.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/common/preverified_hashes.hpp>
 #include <silkworm/node/db/genesis.hpp>
 #include <silkworm/node/db/stages.hpp>
@@ -42,6 +46,7 @@ class MainChain_ForTest : public stagedsync::MainChain {
     using stagedsync::MainChain::canonical_head_status_;
     using stagedsync::MainChain::current_head;
     using stagedsync::MainChain::insert_block;
+    using stagedsync::MainChain::inserted_block_count_;
     using stagedsync::MainChain::MainChain;
     using stagedsync::MainChain::pipeline_;
     using stagedsync::MainChain::tx_;
@@ -289,9 +294,18 @@ TEST_CASE("MainChain") {
     }
 
     SECTION("diverting the head") {
+        StateChangeCollection state_change_collection;
+        std::vector<std::shared_ptr<const remote::StateChangeBatch>> state_change_batches;
+        state_change_collection.subscribe([&](std::shared_ptr<const remote::StateChangeBatch> batch) {
+            state_change_batches.push_back(std::move(batch));
+        },
+                                          StateChangeFilter{});
+        main_chain.set_state_change_collection(&state_change_collection);
+
         Block block1 = generateSampleChildrenBlock(*header0);
 
         Block block2 = generateSampleChildrenBlock(block1.header);
+        auto block2_hash = block2.header.hash();
 
         Block block3 = generateSampleChildrenBlock(block2.header);
         auto block3_hash = block3.header.hash();
@@ -320,6 +334,9 @@ TEST_CASE("MainChain") {
         CHECK(main_chain.canonical_chain_.current_head() == block3_id);
         REQUIRE(main_chain.last_chosen_head() == block3_id);  // not changed
 
+        // the first sync is not notified
+        CHECK(state_change_batches.empty());
+
         // Creating a fork and changing the head (trigger unwind)
         {
             Block block2b = generateSampleChildrenBlock(block1.header);
@@ -336,6 +353,7 @@ TEST_CASE("MainChain") {
             CHECK(valid_chain.current_head == block2b_id);
 
             // confirming the chain
+            const auto txn_id{tx.id()};
             fcu_updated = main_chain.notify_fork_choice_update(block2b_hash);
             CHECK(fcu_updated);
 
@@ -343,7 +361,83 @@ TEST_CASE("MainChain") {
             CHECK(final_canonical_head == block2b_id);
             CHECK(main_chain.canonical_chain_.current_head() == block2b_id);
             REQUIRE(main_chain.last_chosen_head() == block2b_id);  // not changed
+
+            // one batch notified: the unwound blocks top-down, then the new canonical block
+            REQUIRE(state_change_batches.size() == 1);
+            const auto& batch{*state_change_batches[0]};
+            CHECK(batch.state_version_id() == txn_id);
+            CHECK(batch.block_gas_limit() == block2b.header.gas_limit);
+            REQUIRE(batch.change_batch_size() == 3);
+            CHECK(batch.change_batch(0).direction() == remote::Direction::UNWIND);
+            CHECK(batch.change_batch(0).block_height() == 3);
+            CHECK(rpc::bytes32_from_H256(batch.change_batch(0).block_hash()) == block3_hash);
+            CHECK(batch.change_batch(1).direction() == remote::Direction::UNWIND);
+            CHECK(batch.change_batch(1).block_height() == 2);
+            CHECK(rpc::bytes32_from_H256(batch.change_batch(1).block_hash()) == block2_hash);
+            CHECK(batch.change_batch(2).direction() == remote::Direction::FORWARD);
+            CHECK(batch.change_batch(2).block_height() == 2);
+            CHECK(rpc::bytes32_from_H256(batch.change_batch(2).block_hash()) == block2b_hash);
+        }
+    }
+
+    SECTION("inserting blocks past the commit batch and then unwinding") {
+        Block block1 = generateSampleChildrenBlock(*header0);
+        auto block1_hash = block1.header.hash();
+        BlockId block1_id{1, block1_hash};
+
+        // inserting, verifying & confirming the block
+        main_chain.insert_block(block1);
+        auto verification = main_chain.verify_chain(block1_hash);
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        auto fcu_updated = main_chain.notify_fork_choice_update(block1_hash);
+        CHECK(fcu_updated);
+        CHECK(main_chain.inserted_block_count_ == 0);
+
+        // inserting a full batch of blocks not yet executed commits them
+        auto txn_id = tx.id();
+        BlockHeader parent = block1.header;
+        for (uint64_t i{0}; i < kInsertedBlockBatch - 1; ++i) {
+            Block block = generateSampleChildrenBlock(parent);
+            main_chain.insert_block(block);
+            parent = block.header;
+        }
+        CHECK(main_chain.inserted_block_count_ == kInsertedBlockBatch - 1);
+        CHECK(tx.id() == txn_id);
+        Block last_block = generateSampleChildrenBlock(parent);
+        main_chain.insert_block(last_block);
+        CHECK(main_chain.inserted_block_count_ == 0);
+        CHECK(tx.id() != txn_id);
+
+        // executing a canonical extension beyond the last fork choice
+        Block block2 = generateSampleChildrenBlock(block1.header);
+        block2.header.extra_data = string_view_to_byte_view("I'm different");  // to make it different from batch
+        auto block2_hash = block2.header.hash();
+        main_chain.insert_block(block2);
+        verification = main_chain.verify_chain(block2_hash);
+        REQUIRE(holds_alternative<ValidChain>(verification));
+        CHECK(main_chain.current_head() == BlockId{2, block2_hash});
+
+        // inserting past the batch size does not commit the unconfirmed extension
+        txn_id = tx.id();
+        parent = block2.header;
+        for (uint64_t i{0}; i < kInsertedBlockBatch; ++i) {
+            Block block = generateSampleChildrenBlock(parent);
+            main_chain.insert_block(block);
+            parent = block.header;
         }
+        CHECK(main_chain.inserted_block_count_ > kInsertedBlockBatch);
+        CHECK(tx.id() == txn_id);
+
+        // unwinding the extension resets the batch
+        main_chain.unwind_to_last_fork_choice();
+        CHECK(main_chain.current_head() == block1_id);
+        CHECK(main_chain.inserted_block_count_ == 0);
+        CHECK(tx.id() == txn_id);
+
+        // the next block is counted towards a new batch
+        main_chain.insert_block(generateSampleChildrenBlock(parent));
+        CHECK(main_chain.inserted_block_count_ == 1);
+        CHECK(tx.id() == txn_id);
     }
 
     SECTION("starting after fcu") {
@@ -28,6 +28,10 @@ namespace asio = boost::asio;
 Server::Server(NodeSettings& ns, db::RWAccess dba) : exec_engine_{io_context_, ns, dba} {
 }
 
+void Server::set_state_change_collection(StateChangeCollection* collection) {
+    exec_engine_.set_state_change_collection(collection);
+}
+
 bool Server::stop() {
     io_context_.stop();
     return ActiveComponent::stop();
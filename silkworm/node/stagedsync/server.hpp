@@ -61,6 +61,9 @@ class Server : public ActiveComponent {
 
     asio::io_context& get_executor() { return io_context_; }
 
+    //! Set the collection notified of state changes at each fork choice commit, must be called before running
+    void set_state_change_collection(StateChangeCollection* collection);
+
   private:
     void execution_loop() override;
     bool stop() override;
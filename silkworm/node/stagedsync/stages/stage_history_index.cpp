@@ -253,9 +253,10 @@ Stage::Result HistoryIndex::forward_impl(db::RWTxn& txn, const BlockNum from, co
     collect_bitmaps_from_changeset(txn, source_config, from, to, storage);
 
     if (!collector_->empty()) {
+        ThreadPool merge_workers;
         log_lck.lock();
         loading_ = true;
-        index_loader_ = std::make_unique<db::bitmap::IndexLoader>(target_config);
+        index_loader_ = std::make_unique<db::bitmap::IndexLoader>(target_config, &merge_workers);
         log_lck.unlock();
         index_loader_->merge_bitmaps(txn, target_key_size, collector_.get());
 
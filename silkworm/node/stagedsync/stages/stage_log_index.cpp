@@ -268,11 +268,12 @@ void LogIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum
     // Into etl collectors
     collect_bitmaps_from_logs(txn, source_config, from, to);
 
+    ThreadPool merge_workers;
     log_lck.lock();
     loading_ = true;
     current_key_.clear();
     current_target_ = db::table::kLogAddressIndex.name;
-    index_loader_ = std::make_unique<db::bitmap::IndexLoader>(db::table::kLogAddressIndex);
+    index_loader_ = std::make_unique<db::bitmap::IndexLoader>(db::table::kLogAddressIndex, &merge_workers);
     log_lck.unlock();
 
     index_loader_->merge_bitmaps32(txn, kAddressLength, addresses_collector_.get());
@@ -280,7 +281,7 @@ void LogIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum
     log_lck.lock();
     current_key_.clear();
     current_target_ = db::table::kLogTopicIndex.name;
-    index_loader_ = std::make_unique<db::bitmap::IndexLoader>(db::table::kLogTopicIndex);
+    index_loader_ = std::make_unique<db::bitmap::IndexLoader>(db::table::kLogTopicIndex, &merge_workers);
     log_lck.unlock();
 
     index_loader_->merge_bitmaps32(txn, kHashLength, topics_collector_.get());
@@ -282,8 +282,15 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
 
         BlockNum start_block_num{previous_progress + 1u};
 
-        // Create the pool of worker threads crunching the address recovery tasks
-        ThreadPool worker_pool;
+        // Recovery runs on the scheduler shared with the other node subsystems as consensus-critical work, so that
+        // syncing at the tip is neither delayed by background work nor spawns a set of threads per block or fork
+        auto& scheduler{concurrency::shared_scheduler()};
+
+        // Pending recovery tasks use the elliptic curve context, so they must complete before it gets destroyed
+        [[maybe_unused]] auto _pending = gsl::finally([&]() {
+            for (auto& result : results_) result.wait();
+            results_.clear();
+        });
 
         // Load block transactions from db and recover tx senders in batches
         uint64_t total_collected_senders{0};
@@ -316,14 +323,14 @@ Stage::Result Senders::parallel_recover(db::RWTxn& txn) {
             // Process batch in parallel if max size has been reached
             if (batch_->size() >= max_batch_size_) {
                 increment_total_collected_transactions(batch_->size());
-                recover_batch(worker_pool, context);
+                recover_batch(scheduler, context);
             }
         }
 
         // Recover last incomplete batch [likely]
         if (!batch_->empty()) {
             increment_total_collected_transactions(batch_->size());
-            recover_batch(worker_pool, context);
+            recover_batch(scheduler, context);
         }
 
         // Wait for all senders to be recovered and collected in ETL
@@ -412,24 +419,25 @@ Stage::Result Senders::add_to_batch(BlockNum block_num, const Hash& block_hash,
     return is_stopping() ? Stage::Result::kAborted : Stage::Result::kSuccess;
 }
 
-void Senders::recover_batch(ThreadPool& worker_pool, secp256k1_context* context) {
+void Senders::recover_batch(concurrency::WorkStealingScheduler& scheduler, secp256k1_context* context) {
     // Launch parallel senders recovery
     log::Trace(log_prefix_, {"op", "recover_batch", "first", std::to_string(batch_->cbegin()->block_num)});
 
     StopWatch sw;
     const auto start = sw.start();
 
-    // Wait until total unfinished tasks in worker pool falls below 2 * num workers
-    static const auto kMaxUnfinishedTasks{2 * worker_pool.get_thread_count()};
-    while (worker_pool.get_tasks_total() >= kMaxUnfinishedTasks) {
+    // Wait until our unfinished tasks fall below 2 * num workers
+    const auto max_unfinished_tasks{2 * scheduler.num_workers()};
+    while (results_.size() >= max_unfinished_tasks) {
         std::this_thread::sleep_for(1ms);
+        collect_senders();
     }
 
-    // Swap the waiting batch w/ an empty one and submit a new recovery task to the worker pool
+    // Swap the waiting batch w/ an empty one and submit a new recovery task to the scheduler
     std::shared_ptr<std::vector<AddressRecovery>> ready_batch{std::make_shared<std::vector<AddressRecovery>>()};
     ready_batch->reserve(max_batch_size_);
     ready_batch.swap(batch_);
-    auto batch_result = worker_pool.submit([=]() {
+    auto batch_result = scheduler.submit(concurrency::TaskPriority::kConsensus, [=]() {
         std::for_each(ready_batch->begin(), ready_batch->end(), [&](auto& package) {
             const auto tx_hash{keccak256(package.rlp)};
             const bool ok = silkworm_recover_address(package.tx_from.bytes, tx_hash.bytes, package.tx_signature, package.odd_y_parity, context);
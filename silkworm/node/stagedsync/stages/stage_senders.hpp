@@ -27,7 +27,7 @@
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
-#include <silkworm/infra/concurrency/thread_pool.hpp>
+#include <silkworm/infra/concurrency/work_stealing_scheduler.hpp>
 #include <silkworm/node/etl/collector.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
@@ -59,7 +59,7 @@ class Senders final : public Stage {
     Stage::Result parallel_recover(db::RWTxn& txn);
 
     Stage::Result add_to_batch(BlockNum block_num, const Hash& block_hash, std::vector<Transaction>&& transactions);
-    void recover_batch(ThreadPool& worker_pool, secp256k1_context* context);
+    void recover_batch(concurrency::WorkStealingScheduler& scheduler, secp256k1_context* context);
     void collect_senders();
     void collect_senders(std::shared_ptr<AddressRecoveryBatch>& batch);
     void store_senders(db::RWTxn& txn);
@@ -92,7 +92,7 @@ Task<void> DirectService::messages(
     // loop until a cancelled exception
     while (true) {
         auto message = co_await channel->receive();
-        co_await consumer(std::move(message));
+        co_await consumer(*message);
     }
 }
 
@@ -34,7 +34,8 @@ namespace silkworm::sentry::api::router {
 
 class MessagesCall final {
   public:
-    using TResult = std::shared_ptr<concurrency::Channel<MessageFromPeer>>;
+    // messages are shared among all the subscribers receiving them
+    using TResult = std::shared_ptr<concurrency::Channel<std::shared_ptr<const MessageFromPeer>>>;
 
     MessagesCall(
         MessageIdSet message_id_filter,
@@ -68,7 +68,7 @@ std::list<T*> random_list_items(std::list<T>& l, size_t max_count) {
 }
 
 template <typename T>
-std::vector<T> random_vector_items(std::vector<T>& l, size_t max_count) {
+std::vector<T> random_vector_items(const std::vector<T>& l, size_t max_count) {
     std::vector<T> out;
     std::default_random_engine random_engine{std::random_device{}()};
     std::sample(l.begin(), l.end(), std::back_inserter(out), max_count, random_engine);
@@ -16,6 +16,8 @@
 
 #include "socket_stream.hpp"
 
+#include <array>
+
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/use_awaitable.hpp>
@@ -31,6 +33,11 @@ Task<void> SocketStream::send(Bytes data) {
     co_await async_write(socket_, buffer(data), use_awaitable);
 }
 
+Task<void> SocketStream::send(ByteView data1, ByteView data2) {
+    const std::array<const_buffer, 2> buffers{buffer(data1.data(), data1.size()), buffer(data2.data(), data2.size())};
+    co_await async_write(socket_, buffers, use_awaitable);
+}
+
 Task<uint16_t> SocketStream::receive_short() {
     Bytes data = co_await receive_fixed(sizeof(uint16_t));
     uint16_t value = endian::load_big_u16(data.data());
@@ -43,6 +50,12 @@ Task<Bytes> SocketStream::receive_fixed(std::size_t size) {
     co_return std::move(data);
 }
 
+Task<ByteView> SocketStream::receive_fixed(Bytes& raw_data, std::size_t size) {
+    raw_data.resize(size);
+    co_await async_read(socket_, buffer(raw_data), use_awaitable);
+    co_return ByteView(raw_data);
+}
+
 Task<ByteView> SocketStream::receive_size_and_data(Bytes& raw_data) {
     raw_data.resize(sizeof(uint16_t));
     co_await async_read(socket_, buffer(raw_data), use_awaitable);
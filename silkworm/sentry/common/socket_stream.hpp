@@ -37,9 +37,13 @@ class SocketStream {
     [[nodiscard]] const boost::asio::ip::tcp::socket& socket() const { return socket_; }
 
     Task<void> send(Bytes data);
+    //! Send both buffers one after the other with a single gather write
+    Task<void> send(ByteView data1, ByteView data2);
 
     Task<uint16_t> receive_short();
     Task<Bytes> receive_fixed(std::size_t size);
+    //! Receive into the given buffer reusing its capacity
+    Task<ByteView> receive_fixed(Bytes& raw_data, std::size_t size);
     Task<ByteView> receive_size_and_data(Bytes& raw_data);
 
   private:
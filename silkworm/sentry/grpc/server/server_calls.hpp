@@ -205,9 +205,9 @@ class MessagesCall : public sw_rpc::server::ServerStreamingCall<proto::MessagesR
         while (write_ok) {
             auto message = co_await messages_channel->receive();
 
-            proto::InboundMessage reply = interfaces::inbound_message_from_message(message.message);
-            if (message.peer_public_key) {
-                reply.mutable_peer_id()->CopyFrom(interfaces::peer_id_from_public_key(message.peer_public_key.value()));
+            proto::InboundMessage reply = interfaces::inbound_message_from_message(message->message);
+            if (message->peer_public_key) {
+                reply.mutable_peer_id()->CopyFrom(interfaces::peer_id_from_public_key(message->peer_public_key.value()));
             }
 
             write_ok = co_await agrpc::write(responder_, reply);
@@ -28,6 +28,8 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
 #include <silkworm/infra/concurrency/co_spawn_sw.hpp>
+#include <silkworm/sentry/eth/message_id.hpp>
+#include <silkworm/sentry/eth/status_message.hpp>
 
 namespace silkworm::sentry {
 
@@ -52,13 +54,14 @@ Task<void> MessageReceiver::handle_calls() {
     while (true) {
         auto call = co_await message_calls_channel_.receive();
 
-        auto messages_channel = std::make_shared<concurrency::Channel<api::MessageFromPeer>>(executor);
+        auto messages_channel = std::make_shared<MessagesChannel>(executor, kMessagesChannelBufferSize);
 
         subscriptions_.push_back({
             messages_channel,
             call.message_id_filter(),
             call.unsubscribe_signal(),
         });
+        update_dispatch_table();
 
         unsubscription_tasks_.spawn(executor, unsubscribe_on_signal(call.unsubscribe_signal()));
 
@@ -87,6 +90,38 @@ Task<void> MessageReceiver::unsubscribe_on_signal(std::shared_ptr<concurrency::E
     if (subscription != subscriptions_.end()) {
         subscription->messages_channel->close();
         subscriptions_.erase(subscription);
+        update_dispatch_table();
+    }
+}
+
+void MessageReceiver::update_dispatch_table() {
+    for (auto& messages_channels : dispatch_table_) {
+        messages_channels.clear();
+    }
+    for (auto& subscription : subscriptions_) {
+        if (subscription.message_id_filter.empty()) {
+            for (auto& messages_channels : dispatch_table_) {
+                messages_channels.push_back(subscription.messages_channel);
+            }
+        } else {
+            for (auto message_id : subscription.message_id_filter) {
+                dispatch_table_[message_id].push_back(subscription.messages_channel);
+            }
+        }
+    }
+}
+
+bool MessageReceiver::is_gossip_message(uint8_t message_id) {
+    if (message_id < eth::StatusMessage::kId) return false;
+
+    switch (eth::eth_message_id_from_common_id(message_id)) {
+        case eth::MessageId::kNewBlockHashes:
+        case eth::MessageId::kTransactions:
+        case eth::MessageId::kNewBlock:
+        case eth::MessageId::kNewPooledTransactionHashes:
+            return true;
+        default:
+            return false;
     }
 }
 
@@ -100,27 +135,36 @@ Task<void> MessageReceiver::receive_messages(std::shared_ptr<rlpx::Peer> peer) {
             break;
         }
 
-        api::MessageFromPeer message_from_peer{
+        auto message_from_peer = std::make_shared<const api::MessageFromPeer>(api::MessageFromPeer{
             std::move(message),
             {peer->peer_public_key()},
-        };
+        });
+        co_await dispatch_message(std::move(message_from_peer));
+    }
+}
 
-        std::list<std::shared_ptr<concurrency::Channel<api::MessageFromPeer>>> messages_channels;
-        for (auto& subscription : subscriptions_) {
-            if (subscription.message_id_filter.empty() || subscription.message_id_filter.contains(message_from_peer.message.id)) {
-                messages_channels.push_back(subscription.messages_channel);
+Task<void> MessageReceiver::dispatch_message(std::shared_ptr<const api::MessageFromPeer> message_from_peer) {
+    // copy the channels because the dispatch table may change while sending
+    const auto messages_channels = dispatch_table_[message_from_peer->message.id];
+    const bool is_gossip = is_gossip_message(message_from_peer->message.id);
+
+    for (auto& messages_channel : messages_channels) {
+        // gossip is not worth waiting for a slow subscriber, it's dropped if its buffer is full
+        if (is_gossip) {
+            if (!messages_channel->try_send(message_from_peer)) {
+                ++dropped_gossip_count_;
+                log::Trace("sentry") << "MessageReceiver::dispatch_message dropped gossip message"
+                                     << " id=" << static_cast<int>(message_from_peer->message.id);
             }
+            continue;
         }
-
-        for (auto& messages_channel : messages_channels) {
-            try {
-                co_await messages_channel->send(message_from_peer);
-            } catch (const boost::system::system_error& ex) {
-                if (ex.code() == experimental::error::channel_closed) {
-                    continue;
-                }
-                throw;
+        try {
+            co_await messages_channel->send(message_from_peer);
+        } catch (const boost::system::system_error& ex) {
+            if (ex.code() == experimental::error::channel_closed) {
+                continue;
             }
+            throw;
         }
     }
 }
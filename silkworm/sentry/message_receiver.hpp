@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
@@ -52,6 +56,28 @@ class MessageReceiver : public PeerManagerObserver {
 
     static Task<void> run(std::shared_ptr<MessageReceiver> self, PeerManager& peer_manager);
 
+    //! The number of gossip messages dropped because the buffer of a subscriber was full
+    [[nodiscard]] uint64_t dropped_gossip_count() const { return dropped_gossip_count_; }
+
+  protected:
+    using MessagesChannel = concurrency::Channel<std::shared_ptr<const api::MessageFromPeer>>;
+
+    struct Subscription {
+        std::shared_ptr<MessagesChannel> messages_channel;
+        api::MessageIdSet message_id_filter;
+        std::shared_ptr<concurrency::EventNotifier> unsubscribe_signal;
+    };
+
+    void update_dispatch_table();
+    static bool is_gossip_message(uint8_t message_id);
+    Task<void> dispatch_message(std::shared_ptr<const api::MessageFromPeer> message_from_peer);
+
+    std::list<Subscription> subscriptions_;
+
+    //! The channels of the subscribers interested in each message ID, rebuilt at each (un)subscription
+    static constexpr size_t kMessageIdCount = 256;
+    std::array<std::vector<std::shared_ptr<MessagesChannel>>, kMessageIdCount> dispatch_table_;
+
   private:
     Task<void> handle_calls();
     Task<void> unsubscribe_on_signal(std::shared_ptr<concurrency::EventNotifier> unsubscribe_signal);
@@ -63,18 +89,14 @@ class MessageReceiver : public PeerManagerObserver {
     void on_peer_connect_error(const EnodeUrl& peer_url) override;
     Task<void> on_peer_added_in_strand(std::shared_ptr<rlpx::Peer> peer);
 
+    //! The number of messages buffered for each subscriber, when full gossip messages are dropped
+    static constexpr size_t kMessagesChannelBufferSize = 1000;
+
     concurrency::Channel<api::router::MessagesCall> message_calls_channel_;
     boost::asio::strand<boost::asio::any_io_executor> strand_;
     concurrency::TaskGroup peer_tasks_;
     concurrency::TaskGroup unsubscription_tasks_;
-
-    struct Subscription {
-        std::shared_ptr<concurrency::Channel<api::MessageFromPeer>> messages_channel;
-        api::MessageIdSet message_id_filter;
-        std::shared_ptr<concurrency::EventNotifier> unsubscribe_signal;
-    };
-
-    std::list<Subscription> subscriptions_;
+    std::atomic_uint64_t dropped_gossip_count_{0};
 };
 
 }  // namespace silkworm::sentry
@@ -0,0 +1,147 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "message_receiver.hpp"
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/test_util/task_runner.hpp>
+#include <silkworm/sentry/eth/message_id.hpp>
+
+namespace silkworm::sentry {
+
+using eth::common_message_id_from_eth_id;
+using eth::MessageId;
+
+class MessageReceiver_ForTest : public MessageReceiver {
+  public:
+    explicit MessageReceiver_ForTest(const boost::asio::any_io_executor& executor)
+        : MessageReceiver{executor, /* max_peers = */ 1}, executor_{executor} {}
+
+    std::shared_ptr<MessagesChannel> subscribe(api::MessageIdSet message_id_filter, size_t buffer_size = 10) {
+        auto messages_channel = std::make_shared<MessagesChannel>(executor_, buffer_size);
+        subscriptions_.push_back({
+            messages_channel,
+            std::move(message_id_filter),
+            std::make_shared<concurrency::EventNotifier>(executor_),
+        });
+        update_dispatch_table();
+        return messages_channel;
+    }
+
+    void unsubscribe_first() {
+        subscriptions_.pop_front();
+        update_dispatch_table();
+    }
+
+    size_t subscriber_count(MessageId id) const {
+        return dispatch_table_[common_message_id_from_eth_id(id)].size();
+    }
+
+    static bool is_gossip(MessageId id) {
+        return is_gossip_message(common_message_id_from_eth_id(id));
+    }
+
+    Task<void> dispatch(MessageId id) {
+        return dispatch_message(std::make_shared<const api::MessageFromPeer>(api::MessageFromPeer{
+            Message{common_message_id_from_eth_id(id), {}},
+            std::nullopt,
+        }));
+    }
+
+  private:
+    boost::asio::any_io_executor executor_;
+};
+
+TEST_CASE("MessageReceiver.is_gossip_message") {
+    CHECK(MessageReceiver_ForTest::is_gossip(MessageId::kNewBlockHashes));
+    CHECK(MessageReceiver_ForTest::is_gossip(MessageId::kTransactions));
+    CHECK(MessageReceiver_ForTest::is_gossip(MessageId::kNewBlock));
+    CHECK(MessageReceiver_ForTest::is_gossip(MessageId::kNewPooledTransactionHashes));
+
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kStatus));
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kGetBlockHeaders));
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kBlockHeaders));
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kBlockBodies));
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kPooledTransactions));
+    CHECK_FALSE(MessageReceiver_ForTest::is_gossip(MessageId::kReceipts));
+}
+
+TEST_CASE("MessageReceiver.update_dispatch_table") {
+    test_util::TaskRunner runner;
+    MessageReceiver_ForTest receiver{runner.executor()};
+
+    auto headers_channel = receiver.subscribe({common_message_id_from_eth_id(MessageId::kBlockHeaders)});
+    auto all_channel = receiver.subscribe({});
+
+    CHECK(receiver.subscriber_count(MessageId::kBlockHeaders) == 2);
+    CHECK(receiver.subscriber_count(MessageId::kNewBlock) == 1);
+
+    // each message goes only to the subscribers interested in its ID
+    runner.run(receiver.dispatch(MessageId::kBlockHeaders));
+    runner.run(receiver.dispatch(MessageId::kNewBlock));
+
+    auto headers_message = headers_channel->try_receive();
+    REQUIRE(headers_message);
+    CHECK((*headers_message)->message.id == common_message_id_from_eth_id(MessageId::kBlockHeaders));
+    CHECK_FALSE(headers_channel->try_receive());
+
+    auto first_message = all_channel->try_receive();
+    REQUIRE(first_message);
+    CHECK((*first_message)->message.id == common_message_id_from_eth_id(MessageId::kBlockHeaders));
+    auto second_message = all_channel->try_receive();
+    REQUIRE(second_message);
+    CHECK((*second_message)->message.id == common_message_id_from_eth_id(MessageId::kNewBlock));
+
+    // the table is rebuilt without the unsubscribed channel
+    receiver.unsubscribe_first();
+    CHECK(receiver.subscriber_count(MessageId::kBlockHeaders) == 1);
+    CHECK(receiver.subscriber_count(MessageId::kNewBlock) == 1);
+}
+
+TEST_CASE("MessageReceiver.gossip_dropped_when_full") {
+    test_util::TaskRunner runner;
+    MessageReceiver_ForTest receiver{runner.executor()};
+
+    auto slow_channel = receiver.subscribe({}, /* buffer_size = */ 1);
+    auto fast_channel = receiver.subscribe({}, /* buffer_size = */ 10);
+
+    runner.run(receiver.dispatch(MessageId::kNewBlockHashes));
+    runner.run(receiver.dispatch(MessageId::kTransactions));
+    runner.run(receiver.dispatch(MessageId::kNewBlock));
+
+    // the slow subscriber keeps the first message only, the other subscriber is not held back
+    CHECK(receiver.dropped_gossip_count() == 2);
+    CHECK(slow_channel->try_receive());
+    CHECK_FALSE(slow_channel->try_receive());
+    for (int i = 0; i < 3; i++) {
+        CHECK(fast_channel->try_receive());
+    }
+    CHECK_FALSE(fast_channel->try_receive());
+
+    // a non-gossip message is sent to every subscriber and never counted as dropped
+    runner.run(receiver.dispatch(MessageId::kBlockHeaders));
+    CHECK(receiver.dropped_gossip_count() == 2);
+    auto headers_message = slow_channel->try_receive();
+    REQUIRE(headers_message);
+    CHECK((*headers_message)->message.id == common_message_id_from_eth_id(MessageId::kBlockHeaders));
+}
+
+}  // namespace silkworm::sentry
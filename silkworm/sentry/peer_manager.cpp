@@ -16,6 +16,8 @@
 
 #include "peer_manager.hpp"
 
+#include <algorithm>
+
 #include <boost/system/errc.hpp>
 #include <boost/system/system_error.hpp>
 #include <gsl/util>
@@ -67,6 +69,19 @@ Task<void> PeerManager::run_in_strand(concurrency::Channel<std::shared_ptr<rlpx:
             continue;
         }
 
+        // do not let a connection storm compete with the established peers: drop before any handshake crypto
+        if (peer->is_inbound()) {
+            auto is_inbound = [](const std::shared_ptr<rlpx::Peer>& p) { return p->is_inbound(); };
+            auto inbound_handshakes_count = static_cast<size_t>(
+                std::count_if(handshaking_peers_.begin(), handshaking_peers_.end(), is_inbound));
+            if (inbound_handshakes_count >= max_inbound_handshakes_) {
+                auto rejected_count = ++rejected_inbound_peers_count_;
+                log::Debug("sentry") << "PeerManager::run_in_strand too many inbound handshakes in progress, dropping a peer"
+                                     << " [total rejected: " << rejected_count << "]";
+                continue;
+            }
+        }
+
         handshaking_peers_.push_back(peer);
         peer_tasks_.spawn(strand_, run_peer(peer));
     }
@@ -89,6 +104,7 @@ Task<void> PeerManager::run_peer(std::shared_ptr<rlpx::Peer> peer) {
 
     handshaking_peers_.remove(peer);
     if (peers_.remove(peer)) {
+        update_peers_snapshot();
         on_peer_removed(peer);
     }
 
@@ -99,6 +115,7 @@ Task<void> PeerManager::wait_for_peer_handshake(std::shared_ptr<rlpx::Peer> peer
     bool ok = co_await rlpx::Peer::wait_for_handshake(peer);
     if (handshaking_peers_.remove(peer) && ok) {
         peers_.push_back(peer);
+        update_peers_snapshot();
         on_peer_added(peer);
     }
 }
@@ -122,33 +139,33 @@ Task<void> PeerManager::drop_peer(
 }
 
 Task<size_t> PeerManager::count_peers() {
-    co_return (co_await concurrency::co_spawn_sw(strand_, count_peers_in_strand(), use_awaitable));
+    co_return peers_snapshot()->size();
 }
 
 Task<void> PeerManager::enumerate_peers(EnumeratePeersCallback callback) {
-    co_await concurrency::co_spawn_sw(strand_, enumerate_peers_in_strand(callback), use_awaitable);
+    auto peers = peers_snapshot();
+    for (auto& peer : *peers) {
+        callback(peer);
+    }
+    co_return;
 }
 
 Task<void> PeerManager::enumerate_random_peers(size_t max_count, EnumeratePeersCallback callback) {
-    co_await concurrency::co_spawn_sw(strand_, enumerate_random_peers_in_strand(max_count, callback), use_awaitable);
-}
-
-Task<size_t> PeerManager::count_peers_in_strand() {
-    co_return peers_.size();
-}
-
-Task<void> PeerManager::enumerate_peers_in_strand(EnumeratePeersCallback callback) {
-    for (auto& peer : peers_) {
+    for (auto& peer : random_vector_items(*peers_snapshot(), max_count)) {
         callback(peer);
     }
     co_return;
 }
 
-Task<void> PeerManager::enumerate_random_peers_in_strand(size_t max_count, EnumeratePeersCallback callback) {
-    for (auto peer_ptr : random_list_items(peers_, max_count)) {
-        callback(*peer_ptr);
-    }
-    co_return;
+std::shared_ptr<const PeerManager::PeersSnapshot> PeerManager::peers_snapshot() {
+    std::scoped_lock lock(peers_snapshot_mutex_);
+    return peers_snapshot_;
+}
+
+void PeerManager::update_peers_snapshot() {
+    auto snapshot = std::make_shared<const PeersSnapshot>(peers_.begin(), peers_.end());
+    std::scoped_lock lock(peers_snapshot_mutex_);
+    peers_snapshot_ = std::move(snapshot);
 }
 
 void PeerManager::add_observer(std::weak_ptr<PeerManagerObserver> observer) {
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <memory>
@@ -50,8 +52,10 @@ class PeerManager {
     PeerManager(
         const boost::asio::any_io_executor& executor,
         size_t max_peers,
+        size_t max_inbound_handshakes,
         concurrency::ExecutorPool& executor_pool)
         : max_peers_(max_peers),
+          max_inbound_handshakes_(max_inbound_handshakes),
           strand_(boost::asio::make_strand(executor)),
           peer_tasks_(strand_, max_peers),
           drop_peer_tasks_(strand_, PeerManager::kMaxSimultaneousDropPeerTasks),
@@ -74,6 +78,9 @@ class PeerManager {
 
     void add_observer(std::weak_ptr<PeerManagerObserver> observer);
 
+    //! The number of inbound peers dropped before the handshake because too many inbound handshakes were in progress
+    [[nodiscard]] uint64_t rejected_inbound_peers_count() const { return rejected_inbound_peers_count_; }
+
   private:
     Task<void> run_in_strand(concurrency::Channel<std::shared_ptr<rlpx::Peer>>& peer_channel);
     Task<void> run_peer(std::shared_ptr<rlpx::Peer> peer);
@@ -84,9 +91,9 @@ class PeerManager {
 
     static constexpr size_t kMaxSimultaneousDropPeerTasks = 10;
 
-    Task<size_t> count_peers_in_strand();
-    Task<void> enumerate_peers_in_strand(EnumeratePeersCallback callback);
-    Task<void> enumerate_random_peers_in_strand(size_t max_count, EnumeratePeersCallback callback);
+    using PeersSnapshot = std::vector<std::shared_ptr<rlpx::Peer>>;
+    [[nodiscard]] std::shared_ptr<const PeersSnapshot> peers_snapshot();
+    void update_peers_snapshot();
 
     [[nodiscard]] std::list<std::shared_ptr<PeerManagerObserver>> observers();
     void on_peer_added(const std::shared_ptr<rlpx::Peer>& peer);
@@ -105,7 +112,9 @@ class PeerManager {
 
     std::list<std::shared_ptr<rlpx::Peer>> peers_;
     std::list<std::shared_ptr<rlpx::Peer>> handshaking_peers_;
+    std::atomic_uint64_t rejected_inbound_peers_count_{0};
     size_t max_peers_;
+    size_t max_inbound_handshakes_;
     boost::asio::strand<boost::asio::any_io_executor> strand_;
     concurrency::TaskGroup peer_tasks_;
     concurrency::TaskGroup drop_peer_tasks_;
@@ -119,6 +128,10 @@ class PeerManager {
 
     std::list<std::weak_ptr<PeerManagerObserver>> observers_;
     std::mutex observers_mutex_;
+
+    //! An immutable copy of peers_ republished by the strand on each change, readers just grab the current one
+    std::shared_ptr<const PeersSnapshot> peers_snapshot_{std::make_shared<const PeersSnapshot>()};
+    std::mutex peers_snapshot_mutex_;
 };
 
 }  // namespace silkworm::sentry
@@ -105,6 +105,29 @@ Bytes AESCipher::decrypt(ByteView cipher_text) {
     return plain_text;
 }
 
+void AESCipher::encrypt_in_place(std::span<uint8_t> data) {
+    if (data.size() % kAESBlockSize)
+        throw std::runtime_error("AESCipher: plain_text is not padded");
+
+    int cipher_text_len = 0;
+    EVP_EncryptUpdate(
+        ctx_,
+        data.data(),
+        &cipher_text_len,
+        data.data(),
+        static_cast<int>(data.size()));
+}
+
+void AESCipher::decrypt_in_place(std::span<uint8_t> data) {
+    int plain_text_len = 0;
+    EVP_DecryptUpdate(
+        ctx_,
+        data.data(),
+        &plain_text_len,
+        data.data(),
+        static_cast<int>(data.size()));
+}
+
 Bytes aes_encrypt(ByteView plain_text, ByteView key, ByteView iv) {
     AESCipher cipher{key, {iv}, AESCipher::Direction::kEncrypt};
     return cipher.encrypt(plain_text);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include <gsl/pointers>
 
@@ -40,6 +41,10 @@ class AESCipher final {
     Bytes encrypt(ByteView plain_text);
     Bytes decrypt(ByteView cipher_text);
 
+    // in-place variants avoiding an output buffer allocation
+    void encrypt_in_place(std::span<uint8_t> data);
+    void decrypt_in_place(std::span<uint8_t> data);
+
   private:
     gsl::owner<EVP_CIPHER_CTX*> ctx_;
 };
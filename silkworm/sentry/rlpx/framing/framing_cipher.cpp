@@ -16,6 +16,9 @@
 
 #include "framing_cipher.hpp"
 
+#include <algorithm>
+#include <array>
+#include <span>
 #include <stdexcept>
 
 #include <silkworm/core/common/endian.hpp>
@@ -35,9 +38,9 @@ class FramingCipherImpl {
   public:
     FramingCipherImpl(const KeyMaterial& key_material, Bytes aes_secret, Bytes mac_secret);
 
-    [[nodiscard]] Bytes encrypt_frame(Bytes frame_data);
+    void encrypt_frame(Bytes& frame_data, std::span<uint8_t, FramingCipher::kHeaderSize> header);
     [[nodiscard]] size_t decrypt_header(ByteView header_cipher_text, ByteView header_mac);
-    [[nodiscard]] Bytes decrypt_frame(ByteView frame_cipher_text, ByteView frame_mac, size_t frame_size);
+    [[nodiscard]] ByteView decrypt_frame(std::span<uint8_t> data, size_t frame_size);
 
   private:
     static void init_mac_hashers(
@@ -145,34 +148,27 @@ size_t FramingCipherImpl::deserialize_frame_size(ByteView data) {
     return endian::load_big_u32(data1.data());
 }
 
-Bytes FramingCipherImpl::encrypt_frame(Bytes frame_data) {
-    Bytes header_data;
-    rlp::encode(header_data, 0u, 0u);
+void FramingCipherImpl::encrypt_frame(Bytes& frame_data, std::span<uint8_t, FramingCipher::kHeaderSize> header) {
+    assert(header.size() == kAESBlockSize * 2);
 
-    Bytes header;
-    header.reserve(kAESBlockSize);
-    header += serialize_frame_size(frame_data.size());
-    header += header_data;
-
-    header.resize(kAESBlockSize, 0);
-    Bytes header_cipher_text = egress_data_cipher_.encrypt(header);
-    Bytes header_mac = this->header_mac(egress_mac_hasher_, header_cipher_text);
-
-    frame_data.resize(aes_round_up_to_block_size(frame_data.size()), 0);
-    Bytes frame_cipher_text = egress_data_cipher_.encrypt(frame_data);
-    Bytes frame_mac = this->frame_mac(egress_mac_hasher_, frame_cipher_text);
-
-    Bytes data;
-    data.reserve(
-        header_cipher_text.size() +
-        header_mac.size() +
-        frame_cipher_text.size() +
-        frame_mac.size());
-    data.append(header_cipher_text);
-    data.append(header_mac);
-    data.append(frame_cipher_text);
-    data.append(frame_mac);
-    return data;
+    Bytes header_data = serialize_frame_size(frame_data.size());
+    rlp::encode(header_data, 0u, 0u);
+    assert(header_data.size() <= kAESBlockSize);
+
+    // header cipher text followed by header MAC
+    std::span<uint8_t> header_cipher_text = header.first(kAESBlockSize);
+    std::fill(std::copy(header_data.cbegin(), header_data.cend(), header_cipher_text.begin()), header_cipher_text.end(), 0);
+    egress_data_cipher_.encrypt_in_place(header_cipher_text);
+    const Bytes header_mac = this->header_mac(egress_mac_hasher_, ByteView{header_cipher_text.data(), header_cipher_text.size()});
+    std::copy(header_mac.cbegin(), header_mac.cend(), header.begin() + kAESBlockSize);
+
+    // frame cipher text followed by frame MAC
+    const size_t padded_frame_size = aes_round_up_to_block_size(frame_data.size());
+    frame_data.reserve(padded_frame_size + kAESBlockSize);
+    frame_data.resize(padded_frame_size, 0);
+    std::span<uint8_t> frame_cipher_text{frame_data.data(), padded_frame_size};
+    egress_data_cipher_.encrypt_in_place(frame_cipher_text);
+    frame_data += this->frame_mac(egress_mac_hasher_, ByteView{frame_cipher_text.data(), frame_cipher_text.size()});
 }
 
 size_t FramingCipherImpl::decrypt_header(ByteView header_cipher_text, ByteView header_mac) {
@@ -184,16 +180,20 @@ size_t FramingCipherImpl::decrypt_header(ByteView header_cipher_text, ByteView h
     return deserialize_frame_size(header);
 }
 
-Bytes FramingCipherImpl::decrypt_frame(ByteView frame_cipher_text, ByteView frame_mac, size_t frame_size) {
-    assert(frame_cipher_text.size() >= frame_size);
+ByteView FramingCipherImpl::decrypt_frame(std::span<uint8_t> data, size_t frame_size) {
+    const size_t frame_cipher_text_size = data.size() - kAESBlockSize;
+    assert(frame_cipher_text_size >= frame_size);
+
+    ByteView frame_cipher_text{data.data(), frame_cipher_text_size};
+    ByteView frame_mac{data.data() + frame_cipher_text_size, kAESBlockSize};
 
     Bytes expected_frame_mac = this->frame_mac(ingress_mac_hasher_, frame_cipher_text);
     if (frame_mac != expected_frame_mac)
         throw std::runtime_error("rlpx::framing::FramingCipher: invalid frame MAC");
 
-    Bytes frame_data = ingress_data_cipher_.decrypt(frame_cipher_text);
-    frame_data.resize(frame_size);
-    return frame_data;
+    // decrypt the received buffer in place and reuse it for the frame data
+    ingress_data_cipher_.decrypt_in_place(data.first(frame_cipher_text_size));
+    return ByteView{data.data(), frame_size};
 }
 
 FramingCipher::FramingCipher(const KeyMaterial& key_material) {
@@ -214,13 +214,20 @@ FramingCipher& FramingCipher::operator=(FramingCipher&& other) noexcept {
     return *this;
 }
 
-Bytes FramingCipher::encrypt_frame(Bytes frame_data) {
-    return impl_->encrypt_frame(std::move(frame_data));
+Bytes FramingCipher::encrypt_frame(ByteView frame_data) {
+    Bytes frame{frame_data};
+    std::array<uint8_t, kHeaderSize> header{};
+    impl_->encrypt_frame(frame, header);
+    frame.insert(frame.begin(), header.cbegin(), header.cend());
+    return frame;
+}
+
+void FramingCipher::encrypt_frame_in_place(Bytes& frame_data, std::span<uint8_t, kHeaderSize> header) {
+    impl_->encrypt_frame(frame_data, header);
 }
 
 size_t FramingCipher::header_size() {
-    // cipher text and MAC
-    return kAESBlockSize * 2;
+    return kHeaderSize;
 }
 
 size_t FramingCipher::decrypt_header(ByteView data) {
@@ -236,13 +243,15 @@ size_t FramingCipher::frame_size(size_t header_frame_size) {
     return aes_round_up_to_block_size(header_frame_size) + kAESBlockSize;
 }
 
-Bytes FramingCipher::decrypt_frame(ByteView data, size_t header_frame_size) {
+Bytes FramingCipher::decrypt_frame(Bytes data, size_t header_frame_size) {
+    data.resize(decrypt_frame_in_place(data, header_frame_size).size());
+    return data;
+}
+
+ByteView FramingCipher::decrypt_frame_in_place(std::span<uint8_t> data, size_t header_frame_size) {
     if (data.size() < FramingCipher::frame_size(header_frame_size))
         throw std::runtime_error("rlpx::framing::FramingCipher: frame size data is too short");
-    return impl_->decrypt_frame(
-        ByteView{data.data(), data.size() - kAESBlockSize},
-        ByteView{data.data() + data.size() - kAESBlockSize, kAESBlockSize},
-        header_frame_size);
+    return impl_->decrypt_frame(data, header_frame_size);
 }
 
 }  // namespace silkworm::sentry::rlpx::framing
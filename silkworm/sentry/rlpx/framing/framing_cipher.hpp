@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/core/common/bytes.hpp>
@@ -42,12 +43,19 @@ class FramingCipher final {
     FramingCipher(FramingCipher&&) noexcept;
     FramingCipher& operator=(FramingCipher&&) noexcept;
 
-    [[nodiscard]] Bytes encrypt_frame(Bytes frame_data);
+    //! Header cipher text and MAC
+    static constexpr size_t kHeaderSize = 32;
+
+    [[nodiscard]] Bytes encrypt_frame(ByteView frame_data);
+    //! Encrypt the frame data in place appending its MAC, the header to be sent before goes into the given buffer
+    void encrypt_frame_in_place(Bytes& frame_data, std::span<uint8_t, kHeaderSize> header);
 
     [[nodiscard]] static size_t header_size();
     [[nodiscard]] size_t decrypt_header(ByteView data);
     [[nodiscard]] static size_t frame_size(size_t header_frame_size);
-    [[nodiscard]] Bytes decrypt_frame(ByteView data, size_t header_frame_size);
+    [[nodiscard]] Bytes decrypt_frame(Bytes data, size_t header_frame_size);
+    //! Decrypt the received frame in place, the frame data is a view on the first bytes of the buffer
+    [[nodiscard]] ByteView decrypt_frame_in_place(std::span<uint8_t> data, size_t header_frame_size);
 
   private:
     std::unique_ptr<FramingCipherImpl> impl_;
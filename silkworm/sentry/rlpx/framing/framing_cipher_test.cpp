@@ -0,0 +1,125 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "framing_cipher.hpp"
+
+#include <array>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::sentry::rlpx::framing {
+
+class FramingCipherTest {
+  protected:
+    static FramingCipher::KeyMaterial make_key_material(bool is_initiator) {
+        return {
+            .ephemeral_shared_secret = Bytes(32, 1),
+            .is_initiator = is_initiator,
+            .initiator_nonce = Bytes(32, 2),
+            .recipient_nonce = Bytes(32, 3),
+            .initiator_first_message_data = Bytes(100, 4),
+            .recipient_first_message_data = Bytes(90, 5),
+        };
+    }
+
+    FramingCipher initiator{make_key_material(true)};
+    FramingCipher recipient{make_key_material(false)};
+};
+
+// Frames encrypted by the initiator: "hello" and 20 times 0xAB, produced by the implementation allocating
+// separate buffers for the header and frame cipher texts, before encryption in place was introduced
+static const Bytes kHelloFrameData{from_hex("68656c6c6f").value()};
+static const Bytes kHelloFrame{from_hex(
+                                   "ffbb9660832848fc3d23aa1b2dd908b9"   // header
+                                   "8df991df6a9bbf1a9db8584a290bcfba"   // header MAC
+                                   "2a01442c3b37f632e32fdea16c82eb19"   // frame
+                                   "f76bdd0830c6957c13acb3acfafee513")  // frame MAC
+                                   .value()};
+static const Bytes kSecondFrameData(20, 0xAB);
+static const Bytes kSecondFrame{from_hex(
+                                    "f076838520a3069314fdb2b64a417b99"
+                                    "5ee1ef2e3d08f8bb69739c5effed4903"
+                                    "78fb73fe7e9774f69d6cc2ff6f99874a"
+                                    "81a4a8cc4004c16f47592fafd8eed657"
+                                    "90a6328065d93534c4fae22bf339ca21")
+                                    .value()};
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.encrypt_frame_known_answer") {
+    CHECK(initiator.encrypt_frame(kHelloFrameData) == kHelloFrame);
+    CHECK(initiator.encrypt_frame(kSecondFrameData) == kSecondFrame);
+}
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.decrypt_frame_known_answer") {
+    for (const auto& [frame, expected_frame_data] : {std::pair{kHelloFrame, kHelloFrameData},
+                                                     std::pair{kSecondFrame, kSecondFrameData}}) {
+        size_t header_frame_size = recipient.decrypt_header(ByteView{frame.data(), FramingCipher::header_size()});
+        CHECK(header_frame_size == expected_frame_data.size());
+        Bytes frame_data = recipient.decrypt_frame(frame.substr(FramingCipher::header_size()), header_frame_size);
+        CHECK(frame_data == expected_frame_data);
+    }
+}
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.encrypt_frame_in_place_known_answer") {
+    for (const auto& [frame_data, expected_frame] : {std::pair{kHelloFrameData, kHelloFrame},
+                                                     std::pair{kSecondFrameData, kSecondFrame}}) {
+        Bytes data{frame_data};
+        std::array<uint8_t, FramingCipher::kHeaderSize> header{};
+        initiator.encrypt_frame_in_place(data, header);
+        CHECK(Bytes{header.data(), header.size()} + data == expected_frame);
+    }
+}
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.decrypt_frame_in_place_known_answer") {
+    // the same buffer receives both frames, as the message stream does
+    Bytes buffer;
+    for (const auto& [frame, expected_frame_data] : {std::pair{kHelloFrame, kHelloFrameData},
+                                                     std::pair{kSecondFrame, kSecondFrameData}}) {
+        buffer.assign(frame, 0, FramingCipher::header_size());
+        size_t header_frame_size = recipient.decrypt_header(buffer);
+        buffer.assign(frame, FramingCipher::header_size());
+        ByteView frame_data = recipient.decrypt_frame_in_place(buffer, header_frame_size);
+        CHECK(frame_data == expected_frame_data);
+        CHECK(frame_data.data() == buffer.data());
+    }
+}
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.encrypt_decrypt_frame") {
+    // several frames in sequence to check that the egress and ingress cipher and MAC states stay in sync
+    for (size_t frame_size : {1u, 16u, 100u, 1024u}) {
+        Bytes expected_frame_data(frame_size, static_cast<uint8_t>(frame_size));
+
+        Bytes data = initiator.encrypt_frame(expected_frame_data);
+        REQUIRE(data.size() == FramingCipher::header_size() + FramingCipher::frame_size(frame_size));
+
+        size_t header_frame_size = recipient.decrypt_header(ByteView{data.data(), FramingCipher::header_size()});
+        CHECK(header_frame_size == frame_size);
+
+        Bytes frame_data = recipient.decrypt_frame(data.substr(FramingCipher::header_size()), header_frame_size);
+        CHECK(frame_data == expected_frame_data);
+    }
+}
+
+TEST_CASE_METHOD(FramingCipherTest, "FramingCipher.decrypt_frame_invalid_mac") {
+    Bytes data = initiator.encrypt_frame(Bytes(32, 7));
+    size_t header_frame_size = recipient.decrypt_header(ByteView{data.data(), FramingCipher::header_size()});
+    data.back() ^= 0xFF;  // corrupt frame MAC
+    CHECK_THROWS(recipient.decrypt_frame(data.substr(FramingCipher::header_size()), header_frame_size));
+}
+
+}  // namespace silkworm::sentry::rlpx::framing
@@ -16,26 +16,32 @@
 
 #include "message_stream.hpp"
 
+#include <array>
 #include <stdexcept>
+#include <utility>
 
 #include "message_frame_codec.hpp"
 
 namespace silkworm::sentry::rlpx::framing {
 
 Task<void> MessageStream::send(Message message) {
-    co_await stream_.send(cipher_.encrypt_frame(message_frame_codec_.encode(message)));
+    // the frame is encrypted in its own buffer because sends may overlap (e.g. ping and pong)
+    Bytes frame_data = message_frame_codec_.encode(message);
+    std::array<uint8_t, FramingCipher::kHeaderSize> header{};
+    cipher_.encrypt_frame_in_place(frame_data, header);
+    co_await stream_.send(ByteView{header.data(), header.size()}, frame_data);
 }
 
 Task<Message> MessageStream::receive() {
-    Bytes header_data = co_await stream_.receive_fixed(FramingCipher::header_size());
+    ByteView header_data = co_await stream_.receive_fixed(receive_buffer_, FramingCipher::header_size());
     size_t header_frame_size = cipher_.decrypt_header(header_data);
 
     size_t frame_size = FramingCipher::frame_size(header_frame_size);
     if (frame_size > MessageFrameCodec::kMaxFrameSize)
         throw std::runtime_error("rlpx::framing::MessageStream: frame is too large");
 
-    Bytes encrypted_frame_data = co_await stream_.receive_fixed(frame_size);
-    Bytes frame_data = cipher_.decrypt_frame(encrypted_frame_data, header_frame_size);
+    co_await stream_.receive_fixed(receive_buffer_, frame_size);
+    ByteView frame_data = cipher_.decrypt_frame_in_place(receive_buffer_, header_frame_size);
 
     co_return message_frame_codec_.decode(frame_data);
 }
@@ -43,6 +43,8 @@ class MessageStream {
     FramingCipher cipher_;
     SocketStream& stream_;
     MessageFrameCodec message_frame_codec_;
+    //! The buffer receiving the frames one after another, it keeps the capacity of the largest frame so far
+    Bytes receive_buffer_;
 };
 
 }  // namespace silkworm::sentry::rlpx::framing
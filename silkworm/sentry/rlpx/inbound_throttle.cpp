@@ -0,0 +1,54 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "inbound_throttle.hpp"
+
+namespace silkworm::sentry::rlpx {
+
+using namespace boost::asio;
+
+InboundThrottle::InboundThrottle(size_t max_attempts_per_ip, Clock::duration window)
+    : max_attempts_per_ip_(max_attempts_per_ip),
+      window_(window) {}
+
+bool InboundThrottle::is_throttled(const ip::address& remote_ip, Clock::time_point now) {
+    expire_attempts(now);
+
+    if (remote_ip.is_loopback()) {
+        return false;
+    }
+
+    // rejected attempts are not counted, so that a throttled IP recovers as soon as its oldest attempt expires
+    const auto ip_attempts = attempts_per_ip_.find(remote_ip);
+    if ((ip_attempts != attempts_per_ip_.end() ? ip_attempts->second : 0) >= max_attempts_per_ip_) {
+        return true;
+    }
+    ++attempts_per_ip_[remote_ip];
+    attempts_.emplace_back(now, remote_ip);
+    return false;
+}
+
+void InboundThrottle::expire_attempts(Clock::time_point now) {
+    while (!attempts_.empty() && (now - attempts_.front().first >= window_)) {
+        auto ip_attempts = attempts_per_ip_.find(attempts_.front().second);
+        if (--ip_attempts->second == 0) {
+            attempts_per_ip_.erase(ip_attempts);
+        }
+        attempts_.pop_front();
+    }
+}
+
+}  // namespace silkworm::sentry::rlpx
@@ -0,0 +1,51 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <utility>
+
+#include <boost/asio/ip/address.hpp>
+
+namespace silkworm::sentry::rlpx {
+
+//! Limits the inbound connection attempts accepted from the same IP address within a sliding time window.
+//! Loopback addresses are never throttled.
+class InboundThrottle {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    InboundThrottle(size_t max_attempts_per_ip, Clock::duration window);
+
+    //! Check if an attempt from remote_ip at the given time exceeds the budget, otherwise count it
+    bool is_throttled(const boost::asio::ip::address& remote_ip, Clock::time_point now = Clock::now());
+
+  private:
+    void expire_attempts(Clock::time_point now);
+
+    size_t max_attempts_per_ip_;
+    Clock::duration window_;
+
+    //! Accepted attempts in order of arrival, and the number of those still in the window for each IP address
+    std::deque<std::pair<Clock::time_point, boost::asio::ip::address>> attempts_;
+    std::map<boost::asio::ip::address, size_t> attempts_per_ip_;
+};
+
+}  // namespace silkworm::sentry::rlpx
@@ -0,0 +1,71 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "inbound_throttle.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::sentry::rlpx {
+
+using namespace std::chrono_literals;
+using boost::asio::ip::make_address;
+
+TEST_CASE("InboundThrottle.attempts_budget") {
+    InboundThrottle throttle{/* max_attempts_per_ip = */ 2, /* window = */ 30s};
+    const auto ip1 = make_address("10.0.0.1");
+    const auto ip2 = make_address("10.0.0.2");
+    const InboundThrottle::Clock::time_point start;
+
+    CHECK_FALSE(throttle.is_throttled(ip1, start));
+    CHECK_FALSE(throttle.is_throttled(ip1, start + 1s));
+    CHECK(throttle.is_throttled(ip1, start + 2s));
+    CHECK(throttle.is_throttled(ip1, start + 29s));
+
+    // the budget is per IP address
+    CHECK_FALSE(throttle.is_throttled(ip2, start + 29s));
+}
+
+TEST_CASE("InboundThrottle.window_expiry") {
+    InboundThrottle throttle{/* max_attempts_per_ip = */ 2, /* window = */ 30s};
+    const auto ip = make_address("10.0.0.1");
+    const InboundThrottle::Clock::time_point start;
+
+    CHECK_FALSE(throttle.is_throttled(ip, start));
+    CHECK_FALSE(throttle.is_throttled(ip, start + 10s));
+    CHECK(throttle.is_throttled(ip, start + 20s));
+
+    // the first attempt expires, so one more attempt fits into the window
+    CHECK_FALSE(throttle.is_throttled(ip, start + 30s));
+    CHECK(throttle.is_throttled(ip, start + 31s));
+
+    // all attempts expire
+    CHECK_FALSE(throttle.is_throttled(ip, start + 70s));
+    CHECK_FALSE(throttle.is_throttled(ip, start + 71s));
+    CHECK(throttle.is_throttled(ip, start + 72s));
+}
+
+TEST_CASE("InboundThrottle.loopback_exemption") {
+    InboundThrottle throttle{/* max_attempts_per_ip = */ 1, /* window = */ 30s};
+    const InboundThrottle::Clock::time_point start;
+
+    for (const auto& loopback : {make_address("127.0.0.1"), make_address("::1")}) {
+        for (int i = 0; i < 10; i++) {
+            CHECK_FALSE(throttle.is_throttled(loopback, start + std::chrono::seconds{i}));
+        }
+    }
+}
+
+}  // namespace silkworm::sentry::rlpx
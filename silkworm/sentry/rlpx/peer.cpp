@@ -262,7 +262,11 @@ Task<framing::MessageStream> Peer::handshake() {
         protocol_->capability(),
         peer_public_key_.get(),
     };
+    const auto start_time = std::chrono::steady_clock::now();
     auto result = co_await handshake.execute(stream_);
+    log::Debug("sentry") << "Peer::handshake completed in "
+                         << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count()
+                         << " ms" << (is_inbound_ ? " [inbound]" : " [outbound]");
     peer_public_key_.set(std::move(result.peer_public_key));
     hello_message_.set(std::move(result.hello_reply_message));
     co_return std::move(result.message_stream);
@@ -30,10 +30,13 @@ using namespace boost::asio;
 
 Server::Server(
     const any_io_executor& executor,
-    uint16_t port)
+    uint16_t port,
+    size_t max_inbound_attempts_per_ip,
+    std::chrono::seconds inbound_throttle_window)
     : ip_(ip::address{ip::address_v4::any()}),
       port_(port),
-      peer_channel_(executor) {}
+      peer_channel_(executor),
+      inbound_throttle_(max_inbound_attempts_per_ip, inbound_throttle_window) {}
 
 ip::tcp::endpoint Server::listen_endpoint() const {
     return ip::tcp::endpoint{ip_, port_};
@@ -71,6 +74,15 @@ Task<void> Server::run(
         co_await acceptor.async_accept(stream.socket(), use_awaitable);
 
         auto remote_endpoint = stream.socket().remote_endpoint();
+
+        // reject reconnection attempts early: the handshake crypto is expensive
+        if (inbound_throttle_.is_throttled(remote_endpoint.address())) {
+            auto throttled_count = ++throttled_connections_count_;
+            log::Debug("sentry") << "rlpx::Server client from " << remote_endpoint << " throttled"
+                                 << " [total throttled: " << throttled_count << "]";
+            continue;
+        }
+
         log::Debug("sentry") << "rlpx::Server client connected from " << remote_endpoint;
 
         auto peer = std::make_shared<Peer>(
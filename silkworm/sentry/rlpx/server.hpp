@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -29,6 +33,7 @@
 #include <silkworm/infra/concurrency/executor_pool.hpp>
 #include <silkworm/sentry/common/ecc_key_pair.hpp>
 
+#include "inbound_throttle.hpp"
 #include "peer.hpp"
 #include "protocol.hpp"
 
@@ -36,9 +41,13 @@ namespace silkworm::sentry::rlpx {
 
 class Server final {
   public:
+    //! Inbound connections from an IP address exceeding max_inbound_attempts_per_ip within inbound_throttle_window
+    //! are closed before the handshake
     Server(
         const boost::asio::any_io_executor& executor,
-        uint16_t port);
+        uint16_t port,
+        size_t max_inbound_attempts_per_ip,
+        std::chrono::seconds inbound_throttle_window);
 
     Task<void> run(
         concurrency::ExecutorPool& executor_pool,
@@ -53,10 +62,16 @@ class Server final {
         return peer_channel_;
     }
 
+    //! The number of inbound connections closed before the handshake because their IP address was throttled
+    [[nodiscard]] uint64_t throttled_connections_count() const { return throttled_connections_count_; }
+
   private:
     boost::asio::ip::address ip_;
     uint16_t port_;
     concurrency::Channel<std::shared_ptr<Peer>> peer_channel_;
+
+    InboundThrottle inbound_throttle_;
+    std::atomic_uint64_t throttled_connections_count_{0};
 };
 
 }  // namespace silkworm::sentry::rlpx
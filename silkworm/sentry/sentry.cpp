@@ -17,6 +17,7 @@
 #include "sentry.hpp"
 
 #include <cassert>
+#include <chrono>
 #include <optional>
 #include <string>
 
@@ -143,7 +144,11 @@ SentryImpl::SentryImpl(Settings settings, concurrency::ExecutorPool& executor_po
     : settings_(std::move(settings)),
       executor_pool_(executor_pool),
       status_manager_(executor_pool.any_executor()),
-      rlpx_server_(executor_pool.any_executor(), settings_.port),
+      rlpx_server_(
+          executor_pool.any_executor(),
+          settings_.port,
+          settings_.max_inbound_attempts_per_ip,
+          std::chrono::seconds{settings_.inbound_throttle_window_seconds}),
       discovery_(
           executor_pool,
           settings_.static_peers,
@@ -155,7 +160,7 @@ SentryImpl::SentryImpl(Settings settings, concurrency::ExecutorPool& executor_po
           node_record_provider(),
           settings_.bootnodes,
           settings_.port),
-      peer_manager_(executor_pool.any_executor(), settings_.max_peers, executor_pool_),
+      peer_manager_(executor_pool.any_executor(), settings_.max_peers, settings_.max_inbound_handshakes, executor_pool_),
       message_sender_(executor_pool.any_executor()),
       message_receiver_(std::make_shared<MessageReceiver>(executor_pool.any_executor(), settings_.max_peers)),
       peer_manager_api_(std::make_shared<PeerManagerApi>(executor_pool.any_executor(), peer_manager_)),
@@ -60,6 +60,13 @@ struct Settings {
     bool no_discover{false};
 
     size_t max_peers{100};
+
+    // Inbound connection attempts accepted from the same IP address within the throttle window
+    size_t max_inbound_attempts_per_ip{3};
+    uint32_t inbound_throttle_window_seconds{30};
+
+    // Inbound peers handshaking at the same time, further inbound peers are dropped before the handshake
+    size_t max_inbound_handshakes{20};
 };
 
 }  // namespace silkworm::sentry
@@ -43,6 +43,7 @@
 #include <silkworm/silkrpc/core/evm_debug.hpp>
 #include <silkworm/silkrpc/core/evm_executor.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/core/storage_walker.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
@@ -89,7 +90,7 @@ Task<void> DebugRpcApi::handle_debug_account_range(const nlohmann::json& request
 
     try {
         auto start = std::chrono::system_clock::now();
-        core::AccountDumper dumper{*tx};
+        core::AccountDumper dumper{*tx, database_};
         DumpAccounts dump_accounts = co_await dumper.dump_accounts(*block_cache_, block_number_or_hash, backend_, start_address, max_result, exclude_code, exclude_storage);
         auto end = std::chrono::system_clock::now();
         std::chrono::duration<double> elapsed_seconds = end - start;
@@ -327,9 +328,7 @@ Task<void> DebugRpcApi::handle_debug_account_at(const nlohmann::json& request, n
                     uint64_t index = std::min(static_cast<uint64_t>(transactions.size()), tx_index + 1);
                     for (uint64_t idx{0}; idx < index; idx++) {
                         rpc::Transaction txn{transactions[idx]};
-                        if (!txn.from) {
-                            txn.recover_sender();
-                        }
+                        recover_sender(txn, sender_cache_);
                         executor.call(block, txn);
                     }
 
@@ -401,7 +400,7 @@ Task<void> DebugRpcApi::handle_debug_trace_transaction(const nlohmann::json& req
 
     try {
         ethdb::TransactionDatabase tx_database{*tx};
-        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config};
+        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config, sender_cache_};
         const auto chain_storage = tx->create_storage(tx_database, backend_);
         co_await executor.trace_transaction(stream, *chain_storage, transaction_hash);
     } catch (const std::exception& e) {
@@ -455,7 +454,7 @@ Task<void> DebugRpcApi::handle_debug_trace_call(const nlohmann::json& request, j
         const core::rawdb::DatabaseReader& db_reader =
             is_latest_block ? static_cast<core::rawdb::DatabaseReader&>(cached_database) : static_cast<core::rawdb::DatabaseReader&>(tx_database);
 
-        debug::DebugExecutor executor{db_reader, *block_cache_, workers_, *tx, config};
+        debug::DebugExecutor executor{db_reader, *block_cache_, workers_, *tx, config, sender_cache_};
         co_await executor.trace_call(stream, block_number_or_hash, *chain_storage, call);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
@@ -523,7 +522,7 @@ Task<void> DebugRpcApi::handle_debug_trace_call_many(const nlohmann::json& reque
 
     try {
         ethdb::TransactionDatabase tx_database{*tx};
-        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config};
+        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config, sender_cache_};
         const auto chain_storage = tx->create_storage(tx_database, backend_);
         co_await executor.trace_call_many(stream, *chain_storage, bundles, simulation_context);
     } catch (...) {
@@ -567,7 +566,7 @@ Task<void> DebugRpcApi::handle_debug_trace_block_by_number(const nlohmann::json&
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage = tx->create_storage(tx_database, backend_);
 
-        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config};
+        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config, sender_cache_};
         co_await executor.trace_block(stream, *chain_storage, block_number);
     } catch (const std::invalid_argument& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
@@ -620,7 +619,7 @@ Task<void> DebugRpcApi::handle_debug_trace_block_by_hash(const nlohmann::json& r
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage = tx->create_storage(tx_database, backend_);
 
-        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config};
+        debug::DebugExecutor executor{tx_database, *block_cache_, workers_, *tx, config, sender_cache_};
         co_await executor.trace_block(stream, *chain_storage, block_hash);
     } catch (const std::invalid_argument& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
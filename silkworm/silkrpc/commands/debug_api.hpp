@@ -26,6 +26,7 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
@@ -43,6 +44,7 @@ class DebugRpcApi {
     DebugRpcApi(boost::asio::io_context& context, boost::asio::thread_pool& workers)
         : io_context_{context},
           block_cache_{must_use_shared_service<BlockCache>(io_context_)},
+          sender_cache_{use_shared_service<SenderCache>(io_context_)},
           state_cache_{must_use_shared_service<ethdb::kv::StateCache>(io_context_)},
           database_{must_use_private_service<ethdb::Database>(io_context_)},
           workers_{workers},
@@ -72,6 +74,7 @@ class DebugRpcApi {
   private:
     boost::asio::io_context& io_context_;
     BlockCache* block_cache_;
+    SenderCache* sender_cache_;
     ethdb::kv::StateCache* state_cache_;
     ethdb::Database* database_;
     boost::asio::thread_pool& workers_;
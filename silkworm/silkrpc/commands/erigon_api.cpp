@@ -37,6 +37,7 @@
 #include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
 
 namespace silkworm::rpc::commands {
 
@@ -364,7 +365,7 @@ Task<void> ErigonRpcApi::handle_erigon_get_latest_logs(const nlohmann::json& req
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, logs_query_timeout_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
@@ -385,6 +386,9 @@ Task<void> ErigonRpcApi::handle_erigon_get_latest_logs(const nlohmann::json& req
         co_await logs_walker.get_logs(start, end, filter.addresses, filter.topics, options, true, logs);
 
         reply = make_json_content(request, logs);
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        reply = make_json_error(request, kLimitExceeded, e.what());
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
         reply = make_json_error(request, 100, e.what());
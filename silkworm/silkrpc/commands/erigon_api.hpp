@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <boost/asio/io_context.hpp>
@@ -24,6 +26,7 @@
 #include <silkworm/core/common/block_cache.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
@@ -38,10 +41,12 @@ namespace silkworm::rpc::commands {
 
 class ErigonRpcApi {
   public:
-    explicit ErigonRpcApi(boost::asio::io_context& io_context)
+    explicit ErigonRpcApi(boost::asio::io_context& io_context,
+                          std::chrono::milliseconds logs_query_timeout = kDefaultLogsQueryTimeout)
         : block_cache_{must_use_shared_service<BlockCache>(io_context)},
           database_{must_use_private_service<ethdb::Database>(io_context)},
-          backend_{must_use_private_service<ethbackend::BackEnd>(io_context)} {}
+          backend_{must_use_private_service<ethbackend::BackEnd>(io_context)},
+          logs_query_timeout_{logs_query_timeout} {}
     virtual ~ErigonRpcApi() = default;
 
     ErigonRpcApi(const ErigonRpcApi&) = delete;
@@ -66,6 +71,7 @@ class ErigonRpcApi {
     BlockCache* block_cache_;
     ethdb::Database* database_;
     ethbackend::BackEnd* backend_;
+    std::chrono::milliseconds logs_query_timeout_;
 
     friend class silkworm::http::RequestHandler;
 };
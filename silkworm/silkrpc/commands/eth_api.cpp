@@ -50,6 +50,7 @@
 #include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
 #include <silkworm/silkrpc/stagedsync/stages.hpp>
 
 namespace silkworm::rpc::commands {
@@ -1244,7 +1245,7 @@ Task<void> EthereumRpcApi::handle_eth_call_many(const nlohmann::json& request, n
     auto tx = co_await database_->begin();
 
     try {
-        call::CallExecutor executor{*tx, *block_cache_, workers_, backend_};
+        call::CallExecutor executor{*tx, *block_cache_, workers_, backend_, sender_cache_};
         const auto result = co_await executor.execute(bundles, simulation_context, accounts_overrides, timeout);
 
         if (result.error) {
@@ -1527,7 +1528,7 @@ Task<void> EthereumRpcApi::handle_eth_new_filter(const nlohmann::json& request,
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, logs_query_timeout_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         filter.start = start;
         filter.end = end;
@@ -1620,7 +1621,7 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_logs(const nlohmann::json& requ
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, logs_query_timeout_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
 
         if (filter.start != start && filter.end != end) {
@@ -1635,6 +1636,9 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_logs(const nlohmann::json& requ
         reply = make_json_content(request, filter.logs);
     } catch (const std::invalid_argument& iv) {
         reply = make_json_content(request, {});
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        reply = make_json_error(request, kLimitExceeded, e.what());
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
         reply = make_json_error(request, 100, e.what());
@@ -1673,7 +1677,7 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_changes(const nlohmann::json& r
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, logs_query_timeout_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
 
         std::vector<Log> logs;
@@ -1689,6 +1693,9 @@ Task<void> EthereumRpcApi::handle_eth_get_filter_changes(const nlohmann::json& r
         filter.end = end;
 
         reply = make_json_content(request, logs);
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        reply = make_json_error(request, kLimitExceeded, e.what());
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
         reply = make_json_error(request, 100, e.what());
@@ -1746,7 +1753,7 @@ Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, st
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        LogsWalker logs_walker(backend_, *block_cache_, tx_database);
+        LogsWalker logs_walker(backend_, *block_cache_, tx_database, logs_query_timeout_);
         const auto [start, end] = co_await logs_walker.get_block_numbers(filter);
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
@@ -1763,6 +1770,9 @@ Task<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, st
     } catch (const std::invalid_argument& iv) {
         std::vector<silkworm::rpc::Log> log{};
         make_glaze_json_content(request, log, reply);
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        make_glaze_json_error(request, kLimitExceeded, e.what(), reply);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
         make_glaze_json_error(request, 100, e.what(), reply);
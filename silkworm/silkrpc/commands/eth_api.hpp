@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <boost/asio/io_context.hpp>
@@ -27,8 +29,10 @@
 #include <silkworm/core/types/receipt.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/core/filter_storage.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
@@ -49,16 +53,19 @@ namespace silkworm::rpc::commands {
 
 class EthereumRpcApi {
   public:
-    EthereumRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
+    EthereumRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers,
+                   std::chrono::milliseconds logs_query_timeout = kDefaultLogsQueryTimeout)
         : io_context_{io_context},
           block_cache_{must_use_shared_service<BlockCache>(io_context_)},
+          sender_cache_{use_shared_service<SenderCache>(io_context_)},
           state_cache_{must_use_shared_service<ethdb::kv::StateCache>(io_context_)},
           database_{must_use_private_service<ethdb::Database>(io_context_)},
           backend_{must_use_private_service<ethbackend::BackEnd>(io_context_)},
           miner_{must_use_private_service<txpool::Miner>(io_context_)},
           tx_pool_{must_use_private_service<txpool::TransactionPool>(io_context_)},
           filter_storage_{must_use_shared_service<FilterStorage>(io_context_)},
-          workers_{workers} {}
+          workers_{workers},
+          logs_query_timeout_{logs_query_timeout} {}
 
     virtual ~EthereumRpcApi() = default;
 
@@ -121,6 +128,7 @@ class EthereumRpcApi {
 
     boost::asio::io_context& io_context_;
     BlockCache* block_cache_;
+    SenderCache* sender_cache_;
     ethdb::kv::StateCache* state_cache_;
     ethdb::Database* database_;
     ethbackend::BackEnd* backend_;
@@ -128,6 +136,7 @@ class EthereumRpcApi {
     txpool::TransactionPool* tx_pool_;
     FilterStorage* filter_storage_;
     boost::asio::thread_pool& workers_;
+    std::chrono::milliseconds logs_query_timeout_;
 
     friend class silkworm::http::RequestHandler;
 };
@@ -16,7 +16,11 @@
 
 #include "ots_api.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
 #include <numeric>
+#include <optional>
 #include <string>
 
 #include <silkworm/core/protocol/ethash_rule_set.hpp>
@@ -24,6 +28,7 @@
 #include <silkworm/core/types/evmc_bytes32.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/bitmap.hpp>
 #include <silkworm/node/db/tables.hpp>
@@ -35,12 +40,17 @@
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/ethdb/view_transactions.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
 
 namespace silkworm::rpc::commands {
 
 constexpr int kCurrentApiLevel{8};
 
+//! The max number of blocks traced concurrently when searching transactions
+constexpr std::size_t kMaxConcurrentBlockTraces{16};
+
 Task<void> OtsRpcApi::handle_ots_get_api_level(const nlohmann::json& request, nlohmann::json& reply) {
     reply = make_json_content(request, kCurrentApiLevel);
     co_return;
@@ -279,75 +289,16 @@ Task<void> OtsRpcApi::handle_ots_get_transaction_by_sender_and_nonce(const nlohm
     auto tx = co_await database_->begin();
 
     try {
-        auto account_history_cursor = co_await tx->cursor(db::table::kAccountHistoryName);
-        auto account_change_set_cursor = co_await tx->cursor_dup_sort(db::table::kAccountChangeSetName);
-        auto sender_byte_view = full_view(sender);
-        auto key_value = co_await account_history_cursor->seek(sender_byte_view);
-
-        std::vector<BlockNum> account_block_numbers;
-
-        BlockNum max_block_prev_chunk = 0;
-        roaring::Roaring64Map bitmap;
-
-        while (true) {
-            if (key_value.key.empty() || !key_value.key.starts_with(sender_byte_view)) {
-                auto plain_state_cursor = co_await tx->cursor(db::table::kPlainStateName);
-                auto account_payload = co_await plain_state_cursor->seek(sender_byte_view);
-                auto account = Account::from_encoded_storage(account_payload.value);
-
-                if (account.has_value() && account.value().nonce > nonce) {
-                    break;
-                }
-
-                reply = make_json_content(request, nlohmann::detail::value_t::null);
-                co_await tx->close();
-                co_return;
-            }
-
-            bitmap = db::bitmap::parse(key_value.value);
-            auto const max_block = bitmap.maximum();
-            auto block_key{db::block_key(max_block)};
-            auto account_payload = co_await account_change_set_cursor->seek_both(block_key, sender_byte_view);
-            if (account_payload.starts_with(sender_byte_view)) {
-                account_payload = account_payload.substr(sender_byte_view.length());
-                auto account = Account::from_encoded_storage(account_payload);
-
-                if (account.has_value() && account.value().nonce > nonce) {
-                    break;
-                }
-            }
-            max_block_prev_chunk = max_block;
-            key_value = co_await account_history_cursor->next();
-        }
-
-        uint64_t cardinality = bitmap.cardinality();
-        account_block_numbers.reserve(cardinality);
-        bitmap.toUint64Array(account_block_numbers.data());
-
-        uint64_t idx = 0;
-        for (uint64_t i = 0; i < cardinality; i++) {
-            auto block_number = account_block_numbers[i];
-            auto block_key{db::block_key(block_number)};
-            auto account_payload = co_await account_change_set_cursor->seek_both(block_key, sender_byte_view);
-            if (account_payload.starts_with(sender_byte_view)) {
-                account_payload = account_payload.substr(sender_byte_view.length());
-                auto account = Account::from_encoded_storage(account_payload);
-
-                if (account.has_value() && account.value().nonce > nonce) {
-                    idx = i;
-                    break;
-                }
-            }
-        }
-
-        auto nonce_block = max_block_prev_chunk;
-        if (idx > 0) {
-            nonce_block = account_block_numbers[idx - 1];
+        const auto nonce_block = co_await find_nonce_block(*tx, sender, nonce);
+        if (!nonce_block) {
+            reply = make_json_content(request, nlohmann::detail::value_t::null);
+            co_await tx->close();
+            co_return;
         }
 
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage{tx->create_storage(tx_database, backend_)};
-        auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, nonce_block);
+        auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, *nonce_block);
         if (block_with_hash) {
             for (const auto& transaction : block_with_hash->block.transactions) {
                 if (transaction.from == sender && transaction.nonce == nonce) {
@@ -377,6 +328,75 @@ Task<void> OtsRpcApi::handle_ots_get_transaction_by_sender_and_nonce(const nlohm
     co_return;
 }
 
+Task<std::optional<BlockNum>> OtsRpcApi::find_nonce_block(ethdb::Transaction& tx, const evmc::address& sender, uint64_t nonce) {
+    auto account_history_cursor = co_await tx.cursor(db::table::kAccountHistoryName);
+    auto account_change_set_cursor = co_await tx.cursor_dup_sort(db::table::kAccountChangeSetName);
+    auto sender_byte_view = full_view(sender);
+    auto key_value = co_await account_history_cursor->seek(sender_byte_view);
+
+    BlockNum max_block_prev_chunk = 0;
+    roaring::Roaring64Map bitmap;
+
+    while (true) {
+        if (key_value.key.empty() || !key_value.key.starts_with(sender_byte_view)) {
+            auto plain_state_cursor = co_await tx.cursor(db::table::kPlainStateName);
+            auto account_payload = co_await plain_state_cursor->seek(sender_byte_view);
+            auto account = Account::from_encoded_storage(account_payload.value);
+
+            if (account.has_value() && account.value().nonce > nonce) {
+                break;
+            }
+
+            co_return std::nullopt;
+        }
+
+        bitmap = db::bitmap::parse(key_value.value);
+        auto const max_block = bitmap.maximum();
+        auto block_key{db::block_key(max_block)};
+        auto account_payload = co_await account_change_set_cursor->seek_both(block_key, sender_byte_view);
+        if (account_payload.starts_with(sender_byte_view)) {
+            account_payload = account_payload.substr(sender_byte_view.length());
+            auto account = Account::from_encoded_storage(account_payload);
+
+            if (account.has_value() && account.value().nonce > nonce) {
+                break;
+            }
+        }
+        max_block_prev_chunk = max_block;
+        key_value = co_await account_history_cursor->next();
+    }
+
+    std::vector<BlockNum> account_block_numbers(bitmap.cardinality());
+    bitmap.toUint64Array(account_block_numbers.data());
+
+    // Nonces never decrease, so binary search the first block changing the account whose nonce before is greater
+    std::size_t low{0};
+    std::size_t high{account_block_numbers.size()};
+    while (low < high) {
+        const auto middle{low + (high - low) / 2};
+        auto block_key{db::block_key(account_block_numbers[middle])};
+        auto account_payload = co_await account_change_set_cursor->seek_both(block_key, sender_byte_view);
+        bool nonce_greater{false};
+        if (account_payload.starts_with(sender_byte_view)) {
+            account_payload = account_payload.substr(sender_byte_view.length());
+            auto account = Account::from_encoded_storage(account_payload);
+            nonce_greater = account.has_value() && account.value().nonce > nonce;
+        }
+        if (nonce_greater) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+
+    auto nonce_block = max_block_prev_chunk;
+    if (low > 0) {
+        nonce_block = account_block_numbers[low - 1];
+    }
+
+    co_return nonce_block;
+}
+
 Task<void> OtsRpcApi::handle_ots_get_contract_creator(const nlohmann::json& request, nlohmann::json& reply) {
     const auto& params = request["params"];
     if (params.size() != 1) {
@@ -415,8 +435,6 @@ Task<void> OtsRpcApi::handle_ots_get_contract_creator(const nlohmann::json& requ
 
         auto key_value = co_await account_history_cursor->seek(db::account_history_key(contract_address, 0));
 
-        std::vector<BlockNum> account_block_numbers;
-
         BlockNum max_block_prev_chunk = 0;
         roaring::Roaring64Map bitmap;
 
@@ -493,7 +511,7 @@ Task<void> OtsRpcApi::handle_ots_get_contract_creator(const nlohmann::json& requ
 
         auto block_with_hash = co_await core::read_block_by_number(*block_cache_, *chain_storage, block_found);
         if (block_with_hash) {
-            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
             const auto result = co_await executor.trace_deploy_transaction(block_with_hash->block, contract_address);
             reply = make_json_content(request, result);
         } else {
@@ -532,7 +550,7 @@ Task<void> OtsRpcApi::handle_ots_trace_transaction(const nlohmann::json& request
     try {
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage{tx->create_storage(tx_database, backend_)};
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
 
         const auto transaction_with_block = co_await core::read_transaction_by_hash(*block_cache_, *chain_storage, transaction_hash);
 
@@ -579,7 +597,7 @@ Task<void> OtsRpcApi::handle_ots_get_transaction_error(const nlohmann::json& req
     try {
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage{tx->create_storage(tx_database, backend_)};
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
 
         const auto transaction_with_block = co_await core::read_transaction_by_hash(*block_cache_, *chain_storage, transaction_hash);
 
@@ -626,7 +644,7 @@ Task<void> OtsRpcApi::handle_ots_get_internal_operations(const nlohmann::json& r
     try {
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage{tx->create_storage(tx_database, backend_)};
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
 
         const auto transaction_with_block = co_await core::read_transaction_by_hash(*block_cache_, *chain_storage, transaction_hash);
 
@@ -669,6 +687,7 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_before(const nlohmann::json
     const auto page_size = params[2].get<uint64_t>();
 
     SILK_DEBUG << "address: " << address << " block_number: " << block_number << " page_size: " << page_size;
+    const auto deadline{std::chrono::steady_clock::now() + search_timeout_};
     auto tx = co_await database_->begin();
 
     try {
@@ -698,7 +717,7 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_before(const nlohmann::json
         while (result_count < page_size && has_more) {
             std::vector<TransactionsWithReceipts> transactions_with_receipts_vec;
 
-            has_more = co_await trace_blocks(from_to_provider, *tx, address, page_size, result_count, transactions_with_receipts_vec);
+            has_more = co_await trace_blocks(*tx, from_to_provider, address, page_size, result_count, deadline, transactions_with_receipts_vec);
 
             for (const auto& item : transactions_with_receipts_vec) {
                 for (uint64_t i = item.transactions.size() - 1; i > 0 && i < item.transactions.size(); i--) {
@@ -724,6 +743,9 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_before(const nlohmann::json
         TransactionsWithReceipts results{is_first_page, !has_more, receipts, transactions, blocks};
         reply = make_json_content(request, results);
 
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        reply = make_json_error(request, kLimitExceeded, e.what());
     } catch (const std::invalid_argument& iv) {
         SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
         reply = make_json_content(request, nlohmann::detail::value_t::null);
@@ -753,6 +775,7 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_after(const nlohmann::json&
     const auto page_size = params[2].get<uint64_t>();
 
     SILK_DEBUG << "address: " << address << " block_number: " << block_number << " page_size: " << page_size;
+    const auto deadline{std::chrono::steady_clock::now() + search_timeout_};
     auto tx = co_await database_->begin();
 
     try {
@@ -782,7 +805,7 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_after(const nlohmann::json&
         while (result_count < page_size && has_more) {
             std::vector<TransactionsWithReceipts> transactions_with_receipts_vec;
 
-            has_more = co_await trace_blocks(from_to_provider, *tx, address, page_size, result_count, transactions_with_receipts_vec);
+            has_more = co_await trace_blocks(*tx, from_to_provider, address, page_size, result_count, deadline, transactions_with_receipts_vec);
 
             for (const auto& item : transactions_with_receipts_vec) {
                 receipts.insert(receipts.end(), item.receipts.begin(), item.receipts.end());
@@ -806,6 +829,9 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_after(const nlohmann::json&
 
         reply = make_json_content(request, results);
 
+    } catch (const QueryTimeoutError& e) {
+        SILK_WARN << "exception: " << e.what() << " processing request: " << request.dump();
+        reply = make_json_error(request, kLimitExceeded, e.what());
     } catch (const std::invalid_argument& iv) {
         SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
         reply = make_json_content(request, nlohmann::detail::value_t::null);
@@ -822,43 +848,52 @@ Task<void> OtsRpcApi::handle_ots_search_transactions_after(const nlohmann::json&
 }
 
 Task<bool> OtsRpcApi::trace_blocks(
-    FromToBlockProvider& from_to_provider,
     ethdb::Transaction& tx,
+    BlockProvider& block_provider,
     evmc::address address,
     uint64_t page_size,
     uint64_t result_count,
+    std::chrono::steady_clock::time_point deadline,
     std::vector<TransactionsWithReceipts>& results) {
     uint64_t est_blocks_to_trace = page_size - result_count;
-    uint64_t total_blocks_traced = 0;
     bool has_more = true;
 
-    results.clear();
-    results.resize(est_blocks_to_trace);
-
+    // Walking the call indexes is cheap compared to tracing, so collect all the candidate blocks upfront
+    std::vector<BlockNum> block_numbers;
     for (uint64_t i = 0; i < est_blocks_to_trace; i++) {
-        auto from_to_response = co_await from_to_provider.get();  // extract_next_block(from_cursor,to_cursor);
-        auto next_block = from_to_response.block_number;
+        auto block_provider_response = co_await block_provider.get();
+        auto next_block = block_provider_response.block_number;
         if (next_block == 0) {
             has_more = false;
             break;
         }
-
-        total_blocks_traced++;
-        co_await search_trace_block(tx, address, i, next_block, results);
+        block_numbers.push_back(next_block);
     }
 
-    results.resize(total_blocks_traced);
+    results.clear();
+    results.resize(block_numbers.size());
+
+    // The search results must come from the same state whatever transaction traced each block
+    const auto max_concurrent_traces{std::min(kMaxConcurrentBlockTraces, block_numbers.size())};
+    co_await ethdb::with_view_transactions(*database_, tx, max_concurrent_traces, [&](const std::vector<ethdb::Transaction*>& view_txs) -> Task<void> {
+        // Each transaction pulls the next block to trace as soon as it is done with the previous one, so a slow block
+        // does not hold back the others. Each block goes into its own slot, so the results keep the index order
+        std::size_t next_block{0};  // no synchronization needed, all the traces run on the executor of this coroutine
+        co_await concurrency::generate_parallel_group_task(view_txs.size(), [&](std::size_t i) -> Task<void> {
+            while (next_block < block_numbers.size()) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    SILK_WARN << "OtsRpcApi::trace_blocks timeout exceeded after blocks: " << next_block;
+                    throw QueryTimeoutError{};
+                }
+                const auto block_index{next_block++};
+                co_await trace_block(*view_txs[i], block_numbers[block_index], address, results[block_index]);
+            }
+        });
+    });
 
     co_return has_more;
 }
 
-Task<void> OtsRpcApi::search_trace_block(ethdb::Transaction& tx, evmc::address address, unsigned long index, BlockNum block_number, std::vector<TransactionsWithReceipts>& results) {
-    TransactionsWithReceipts transactions_with_receipts;
-    co_await trace_block(tx, block_number, address, transactions_with_receipts);
-    results[index] = transactions_with_receipts;
-    co_return;
-}
-
 Task<void> OtsRpcApi::trace_block(ethdb::Transaction& tx, BlockNum block_number, evmc::address search_addr, TransactionsWithReceipts& results) {
     ethdb::TransactionDatabase tx_database{tx};
     const auto chain_storage = tx.create_storage(tx_database, backend_);
@@ -874,10 +909,14 @@ Task<void> OtsRpcApi::trace_block(ethdb::Transaction& tx, BlockNum block_number,
     const Block extended_block{*block_with_hash, *total_difficulty, false};
     const auto block_size = extended_block.get_block_size();
 
+    trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, tx, sender_cache_};
     for (uint64_t i = 0; i < block_with_hash->block.transactions.size(); i++) {
         const auto& transaction = block_with_hash->block.transactions.at(i);
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, tx};
-        const auto found = co_await executor.trace_touch_transaction(block_with_hash->block, transaction, search_addr);
+        // The block body is enough when the address is the sender or the recipient, no need to re-execute
+        auto found = transaction.from == search_addr || transaction.to == search_addr;
+        if (!found) {
+            found = co_await executor.trace_touch_transaction(block_with_hash->block, transaction, search_addr);
+        }
 
         if (found) {
             const BlockDetails block_details{block_size, block_hash, block_with_hash->block.header, *total_difficulty,
@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <optional>
+#include <vector>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <boost/asio/thread_pool.hpp>
@@ -27,9 +31,12 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/node/db/bitmap.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
+#include <silkworm/silkrpc/ethdb/transaction.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 #include <silkworm/silkrpc/types/log.hpp>
 
@@ -187,13 +194,16 @@ class FromToBlockProvider : public BlockProvider {
 
 class OtsRpcApi {
   public:
-    OtsRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
+    OtsRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers,
+              std::chrono::milliseconds search_timeout = kDefaultLogsQueryTimeout)
         : io_context_(io_context),
           workers_{workers},
           database_(must_use_private_service<ethdb::Database>(io_context_)),
           state_cache_(must_use_shared_service<ethdb::kv::StateCache>(io_context_)),
           block_cache_(must_use_shared_service<BlockCache>(io_context_)),
-          backend_{must_use_private_service<ethbackend::BackEnd>(io_context_)} {}
+          sender_cache_(use_shared_service<SenderCache>(io_context_)),
+          backend_{must_use_private_service<ethbackend::BackEnd>(io_context_)},
+          search_timeout_{search_timeout} {}
 
     virtual ~OtsRpcApi() = default;
 
@@ -214,26 +224,34 @@ class OtsRpcApi {
     Task<void> handle_ots_search_transactions_before(const nlohmann::json& request, nlohmann::json& reply);
     Task<void> handle_ots_search_transactions_after(const nlohmann::json& request, nlohmann::json& reply);
 
+    //! Find the block including the transaction with the given nonce sent by the sender, if any
+    static Task<std::optional<BlockNum>> find_nonce_block(ethdb::Transaction& tx, const evmc::address& sender, uint64_t nonce);
+
+    //! Trace the next blocks given by the provider in parallel, the results are in the same order as the blocks
+    //! \throws QueryTimeoutError if the deadline is reached before all the blocks are traced
+    Task<bool> trace_blocks(
+        ethdb::Transaction& tx,
+        BlockProvider& block_provider,
+        evmc::address address,
+        uint64_t page_size,
+        uint64_t result_count,
+        std::chrono::steady_clock::time_point deadline,
+        std::vector<TransactionsWithReceipts>& results);
+
+    virtual Task<void> trace_block(ethdb::Transaction& tx, BlockNum block_number, evmc::address search_addr, TransactionsWithReceipts& results);
+
     boost::asio::io_context& io_context_;
     boost::asio::thread_pool& workers_;
     ethdb::Database* database_;
     ethdb::kv::StateCache* state_cache_;
     BlockCache* block_cache_;
+    SenderCache* sender_cache_;
     ethbackend::BackEnd* backend_;
+    std::chrono::milliseconds search_timeout_;
 
     friend class silkworm::http::RequestHandler;
 
   private:
-    Task<bool> trace_blocks(
-        FromToBlockProvider& from_to_provider,
-        ethdb::Transaction& tx,
-        evmc::address address,
-        uint64_t page_size,
-        uint64_t result_count,
-        std::vector<TransactionsWithReceipts>& results);
-
-    Task<void> search_trace_block(ethdb::Transaction& tx, evmc::address address, unsigned long index, BlockNum block_number, std::vector<TransactionsWithReceipts>& results);
-    Task<void> trace_block(ethdb::Transaction& tx, BlockNum block_number, evmc::address search_addr, TransactionsWithReceipts& results);
     static IssuanceDetails get_issuance(const silkworm::ChainConfig& chain_config, const silkworm::BlockWithHash& block);
     static intx::uint256 get_block_fees(const silkworm::ChainConfig& chain_config, const silkworm::BlockWithHash& block,
                                         const std::vector<Receipt>& receipts, silkworm::BlockNum block_number);
@@ -0,0 +1,297 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ots_api.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <catch2/catch.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/node/db/bitmap.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
+#include <silkworm/silkrpc/test/context_test_base.hpp>
+#include <silkworm/silkrpc/test/dummy_transaction.hpp>
+#include <silkworm/silkrpc/test/mock_cursor.hpp>
+#include <silkworm/silkrpc/test/mock_transaction.hpp>
+
+namespace silkworm::rpc::commands {
+
+using evmc::literals::operator""_address;
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+static const evmc::address kSender{0x00000000000000000000000000000000000000a1_address};
+static constexpr uint64_t kTestViewId{42};
+
+//! Utility class to expose handle hooks publicly just for tests
+class OtsRpcApi_ForTest : public OtsRpcApi {
+  public:
+    OtsRpcApi_ForTest(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
+        : OtsRpcApi{io_context, workers} {}
+
+    static Task<std::optional<BlockNum>> nonce_block(ethdb::Transaction& tx, const evmc::address& sender, uint64_t nonce) {
+        co_return co_await OtsRpcApi::find_nonce_block(tx, sender, nonce);
+    }
+
+    Task<bool> search_blocks(ethdb::Transaction& tx, BlockProvider& block_provider, uint64_t page_size,
+                             std::vector<TransactionsWithReceipts>& results,
+                             std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) {
+        co_return co_await OtsRpcApi::trace_blocks(tx, block_provider, kSender, page_size, 0, deadline, results);
+    }
+
+    //! The transactions used to trace the blocks
+    std::set<const ethdb::Transaction*> trace_txs;
+    //! The transaction used to trace each block
+    std::map<BlockNum, const ethdb::Transaction*> block_txs;
+    //! The block whose trace takes much longer than any other
+    std::optional<BlockNum> slow_block;
+
+  protected:
+    //! Record the block number as nonce w/o tracing, the earlier the block the later its trace completes
+    Task<void> trace_block(ethdb::Transaction& tx, BlockNum block_number, evmc::address /*search_addr*/,
+                           TransactionsWithReceipts& results) override {
+        trace_txs.insert(&tx);
+        block_txs[block_number] = &tx;
+        const std::chrono::milliseconds trace_time{block_number == slow_block ? 1000 : 100 - static_cast<int64_t>(block_number)};
+        boost::asio::steady_timer timer{co_await boost::asio::this_coro::executor, trace_time};
+        co_await timer.async_wait(boost::asio::use_awaitable);
+        Transaction transaction;
+        transaction.nonce = block_number;
+        results.transactions.push_back(transaction);
+    }
+};
+
+//! Give the block numbers in the list one after another
+class BlockListProvider : public BlockProvider {
+  public:
+    explicit BlockListProvider(std::vector<BlockNum> block_numbers) : block_numbers_{std::move(block_numbers)} {}
+
+    Task<BlockProviderResponse> get() override {
+        if (next_ == block_numbers_.size()) {
+            co_return BlockProviderResponse{0, false, false};
+        }
+        const auto block_number{block_numbers_[next_++]};
+        co_return BlockProviderResponse{block_number, next_ < block_numbers_.size(), false};
+    }
+
+  private:
+    std::vector<BlockNum> block_numbers_;
+    std::size_t next_{0};
+};
+
+//! Database whose transactions see the same view or a new one each time if the state keeps changing
+class ViewDatabase : public ethdb::Database {
+  public:
+    explicit ViewDatabase(bool state_changing) : state_changing_{state_changing} {}
+
+    Task<std::unique_ptr<ethdb::Transaction>> begin() override {
+        co_return std::make_unique<test::DummyTransaction>(state_changing_ ? ++view_id_ : view_id_, nullptr);
+    }
+
+  private:
+    bool state_changing_;
+    uint64_t view_id_{kTestViewId};
+};
+
+#ifndef SILKWORM_SANITIZE
+TEST_CASE_METHOD(test::ContextTestBase, "OtsRpcApi::trace_blocks", "[silkrpc][ots_api]") {
+    boost::asio::thread_pool workers{1};
+    test::DummyTransaction tx{kTestViewId, nullptr};
+    std::vector<BlockNum> block_numbers;
+    for (BlockNum block_number{1}; block_number <= 40; ++block_number) {
+        block_numbers.push_back(block_number);
+    }
+    BlockListProvider block_provider{block_numbers};
+    std::vector<TransactionsWithReceipts> results;
+
+    const auto check_block_order = [&](std::size_t count) {
+        REQUIRE(results.size() == count);
+        for (std::size_t i{0}; i < count; ++i) {
+            REQUIRE(results[i].transactions.size() == 1);
+            CHECK(results[i].transactions[0].nonce == block_numbers[i]);
+        }
+    };
+
+    SECTION("results keep the block order") {
+        add_private_service<ethdb::Database>(io_context_, std::make_unique<ViewDatabase>(/*state_changing=*/false));
+        OtsRpcApi_ForTest api{io_context_, workers};
+        CHECK_FALSE(spawn_and_wait(api.search_blocks(tx, block_provider, 50, results)));
+        check_block_order(40);
+        // The blocks are traced concurrently on transactions sharing the same view
+        CHECK(api.trace_txs.size() > 1);
+        CHECK(api.trace_txs.contains(&tx));
+    }
+
+    SECTION("slow block does not hold back the others") {
+        add_private_service<ethdb::Database>(io_context_, std::make_unique<ViewDatabase>(/*state_changing=*/false));
+        OtsRpcApi_ForTest api{io_context_, workers};
+        api.slow_block = 1;
+        CHECK_FALSE(spawn_and_wait(api.search_blocks(tx, block_provider, 50, results)));
+        check_block_order(40);
+        // The other transactions share all the remaining blocks while the slow one is traced
+        const auto slow_tx{api.block_txs.at(1)};
+        for (BlockNum block_number{2}; block_number <= 40; ++block_number) {
+            CHECK(api.block_txs.at(block_number) != slow_tx);
+        }
+    }
+
+    SECTION("page smaller than the candidate blocks") {
+        add_private_service<ethdb::Database>(io_context_, std::make_unique<ViewDatabase>(/*state_changing=*/false));
+        OtsRpcApi_ForTest api{io_context_, workers};
+        CHECK(spawn_and_wait(api.search_blocks(tx, block_provider, 25, results)));
+        check_block_order(25);
+    }
+
+    SECTION("no other transaction can see the same view") {
+        add_private_service<ethdb::Database>(io_context_, std::make_unique<ViewDatabase>(/*state_changing=*/true));
+        OtsRpcApi_ForTest api{io_context_, workers};
+        CHECK_FALSE(spawn_and_wait(api.search_blocks(tx, block_provider, 50, results)));
+        check_block_order(40);
+        // All the blocks are traced one after another on the request transaction
+        CHECK(api.trace_txs == std::set<const ethdb::Transaction*>{&tx});
+    }
+
+    SECTION("deadline reached before the blocks are traced") {
+        add_private_service<ethdb::Database>(io_context_, std::make_unique<ViewDatabase>(/*state_changing=*/false));
+        OtsRpcApi_ForTest api{io_context_, workers};
+        const auto deadline{std::chrono::steady_clock::now()};
+        CHECK_THROWS_AS(spawn_and_wait(api.search_blocks(tx, block_provider, 50, results, deadline)), QueryTimeoutError);
+        CHECK(api.trace_txs.empty());
+    }
+}
+
+TEST_CASE_METHOD(test::ContextTestBase, "OtsRpcApi::find_nonce_block", "[silkrpc][ots_api]") {
+    // The sender sends the transaction with nonce N in block 10 * (N + 1): two history chunks {10, 20} and {30, 40}
+    const auto make_chunk = [](BlockNum chunk_suffix, const std::vector<BlockNum>& block_numbers) {
+        roaring::Roaring64Map bitmap;
+        for (const auto block_number : block_numbers) {
+            bitmap.add(block_number);
+        }
+        Bytes chunk_key{full_view(kSender)};
+        chunk_key.append(db::block_key(chunk_suffix));
+        return KeyValue{chunk_key, db::bitmap::to_bytes(bitmap)};
+    };
+    std::vector<KeyValue> history_chunks{make_chunk(20, {10, 20}), make_chunk(UINT64_MAX, {30, 40})};
+    // The account before each block changing it: it does not exist before the first one
+    std::map<BlockNum, std::optional<Account>> account_changes{
+        {10, std::nullopt},
+        {20, Account{.nonce = 1}},
+        {30, Account{.nonce = 2}},
+        {40, Account{.nonce = 3}},
+    };
+    Account current_account{.nonce = 4};
+
+    std::size_t next_chunk{0};
+    auto history_cursor = std::make_shared<test::MockCursor>();
+    EXPECT_CALL(*history_cursor, seek(_)).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<KeyValue> {
+        next_chunk = 0;
+        co_return next_chunk < history_chunks.size() ? history_chunks[next_chunk++] : KeyValue{};
+    }));
+    EXPECT_CALL(*history_cursor, next()).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<KeyValue> {
+        co_return next_chunk < history_chunks.size() ? history_chunks[next_chunk++] : KeyValue{};
+    }));
+    auto change_set_cursor = std::make_shared<test::MockCursorDupSort>();
+    std::vector<BlockNum> change_set_reads;
+    EXPECT_CALL(*change_set_cursor, seek_both(_, _)).WillRepeatedly([&](ByteView key, ByteView subkey) -> Task<Bytes> {
+        const auto block_number{endian::load_big_u64(key.data())};
+        change_set_reads.push_back(block_number);
+        Bytes value{subkey};
+        if (const auto it{account_changes.find(block_number)}; it != account_changes.end() && it->second) {
+            value.append(it->second->encode_for_storage());
+        }
+        co_return value;
+    });
+    auto plain_state_cursor = std::make_shared<test::MockCursor>();
+    EXPECT_CALL(*plain_state_cursor, seek(_)).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<KeyValue> {
+        co_return KeyValue{Bytes{full_view(kSender)}, current_account.encode_for_storage()};
+    }));
+
+    test::MockTransaction tx;
+    EXPECT_CALL(tx, cursor(db::table::kAccountHistoryName)).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<std::shared_ptr<ethdb::Cursor>> {
+        co_return history_cursor;
+    }));
+    EXPECT_CALL(tx, cursor(db::table::kPlainStateName)).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<std::shared_ptr<ethdb::Cursor>> {
+        co_return plain_state_cursor;
+    }));
+    EXPECT_CALL(tx, cursor_dup_sort(db::table::kAccountChangeSetName)).WillRepeatedly(InvokeWithoutArgs([&]() -> Task<std::shared_ptr<ethdb::CursorDupSort>> {
+        co_return change_set_cursor;
+    }));
+
+    const auto find_nonce_block = [&](uint64_t nonce) {
+        return spawn_and_wait(OtsRpcApi_ForTest::nonce_block(tx, kSender, nonce));
+    };
+
+    SECTION("nonce 0 in the first block changing the account") {
+        CHECK(find_nonce_block(0) == 10);
+    }
+
+    SECTION("nonce in the last block of the previous chunk") {
+        CHECK(find_nonce_block(1) == 20);
+    }
+
+    SECTION("nonce in the middle of the last chunk") {
+        CHECK(find_nonce_block(2) == 30);
+    }
+
+    SECTION("nonce in the last block changing the account") {
+        CHECK(find_nonce_block(3) == 40);
+    }
+
+    SECTION("nonce not used yet") {
+        CHECK_FALSE(find_nonce_block(4));
+        CHECK_FALSE(find_nonce_block(100));
+    }
+
+    SECTION("sender without history") {
+        history_chunks.clear();
+        current_account = Account{};
+        CHECK_FALSE(find_nonce_block(0));
+    }
+
+    SECTION("change sets are binary searched") {
+        account_changes.clear();
+        std::vector<BlockNum> block_numbers;
+        for (BlockNum block_number{1}; block_number <= 1'024; ++block_number) {
+            block_numbers.push_back(block_number);
+            account_changes.emplace(block_number, Account{.nonce = block_number - 1});
+        }
+        history_chunks = {make_chunk(UINT64_MAX, block_numbers)};
+        current_account = Account{.nonce = 1'024};
+
+        CHECK(find_nonce_block(700) == 701);
+        // One read for the last block of the chunk plus at most log2(1024) + 1 reads for the search
+        CHECK(change_set_reads.size() <= 12);
+    }
+}
+#endif  // SILKWORM_SANITIZE
+
+}  // namespace silkworm::rpc::commands
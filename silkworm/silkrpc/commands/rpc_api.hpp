@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include <boost/asio/io_context.hpp>
@@ -53,18 +54,20 @@ class RpcApi : protected EthereumRpcApi,
                TxPoolRpcApi,
                OtsRpcApi {
   public:
-    explicit RpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
-        : EthereumRpcApi{io_context, workers},
+    explicit RpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers,
+                    std::chrono::milliseconds logs_query_timeout = kDefaultLogsQueryTimeout,
+                    uint64_t trace_filter_max_blocks = kDefaultTraceFilterMaxBlocks)
+        : EthereumRpcApi{io_context, workers, logs_query_timeout},
           NetRpcApi{io_context},
           AdminRpcApi{io_context},
           Web3RpcApi{io_context},
           DebugRpcApi{io_context, workers},
           ParityRpcApi{io_context},
-          ErigonRpcApi{io_context},
-          TraceRpcApi{io_context, workers},
+          ErigonRpcApi{io_context, logs_query_timeout},
+          TraceRpcApi{io_context, workers, trace_filter_max_blocks},
           EngineRpcApi(io_context),
           TxPoolRpcApi(io_context),
-          OtsRpcApi{io_context, workers} {}
+          OtsRpcApi{io_context, workers, logs_query_timeout} {}
 
     ~RpcApi() override = default;
 
@@ -67,7 +67,7 @@ Task<void> TraceRpcApi::handle_trace_call(const nlohmann::json& request, nlohman
         const bool is_latest_block = co_await core::is_latest_block_number(block_with_hash->block.header.number, tx_database);
         const core::rawdb::DatabaseReader& db_reader =
             is_latest_block ? static_cast<core::rawdb::DatabaseReader&>(cached_database) : static_cast<core::rawdb::DatabaseReader&>(tx_database);
-        trace::TraceCallExecutor executor{*block_cache_, db_reader, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, db_reader, *chain_storage, workers_, *tx, sender_cache_};
         const auto result = co_await executor.trace_call(block_with_hash->block, call, config);
 
         if (result.pre_check_error) {
@@ -117,7 +117,7 @@ Task<void> TraceRpcApi::handle_trace_call_many(const nlohmann::json& request, nl
 
         const core::rawdb::DatabaseReader& db_reader =
             is_latest_block ? static_cast<core::rawdb::DatabaseReader&>(cached_database) : static_cast<core::rawdb::DatabaseReader&>(tx_database);
-        trace::TraceCallExecutor executor{*block_cache_, db_reader, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, db_reader, *chain_storage, workers_, *tx, sender_cache_};
         const auto result = co_await executor.trace_calls(block_with_hash->block, trace_calls);
 
         if (result.pre_check_error) {
@@ -207,7 +207,7 @@ Task<void> TraceRpcApi::handle_trace_raw_transaction(const nlohmann::json& reque
             co_return;
         }
 
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
         const auto result = co_await executor.trace_transaction(block_with_hash->block, transaction, config);
 
         if (result.pre_check_error) {
@@ -248,7 +248,7 @@ Task<void> TraceRpcApi::handle_trace_replay_block_transactions(const nlohmann::j
         const auto chain_storage = tx->create_storage(tx_database, backend_);
         const auto block_with_hash = co_await core::read_block_by_number_or_hash(*block_cache_, *chain_storage, tx_database, block_number_or_hash);
         if (block_with_hash) {
-            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
             const auto result = co_await executor.trace_block_transactions(block_with_hash->block, config);
             reply = make_json_content(request, result);
         } else {
@@ -291,7 +291,7 @@ Task<void> TraceRpcApi::handle_trace_replay_transaction(const nlohmann::json& re
             oss << "transaction " << silkworm::to_hex(transaction_hash, true) << " not found";
             reply = make_json_error(request, -32000, oss.str());
         } else {
-            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
             const auto result = co_await executor.trace_transaction(tx_with_block->block_with_hash.block, tx_with_block->transaction, config);
 
             if (result.pre_check_error) {
@@ -337,7 +337,7 @@ Task<void> TraceRpcApi::handle_trace_block(const nlohmann::json& request, nlohma
             co_return;
         }
 
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
         trace::Filter filter;
         const auto result = co_await executor.trace_block(*block_with_hash, filter);
         reply = make_json_content(request, result);
@@ -378,9 +378,9 @@ Task<void> TraceRpcApi::handle_trace_filter(const nlohmann::json& request, json:
         ethdb::TransactionDatabase tx_database{*tx};
         const auto chain_storage = tx->create_storage(tx_database, backend_);
 
-        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+        trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
 
-        co_await executor.trace_filter(trace_filter, *chain_storage, &stream);
+        co_await executor.trace_filter(trace_filter, *chain_storage, &stream, trace_filter_max_blocks_);
     } catch (const std::exception& e) {
         SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
 
@@ -433,7 +433,7 @@ Task<void> TraceRpcApi::handle_trace_get(const nlohmann::json& request, nlohmann
         if (!tx_with_block) {
             reply = make_json_content(request);
         } else {
-            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
             const auto result = co_await executor.trace_transaction(tx_with_block->block_with_hash, tx_with_block->transaction);
 
             uint16_t index = indices[0] + 1;  // Erigon RpcDaemon compatibility
@@ -476,7 +476,7 @@ Task<void> TraceRpcApi::handle_trace_transaction(const nlohmann::json& request,
         if (!tx_with_block) {
             reply = make_json_content(request);
         } else {
-            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx};
+            trace::TraceCallExecutor executor{*block_cache_, tx_database, *chain_storage, workers_, *tx, sender_cache_};
             auto result = co_await executor.trace_transaction(tx_with_block->block_with_hash, tx_with_block->transaction);
             reply = make_json_content(request, result);
         }
@@ -25,7 +25,9 @@
 #include <silkworm/core/common/block_cache.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
@@ -40,13 +42,16 @@ namespace silkworm::rpc::commands {
 
 class TraceRpcApi {
   public:
-    TraceRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers)
+    TraceRpcApi(boost::asio::io_context& io_context, boost::asio::thread_pool& workers,
+                uint64_t trace_filter_max_blocks = kDefaultTraceFilterMaxBlocks)
         : io_context_(io_context),
           block_cache_{must_use_shared_service<BlockCache>(io_context_)},
+          sender_cache_{use_shared_service<SenderCache>(io_context_)},
           state_cache_{must_use_shared_service<ethdb::kv::StateCache>(io_context_)},
           database_{must_use_private_service<ethdb::Database>(io_context_)},
           workers_{workers},
-          backend_{must_use_private_service<ethbackend::BackEnd>(io_context_)} {}
+          backend_{must_use_private_service<ethbackend::BackEnd>(io_context_)},
+          trace_filter_max_blocks_{trace_filter_max_blocks} {}
 
     virtual ~TraceRpcApi() = default;
 
@@ -68,10 +73,12 @@ class TraceRpcApi {
   private:
     boost::asio::io_context& io_context_;
     BlockCache* block_cache_;
+    SenderCache* sender_cache_;
     ethdb::kv::StateCache* state_cache_;
     ethdb::Database* database_;
     boost::asio::thread_pool& workers_;
     ethbackend::BackEnd* backend_;
+    uint64_t trace_filter_max_blocks_;
 
     friend class silkworm::http::RequestHandler;
 };
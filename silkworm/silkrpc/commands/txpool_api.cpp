@@ -63,6 +63,7 @@ Task<void> TxPoolRpcApi::handle_txpool_content(const nlohmann::json& request, nl
                 error = true;
                 break;
             }
+            txn.from = txpool_transactions[i].sender;
             txn.queued_in_pool = true;
             if (txpool_transactions[i].transaction_type == txpool::TransactionType::QUEUED) {
                 transactions_content["queued"][sender].insert(std::make_pair(std::to_string(txn.nonce), txn));
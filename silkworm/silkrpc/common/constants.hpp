@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 namespace silkworm {
 
@@ -43,9 +44,14 @@ constexpr const char* kDefaultPrivateApiAddr{"localhost:9090"};
 constexpr const char* kDefaultEth1ApiSpec{"admin,debug,eth,net,parity,erigon,trace,web3,txpool"};
 constexpr const char* kDefaultEth2ApiSpec{"engine,eth"};
 constexpr const std::chrono::milliseconds kDefaultTimeout{10000};
+constexpr const std::chrono::milliseconds kDefaultLogsQueryTimeout{60000};
+constexpr const uint64_t kDefaultTraceFilterMaxBlocks{10000};
 
 constexpr const std::size_t kHttpIncomingBufferSize{8192};
 
+//! The min reply content size to be worth compressing when the client accepts it
+constexpr const std::size_t kHttpMinCompressedContentSize{1024};
+
 constexpr const std::size_t kRequestContentInitialCapacity{1024};
 constexpr const std::size_t kRequestHeadersInitialCapacity{8};
 constexpr const std::size_t kRequestMethodInitialCapacity{64};
@@ -16,7 +16,11 @@
 
 #include "account_dumper.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <exception>
 #include <utility>
+#include <vector>
 
 #include <silkworm/core/common/decoding_result.hpp>
 #include <silkworm/core/trie/hash_builder.hpp>
@@ -24,6 +28,7 @@
 #include <silkworm/core/types/address.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/db/util.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
@@ -33,6 +38,7 @@
 #include <silkworm/silkrpc/core/storage_walker.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/ethdb/view_transactions.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
 namespace silkworm::rpc::core {
@@ -79,7 +85,7 @@ Task<DumpAccounts> AccountDumper::dump_accounts(
     AccountWalker walker{transaction_};
     co_await walker.walk_of_accounts(block_number + 1, start_address, collector);
 
-    co_await load_accounts(tx_database, collected_data, dump_accounts, exclude_code);
+    co_await load_accounts(collected_data, dump_accounts, exclude_code);
     if (!exclude_storage) {
         co_await load_storage(block_number, dump_accounts);
     }
@@ -87,12 +93,10 @@ Task<DumpAccounts> AccountDumper::dump_accounts(
     co_return dump_accounts;
 }
 
-Task<void> AccountDumper::load_accounts(ethdb::TransactionDatabase& tx_database,
-                                        const std::vector<silkworm::KeyValue>& collected_data, DumpAccounts& dump_accounts, bool exclude_code) {
-    StateReader state_reader{tx_database};
+Task<void> AccountDumper::load_accounts(const std::vector<silkworm::KeyValue>& collected_data, DumpAccounts& dump_accounts, bool exclude_code) {
+    std::vector<std::pair<evmc::address, DumpAccount>> accounts;
+    accounts.reserve(collected_data.size());
     for (const auto& kv : collected_data) {
-        const auto address = bytes_to_address(kv.key);
-
         auto account{silkworm::Account::from_encoded_storage(kv.value)};
         silkworm::success_or_throw(account);
 
@@ -101,61 +105,118 @@ Task<void> AccountDumper::load_accounts(ethdb::TransactionDatabase& tx_database,
         dump_account.nonce = account->nonce;
         dump_account.code_hash = account->code_hash;
         dump_account.incarnation = account->incarnation;
+        accounts.emplace_back(bytes_to_address(kv.key), std::move(dump_account));
+    }
 
-        if (account->incarnation > 0 && account->code_hash == silkworm::kEmptyHash) {
-            const auto storage_key{silkworm::db::storage_prefix(full_view(address), account->incarnation)};
-            auto code_hash{co_await tx_database.get_one(db::table::kPlainCodeHashName, storage_key)};
-            if (code_hash.length() == silkworm::kHashLength) {
-                std::memcpy(dump_account.code_hash.bytes, code_hash.data(), silkworm::kHashLength);
+    co_await load_in_parallel(accounts.size(), [&](ethdb::Transaction& tx, std::size_t begin, std::size_t end) -> Task<void> {
+        ethdb::TransactionDatabase tx_database{tx};
+        for (auto i{begin}; i < end; ++i) {
+            auto& [address, dump_account] = accounts[i];
+            if (dump_account.incarnation > 0 && dump_account.code_hash == silkworm::kEmptyHash) {
+                const auto storage_key{silkworm::db::storage_prefix(full_view(address), dump_account.incarnation)};
+                auto code_hash{co_await tx_database.get_one(db::table::kPlainCodeHashName, storage_key)};
+                if (code_hash.length() == silkworm::kHashLength) {
+                    std::memcpy(dump_account.code_hash.bytes, code_hash.data(), silkworm::kHashLength);
+                }
+            }
+        }
+    });
+
+    if (!exclude_code) {
+        // Many contracts share the same code (e.g. proxies, clones), so read it just once for each code hash
+        std::vector<evmc::bytes32> code_hashes;
+        for (const auto& [_, dump_account] : accounts) {
+            if (dump_account.code_hash != silkworm::kEmptyHash) {
+                code_hashes.push_back(dump_account.code_hash);
             }
         }
-        if (!exclude_code) {
-            auto code = co_await state_reader.read_code(account->code_hash);
-            dump_account.code.swap(code);
+        std::sort(code_hashes.begin(), code_hashes.end());
+        code_hashes.erase(std::unique(code_hashes.begin(), code_hashes.end()), code_hashes.end());
+
+        std::vector<std::optional<silkworm::Bytes>> codes(code_hashes.size());
+        co_await load_in_parallel(code_hashes.size(), [&](ethdb::Transaction& tx, std::size_t begin, std::size_t end) -> Task<void> {
+            ethdb::TransactionDatabase tx_database{tx};
+            StateReader state_reader{tx_database};
+            for (auto i{begin}; i < end; ++i) {
+                codes[i] = co_await state_reader.read_code(code_hashes[i]);
+            }
+        });
+
+        for (auto& [_, dump_account] : accounts) {
+            const auto code_it{std::lower_bound(code_hashes.cbegin(), code_hashes.cend(), dump_account.code_hash)};
+            if (code_it != code_hashes.cend() && *code_it == dump_account.code_hash) {
+                dump_account.code = codes[static_cast<std::size_t>(code_it - code_hashes.cbegin())];
+            }
         }
-        dump_accounts.accounts.insert(std::pair<evmc::address, DumpAccount>(address, dump_account));
     }
 
-    co_return;
+    for (auto& [address, dump_account] : accounts) {
+        dump_accounts.accounts.emplace(address, std::move(dump_account));
+    }
 }
 
-Task<void> AccountDumper::load_storage(BlockNum block_number, DumpAccounts& dump_accounts) {
-    SILK_TRACE << "block_number " << block_number << " START";
-    StorageWalker storage_walker{transaction_};
+static Task<void> load_account_storage(StorageWalker& storage_walker, BlockNum block_number, const evmc::address& address, DumpAccount& account) {
+    std::map<silkworm::Bytes, silkworm::Bytes> collected_entries;
+    StorageWalker::AccountCollector collector = [&](const evmc::address& /*address*/, silkworm::ByteView loc, silkworm::ByteView data) {
+        if (!account.storage.has_value()) {
+            account.storage = Storage{};
+        }
+        auto& storage = *account.storage;
+        storage[silkworm::to_bytes32(loc)] = data;
+        auto hash = hash_of(loc);
+        auto key = full_view(hash);
+        collected_entries[silkworm::Bytes{key}] = data;
+
+        return true;
+    };
+
     evmc::bytes32 start_location{};
-    for (auto& it : dump_accounts.accounts) {
-        auto& address = it.first;
-        auto& account = it.second;
-
-        std::map<silkworm::Bytes, silkworm::Bytes> collected_entries;
-        StorageWalker::AccountCollector collector = [&](const evmc::address& /*address*/, silkworm::ByteView loc, silkworm::ByteView data) {
-            if (!account.storage.has_value()) {
-                account.storage = Storage{};
-            }
-            auto& storage = *account.storage;
-            storage[silkworm::to_bytes32(loc)] = data;
-            auto hash = hash_of(loc);
-            auto key = full_view(hash);
-            collected_entries[silkworm::Bytes{key}] = data;
+    co_await storage_walker.walk_of_storages(block_number, address, start_location, account.incarnation, collector);
 
-            return true;
-        };
+    silkworm::trie::HashBuilder hb;
+    for (const auto& [key, value] : collected_entries) {
+        silkworm::Bytes encoded{};
+        silkworm::rlp::encode(encoded, value);
+        silkworm::Bytes unpacked = silkworm::trie::unpack_nibbles(key);
 
-        co_await storage_walker.walk_of_storages(block_number, address, start_location, account.incarnation, collector);
+        hb.add_leaf(unpacked, encoded);
+    }
 
-        silkworm::trie::HashBuilder hb;
-        for (const auto& [key, value] : collected_entries) {
-            silkworm::Bytes encoded{};
-            silkworm::rlp::encode(encoded, value);
-            silkworm::Bytes unpacked = silkworm::trie::unpack_nibbles(key);
+    account.root = hb.root_hash();
+}
 
-            hb.add_leaf(unpacked, encoded);
+Task<void> AccountDumper::load_storage(BlockNum block_number, DumpAccounts& dump_accounts) {
+    SILK_TRACE << "block_number " << block_number << " START";
+    std::vector<AccountsMap::value_type*> accounts;
+    accounts.reserve(dump_accounts.accounts.size());
+    for (auto& entry : dump_accounts.accounts) {
+        accounts.push_back(&entry);
+    }
+
+    co_await load_in_parallel(accounts.size(), [&](ethdb::Transaction& tx, std::size_t begin, std::size_t end) -> Task<void> {
+        StorageWalker storage_walker{tx};
+        for (auto i{begin}; i < end; ++i) {
+            co_await load_account_storage(storage_walker, block_number, accounts[i]->first, accounts[i]->second);
         }
+    });
+    SILK_TRACE << "block_number " << block_number << " END";
+}
 
-        account.root = hb.root_hash();
+Task<void> AccountDumper::load_in_parallel(std::size_t count, RangeLoader load_range) {
+    const auto num_loads{std::min(kMaxConcurrentAccountLoads, (count + kMinItemsPerAccountLoad - 1) / kMinItemsPerAccountLoad)};
+    if (!database_ || num_loads <= 1) {
+        co_await load_range(transaction_, 0, count);
+        co_return;
     }
-    SILK_TRACE << "block_number " << block_number << " END";
-    co_return;
+
+    // The dump would mix up different states if the concurrent loads did not see the view of the dump transaction
+    co_await ethdb::with_view_transactions(*database_, transaction_, num_loads, [&](const std::vector<ethdb::Transaction*>& view_txs) -> Task<void> {
+        const auto range_size{(count + view_txs.size() - 1) / view_txs.size()};
+        co_await concurrency::generate_parallel_group_task(view_txs.size(), [&](std::size_t load) {
+            const auto begin{std::min(load * range_size, count)};
+            return load_range(*view_txs[load], begin, std::min(begin + range_size, count));
+        });
+    });
 }
 
 }  // namespace silkworm::rpc::core
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <absl/functional/function_ref.h>
 #include <evmc/evmc.hpp>
 #include <nlohmann/json.hpp>
 
@@ -38,9 +40,18 @@
 
 namespace silkworm::rpc::core {
 
+//! Max number of transactions used to load account code and storage concurrently
+inline constexpr std::size_t kMaxConcurrentAccountLoads{8};
+
+//! Min number of items (accounts or codes) loaded by each concurrent transaction
+inline constexpr std::size_t kMinItemsPerAccountLoad{8};
+
 class AccountDumper {
   public:
-    explicit AccountDumper(ethdb::Transaction& transaction) : transaction_(transaction) {}
+    //! Dump accounts using the transaction only or, if a database is given, also its own additional transactions
+    //! on the same view to load account code and storage concurrently
+    explicit AccountDumper(ethdb::Transaction& transaction, ethdb::Database* database = nullptr)
+        : transaction_(transaction), database_(database) {}
 
     AccountDumper(const AccountDumper&) = delete;
     AccountDumper& operator=(const AccountDumper&) = delete;
@@ -55,10 +66,14 @@ class AccountDumper {
         bool exclude_storage);
 
   private:
-    Task<void> load_accounts(ethdb::TransactionDatabase& tx_database, const std::vector<silkworm::KeyValue>& collected_data, DumpAccounts& dump_accounts, bool exclude_code);
+    using RangeLoader = absl::FunctionRef<Task<void>(ethdb::Transaction&, std::size_t, std::size_t)>;
+
+    Task<void> load_accounts(const std::vector<silkworm::KeyValue>& collected_data, DumpAccounts& dump_accounts, bool exclude_code);
     Task<void> load_storage(BlockNum block_number, DumpAccounts& dump_accounts);
+    Task<void> load_in_parallel(std::size_t count, RangeLoader load_range);
 
     ethdb::Transaction& transaction_;
+    ethdb::Database* database_;
 };
 
 }  // namespace silkworm::rpc::core
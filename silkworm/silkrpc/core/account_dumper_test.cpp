@@ -16,9 +16,12 @@
 
 #include "account_dumper.hpp"
 
+#include <bit>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/thread_pool.hpp>
@@ -28,8 +31,12 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/rlp/encode.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/test/context.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
+#include <silkworm/silkrpc/ethdb/file/local_database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 
 namespace silkworm::rpc {
@@ -611,4 +618,125 @@ TEST_CASE("account dumper") {
 }
 #endif
 
+TEST_CASE("AccountDumper loads code and storage concurrently", "[silkrpc][core][account_dumper]") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    silkworm::test::Context context;
+    boost::asio::thread_pool pool{1};
+    BlockCache block_cache(100, true);
+
+    BlockHeader header;
+    header.number = 1;
+    header.state_root = 0x00000000000000000000000000000000000000000000000000000000000000aa_bytes32;
+    const auto block_hash{header.hash()};
+    db::write_header(context.rw_txn(), header, /*with_header_numbers=*/true);
+    db::write_canonical_header_hash(context.rw_txn(), block_hash.bytes, header.number);
+    db::write_body(context.rw_txn(), BlockBody{}, block_hash.bytes, header.number);
+
+    // More accounts than loaded by a single transaction: 1 out of 3 is an EOA, the contracts share just two codes
+    // and some of them have their code hash just in the PlainCodeHash table
+    constexpr std::size_t kNumAccounts{3 * core::kMinItemsPerAccountLoad + 1};
+    const Bytes code_a{*from_hex("600160005500")};
+    const Bytes code_b{*from_hex("600260005500")};
+    const auto code_hash_a{std::bit_cast<evmc_bytes32>(keccak256(code_a))};
+    const auto code_hash_b{std::bit_cast<evmc_bytes32>(keccak256(code_b))};
+    const evmc::bytes32 location{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+    const auto make_address = [](std::size_t i) {
+        evmc::address address;
+        address.bytes[kAddressLength - 1] = static_cast<uint8_t>(i + 1);
+        return address;
+    };
+    const auto make_value = [](std::size_t i) {
+        evmc::bytes32 value;
+        value.bytes[kHashLength - 1] = static_cast<uint8_t>(i + 1);
+        return value;
+    };
+    const auto is_contract = [](std::size_t i) { return i % 3 != 0; };
+    const auto code_of = [&](std::size_t i) { return i % 2 == 0 ? std::make_pair(code_hash_a, code_a) : std::make_pair(code_hash_b, code_b); };
+
+    db::Buffer buffer{context.rw_txn(), 0};
+    buffer.begin_block(header.number);
+    for (std::size_t i{0}; i < kNumAccounts; ++i) {
+        Account account{.nonce = i, .balance = i * 1'000};
+        if (is_contract(i)) {
+            const auto& [code_hash, code] = code_of(i);
+            account.incarnation = 1;
+            if (i % 3 == 1) {
+                account.code_hash = code_hash;
+            }
+            buffer.update_account_code(make_address(i), 1, code_hash, code);
+            buffer.update_storage(make_address(i), 1, location, {}, make_value(i));
+        }
+        buffer.update_account(make_address(i), std::nullopt, account);
+    }
+    buffer.write_to_db(/*write_change_sets=*/false);
+    context.commit_and_renew_txn();
+
+    ethdb::file::LocalDatabase database{context.env()};
+    const auto begin = [&]() {
+        return boost::asio::co_spawn(pool, database.begin(), boost::asio::use_future).get();
+    };
+    const auto dump = [&](ethdb::Transaction& tx, ethdb::Database* concurrent_database) {
+        core::AccountDumper dumper{tx, concurrent_database};
+        return boost::asio::co_spawn(pool,
+                                     dumper.dump_accounts(block_cache, BlockNumberOrHash{header.number}, /*backend=*/nullptr,
+                                                          /*start_address=*/{}, /*max_result=*/100,
+                                                          /*exclude_code=*/false, /*exclude_storage=*/false),
+                                     boost::asio::use_future)
+            .get();
+    };
+    const auto check_accounts = [&](const DumpAccounts& dump_accounts) {
+        CHECK(dump_accounts.root == header.state_root);
+        REQUIRE(dump_accounts.accounts.size() == kNumAccounts);
+        for (std::size_t i{0}; i < kNumAccounts; ++i) {
+            const auto& account{dump_accounts.accounts.at(make_address(i))};
+            CHECK(account.nonce == i);
+            CHECK(account.balance == intx::uint256{i * 1'000});
+            if (is_contract(i)) {
+                const auto& [code_hash, code] = code_of(i);
+                CHECK(account.incarnation == 1);
+                CHECK(account.code_hash == code_hash);
+                CHECK(account.code == code);
+                REQUIRE(account.storage);
+                CHECK(*account.storage == Storage{{location, Bytes{static_cast<uint8_t>(i + 1)}}});
+            } else {
+                CHECK(account.code_hash == kEmptyHash);
+                CHECK_FALSE(account.code);
+                CHECK_FALSE(account.storage);
+            }
+        }
+    };
+
+    SECTION("same result as loading on the dump transaction only") {
+        auto tx = begin();
+        const auto concurrent_dump{dump(*tx, &database)};
+        check_accounts(concurrent_dump);
+        CHECK(nlohmann::json(concurrent_dump) == nlohmann::json(dump(*tx, nullptr)));
+        boost::asio::co_spawn(pool, tx->close(), boost::asio::use_future).get();
+    }
+
+    SECTION("state changes after the dump transaction began are not seen") {
+        auto tx = begin();
+
+        db::Buffer changes{context.rw_txn(), 0};
+        changes.begin_block(header.number + 1);
+        for (std::size_t i{0}; i < kNumAccounts; ++i) {
+            if (is_contract(i)) {
+                changes.update_account_code(make_address(i), 1, code_hash_b, code_b);
+                changes.update_storage(make_address(i), 1, location, make_value(i), make_value(kNumAccounts));
+            }
+            changes.update_account(make_address(i), std::nullopt, Account{.nonce = i + 1, .incarnation = is_contract(i) ? 1u : 0u});
+        }
+        changes.write_to_db(/*write_change_sets=*/false);
+        context.commit_and_renew_txn();
+
+        check_accounts(dump(*tx, &database));
+        boost::asio::co_spawn(pool, tx->close(), boost::asio::use_future).get();
+
+        // The changes are there for any new transaction
+        auto new_tx = begin();
+        CHECK(dump(*new_tx, &database).accounts.at(make_address(0)).nonce == 1);
+        boost::asio::co_spawn(pool, new_tx->close(), boost::asio::use_future).get();
+    }
+}
+
 }  // namespace silkworm::rpc
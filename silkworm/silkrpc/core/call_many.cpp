@@ -39,6 +39,7 @@
 #include <silkworm/silkrpc/core/override_state.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
 #include <silkworm/silkrpc/core/remote_state.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
@@ -65,9 +66,7 @@ CallManyResult CallExecutor::executes_all_bundles(const silkworm::ChainConfig& c
     for (auto idx{0}; idx < transaction_index; idx++) {
         silkworm::Transaction txn{block_transactions[std::size_t(idx)]};
 
-        if (!txn.from) {
-            txn.recover_sender();
-        }
+        recover_sender(txn, sender_cache_);
 
         auto exec_result = executor.call(block, txn);
 
@@ -32,6 +32,7 @@
 #include <silkworm/core/state/intra_block_state.hpp>
 #include <silkworm/silkrpc/core/evm_executor.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/types/block.hpp>
@@ -51,8 +52,9 @@ class CallExecutor {
         ethdb::Transaction& transaction,
         BlockCache& block_cache,
         boost::asio::thread_pool& workers,
-        ethbackend::BackEnd* backend)
-        : transaction_(transaction), block_cache_(block_cache), workers_{workers}, backend_{backend} {}
+        ethbackend::BackEnd* backend,
+        SenderCache* sender_cache = nullptr)
+        : transaction_(transaction), block_cache_(block_cache), workers_{workers}, backend_{backend}, sender_cache_{sender_cache} {}
     virtual ~CallExecutor() = default;
 
     CallExecutor(const CallExecutor&) = delete;
@@ -79,5 +81,6 @@ class CallExecutor {
     BlockCache& block_cache_;
     boost::asio::thread_pool& workers_;
     ethbackend::BackEnd* backend_;
+    SenderCache* sender_cache_;
 };
 }  // namespace silkworm::rpc::call
@@ -0,0 +1,186 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "checkpoint_state.hpp"
+
+#include <utility>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/silkrpc/core/evm_executor.hpp>
+
+namespace silkworm::rpc::state {
+
+std::optional<silkworm::Account> SynchronizedState::read_account(const evmc::address& address) const noexcept {
+    std::scoped_lock lock{mutex_};
+    if (const auto it{accounts_.find(address)}; it != accounts_.end()) {
+        return it->second;
+    }
+    auto account{inner_state_->read_account(address)};
+    accounts_.emplace(address, account);
+    return account;
+}
+
+silkworm::ByteView SynchronizedState::read_code(const evmc::bytes32& code_hash) const noexcept {
+    std::scoped_lock lock{mutex_};
+    if (const auto it{code_.find(code_hash)}; it != code_.end()) {
+        return it->second;
+    }
+    const auto [it, _] = code_.emplace(code_hash, inner_state_->read_code(code_hash));
+    return it->second;
+}
+
+evmc::bytes32 SynchronizedState::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
+    std::scoped_lock lock{mutex_};
+    StorageLocationKey key{address, incarnation, location};
+    if (const auto it{storage_.find(key)}; it != storage_.end()) {
+        return it->second;
+    }
+    const auto value{inner_state_->read_storage(address, incarnation, location)};
+    storage_.emplace(std::move(key), value);
+    return value;
+}
+
+uint64_t SynchronizedState::previous_incarnation(const evmc::address& address) const noexcept {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->previous_incarnation(address);
+}
+
+std::optional<silkworm::BlockHeader> SynchronizedState::read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->read_header(block_number, block_hash);
+}
+
+bool SynchronizedState::read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->read_body(block_number, block_hash, out);
+}
+
+std::optional<intx::uint256> SynchronizedState::total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->total_difficulty(block_number, block_hash);
+}
+
+evmc::bytes32 SynchronizedState::state_root_hash() const {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->state_root_hash();
+}
+
+BlockNum SynchronizedState::current_canonical_block() const {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->current_canonical_block();
+}
+
+std::optional<evmc::bytes32> SynchronizedState::canonical_hash(BlockNum block_number) const {
+    std::scoped_lock lock{mutex_};
+    return inner_state_->canonical_hash(block_number);
+}
+
+//! Find the most recent value for the given key in the specified map of the checkpoint layers, if any
+template <typename Map, typename Key>
+static const typename Map::mapped_type* find_latest(const StateCheckpoint* layer, Map StateCheckpoint::*map, const Key& key) {
+    for (; layer != nullptr; layer = layer->previous.get()) {
+        const Map& values{layer->*map};
+        if (const auto it{values.find(key)}; it != values.end()) {
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<const StateCheckpoint> CheckpointState::take_checkpoint() {
+    if (!next_checkpoint_->empty()) {
+        checkpoint_ = std::exchange(next_checkpoint_, std::make_shared<StateCheckpoint>());
+        next_checkpoint_->previous = checkpoint_;
+    }
+    return checkpoint_;
+}
+
+std::optional<silkworm::Account> CheckpointState::read_account(const evmc::address& address) const noexcept {
+    if (const auto account{find_latest(next_checkpoint_.get(), &StateCheckpoint::accounts, address)}) {
+        return *account;
+    }
+    return inner_state_.read_account(address);
+}
+
+silkworm::ByteView CheckpointState::read_code(const evmc::bytes32& code_hash) const noexcept {
+    if (const auto code{find_latest(next_checkpoint_.get(), &StateCheckpoint::code, code_hash)}) {
+        return *code;
+    }
+    return inner_state_.read_code(code_hash);
+}
+
+evmc::bytes32 CheckpointState::read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept {
+    const StorageLocationKey key{address, incarnation, location};
+    if (const auto value{find_latest(next_checkpoint_.get(), &StateCheckpoint::storage, key)}) {
+        return *value;
+    }
+    return inner_state_.read_storage(address, incarnation, location);
+}
+
+uint64_t CheckpointState::previous_incarnation(const evmc::address& address) const noexcept {
+    if (const auto incarnation{find_latest(next_checkpoint_.get(), &StateCheckpoint::previous_incarnations, address)}) {
+        return *incarnation;
+    }
+    return inner_state_.previous_incarnation(address);
+}
+
+void CheckpointState::update_account(const evmc::address& address, std::optional<silkworm::Account> initial,
+                                     std::optional<silkworm::Account> current) {
+    if (!current && initial && initial->incarnation > 0) {
+        next_checkpoint_->previous_incarnations[address] = initial->incarnation;
+    }
+    next_checkpoint_->accounts[address] = current;
+}
+
+void CheckpointState::update_account_code(const evmc::address& /*address*/, uint64_t /*incarnation*/,
+                                          const evmc::bytes32& code_hash, silkworm::ByteView code) {
+    next_checkpoint_->code.try_emplace(code_hash, code);
+}
+
+void CheckpointState::update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                                     const evmc::bytes32& /*initial*/, const evmc::bytes32& current) {
+    next_checkpoint_->storage[StorageLocationKey{address, incarnation, location}] = current;
+}
+
+std::vector<std::shared_ptr<const StateCheckpoint>> collect_checkpoints(
+    const silkworm::ChainConfig& config,
+    boost::asio::thread_pool& workers,
+    silkworm::State& block_state,
+    const silkworm::Block& block,
+    const std::vector<silkworm::Transaction>& transactions,
+    bool refund,
+    bool gas_bailout) {
+    auto checkpoint_state = std::make_shared<CheckpointState>(block_state);
+    std::shared_ptr<silkworm::State> state{checkpoint_state};
+    EVMExecutor executor{config, workers, state};
+
+    std::vector<std::shared_ptr<const StateCheckpoint>> checkpoints;
+    checkpoints.reserve(transactions.size());
+    for (std::size_t index{0}; index < transactions.size(); ++index) {
+        checkpoints.push_back(checkpoint_state->take_checkpoint());
+        executor.call(block, transactions[index], /*tracers=*/{}, refund, gas_bailout);
+        // Each layer gets just the changes of its own transaction, the last one is never read
+        if (index + 1 < transactions.size()) {
+            executor.write_state_changes(block.header.number);
+        }
+        executor.reset();
+    }
+    SILK_DEBUG << "collect_checkpoints block_number: " << block.header.number << " #checkpoints: " << checkpoints.size();
+
+    return checkpoints;
+}
+
+}  // namespace silkworm::rpc::state
@@ -0,0 +1,220 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/thread_pool.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/state/state.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/core/types/transaction.hpp>
+
+namespace silkworm::rpc::state {
+
+using StorageLocationKey = std::tuple<evmc::address, uint64_t, evmc::bytes32>;
+
+//! The state changes made by some block transactions layered over the changes made by the preceding ones, so that
+//! the state since the beginning of the block is shared among all the checkpoints instead of being copied each time
+struct StateCheckpoint {
+    std::unordered_map<evmc::address, std::optional<silkworm::Account>> accounts;
+    std::unordered_map<evmc::address, uint64_t> previous_incarnations;
+    std::unordered_map<evmc::bytes32, silkworm::Bytes> code;
+    std::map<StorageLocationKey, evmc::bytes32> storage;
+
+    //! The checkpoint taken before the changes in this one, null for the first one in the block
+    std::shared_ptr<const StateCheckpoint> previous;
+
+    [[nodiscard]] bool empty() const {
+        return accounts.empty() && previous_incarnations.empty() && code.empty() && storage.empty();
+    }
+};
+
+//! State read-only view serializing all the reads on the inner state and caching account, code and storage values.
+//! Many executions running on distinct threads can share it to read the same block state just once.
+class SynchronizedState : public silkworm::State {
+  public:
+    explicit SynchronizedState(std::shared_ptr<silkworm::State> inner_state) : inner_state_{std::move(inner_state)} {}
+
+    std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
+
+    silkworm::ByteView read_code(const evmc::bytes32& code_hash) const noexcept override;
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept override;
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override;
+
+    std::optional<silkworm::BlockHeader> read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override;
+
+    bool read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept override;
+
+    std::optional<intx::uint256> total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override;
+
+    evmc::bytes32 state_root_hash() const override;
+
+    BlockNum current_canonical_block() const override;
+
+    std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override;
+
+    void insert_block(const silkworm::Block& /*block*/, const evmc::bytes32& /*hash*/) override {}
+
+    void canonize_block(BlockNum /*block_number*/, const evmc::bytes32& /*block_hash*/) override {}
+
+    void decanonize_block(BlockNum /*block_number*/) override {}
+
+    void insert_receipts(BlockNum /*block_number*/, const std::vector<silkworm::Receipt>& /*receipts*/) override {}
+
+    void insert_call_traces(BlockNum /*block_number*/, const CallTraces& /*traces*/) override {}
+
+    void begin_block(BlockNum /*block_number*/) override {}
+
+    void update_account(
+        const evmc::address& /*address*/,
+        std::optional<silkworm::Account> /*initial*/,
+        std::optional<silkworm::Account> /*current*/) override {}
+
+    void update_account_code(
+        const evmc::address& /*address*/,
+        uint64_t /*incarnation*/,
+        const evmc::bytes32& /*code_hash*/,
+        silkworm::ByteView /*code*/) override {}
+
+    void update_storage(
+        const evmc::address& /*address*/,
+        uint64_t /*incarnation*/,
+        const evmc::bytes32& /*location*/,
+        const evmc::bytes32& /*initial*/,
+        const evmc::bytes32& /*current*/) override {}
+
+    void unwind_state_changes(BlockNum /*block_number*/) override {}
+
+  private:
+    std::shared_ptr<silkworm::State> inner_state_;
+
+    mutable std::mutex mutex_;
+    mutable std::unordered_map<evmc::address, std::optional<silkworm::Account>> accounts_;
+    mutable std::unordered_map<evmc::bytes32, silkworm::Bytes> code_;
+    mutable std::map<StorageLocationKey, evmc::bytes32> storage_;
+};
+
+//! State reading first from the changes written here, then from one block checkpoint and finally from the inner state
+//! at the beginning of the same block. All the state changes written here are collected into a new checkpoint.
+class CheckpointState : public silkworm::State {
+  public:
+    explicit CheckpointState(silkworm::State& inner_state, std::shared_ptr<const StateCheckpoint> checkpoint = nullptr)
+        : inner_state_{inner_state}, checkpoint_{std::move(checkpoint)} {
+        next_checkpoint_->previous = checkpoint_;
+    }
+
+    //! Get the checkpoint including the state changes written so far and start collecting a new one on top of it
+    //! \remarks if no state change has been written since the last checkpoint, the same checkpoint is returned
+    std::shared_ptr<const StateCheckpoint> take_checkpoint();
+
+    std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
+
+    silkworm::ByteView read_code(const evmc::bytes32& code_hash) const noexcept override;
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location) const noexcept override;
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override;
+
+    std::optional<silkworm::BlockHeader> read_header(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override {
+        return inner_state_.read_header(block_number, block_hash);
+    }
+
+    bool read_body(BlockNum block_number, const evmc::bytes32& block_hash, silkworm::BlockBody& out) const noexcept override {
+        return inner_state_.read_body(block_number, block_hash, out);
+    }
+
+    std::optional<intx::uint256> total_difficulty(BlockNum block_number, const evmc::bytes32& block_hash) const noexcept override {
+        return inner_state_.total_difficulty(block_number, block_hash);
+    }
+
+    evmc::bytes32 state_root_hash() const override { return inner_state_.state_root_hash(); }
+
+    BlockNum current_canonical_block() const override { return inner_state_.current_canonical_block(); }
+
+    std::optional<evmc::bytes32> canonical_hash(BlockNum block_number) const override {
+        return inner_state_.canonical_hash(block_number);
+    }
+
+    void insert_block(const silkworm::Block& /*block*/, const evmc::bytes32& /*hash*/) override {}
+
+    void canonize_block(BlockNum /*block_number*/, const evmc::bytes32& /*block_hash*/) override {}
+
+    void decanonize_block(BlockNum /*block_number*/) override {}
+
+    void insert_receipts(BlockNum /*block_number*/, const std::vector<silkworm::Receipt>& /*receipts*/) override {}
+
+    void insert_call_traces(BlockNum /*block_number*/, const CallTraces& /*traces*/) override {}
+
+    void begin_block(BlockNum /*block_number*/) override {}
+
+    void update_account(
+        const evmc::address& address,
+        std::optional<silkworm::Account> initial,
+        std::optional<silkworm::Account> current) override;
+
+    void update_account_code(
+        const evmc::address& address,
+        uint64_t incarnation,
+        const evmc::bytes32& code_hash,
+        silkworm::ByteView code) override;
+
+    void update_storage(
+        const evmc::address& address,
+        uint64_t incarnation,
+        const evmc::bytes32& location,
+        const evmc::bytes32& initial,
+        const evmc::bytes32& current) override;
+
+    void unwind_state_changes(BlockNum /*block_number*/) override {}
+
+  private:
+    silkworm::State& inner_state_;
+    std::shared_ptr<const StateCheckpoint> checkpoint_;
+    std::shared_ptr<StateCheckpoint> next_checkpoint_{std::make_shared<StateCheckpoint>()};
+};
+
+//! Execute block transactions in sequence w/o any tracer to get the state checkpoint before each of them
+//! \param config the chain configuration
+//! \param workers the worker pool hosting the EVM execution services
+//! \param block_state the state at the beginning of the block
+//! \param block the block
+//! \param transactions the block transactions having their senders already recovered
+//! \param refund the flag indicating if gas refund is applied, same as in the subsequent executions
+//! \param gas_bailout the flag indicating if gas bailout is applied, same as in the subsequent executions
+//! \return the state checkpoint before each transaction, i.e. one item per transaction (the first one is null)
+std::vector<std::shared_ptr<const StateCheckpoint>> collect_checkpoints(
+    const silkworm::ChainConfig& config,
+    boost::asio::thread_pool& workers,
+    silkworm::State& block_state,
+    const silkworm::Block& block,
+    const std::vector<silkworm::Transaction>& transactions,
+    bool refund,
+    bool gas_bailout);
+
+}  // namespace silkworm::rpc::state
@@ -0,0 +1,223 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "checkpoint_state.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <boost/asio/thread_pool.hpp>
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+
+namespace silkworm::rpc::state {
+
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+static const evmc::address kAlice{0x00000000000000000000000000000000000000a1_address};
+static const evmc::address kBob{0x00000000000000000000000000000000000000b0_address};
+static const evmc::address kCarol{0x00000000000000000000000000000000000000c0_address};
+static const evmc::bytes32 kLocation{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+static const evmc::bytes32 kValue1{0x0000000000000000000000000000000000000000000000000000000000000011_bytes32};
+static const evmc::bytes32 kValue2{0x0000000000000000000000000000000000000000000000000000000000000022_bytes32};
+
+TEST_CASE("SynchronizedState", "[silkrpc][core][checkpoint_state]") {
+    auto inner_state = std::make_shared<InMemoryState>();
+    inner_state->begin_block(0);
+    inner_state->update_account(kAlice, std::nullopt, Account{.balance = 100, .incarnation = 1});
+    inner_state->update_storage(kAlice, 1, kLocation, {}, kValue1);
+    SynchronizedState state{inner_state};
+
+    SECTION("values are read just once") {
+        CHECK(state.read_account(kAlice)->balance == 100);
+        CHECK(state.read_storage(kAlice, 1, kLocation) == kValue1);
+        inner_state->update_account(kAlice, Account{.balance = 100, .incarnation = 1}, Account{.balance = 200, .incarnation = 1});
+        inner_state->update_storage(kAlice, 1, kLocation, kValue1, kValue2);
+        CHECK(state.read_account(kAlice)->balance == 100);
+        CHECK(state.read_storage(kAlice, 1, kLocation) == kValue1);
+    }
+
+    SECTION("missing values are cached too") {
+        CHECK_FALSE(state.read_account(kBob));
+        inner_state->update_account(kBob, std::nullopt, Account{.balance = 1});
+        CHECK_FALSE(state.read_account(kBob));
+    }
+
+    SECTION("storage is keyed by incarnation") {
+        CHECK(state.read_storage(kAlice, 1, kLocation) == kValue1);
+        CHECK(state.read_storage(kAlice, 2, kLocation) == evmc::bytes32{});
+    }
+
+    SECTION("previous incarnation") {
+        CHECK(state.previous_incarnation(kAlice) == 0);
+        inner_state->update_account(kAlice, Account{.balance = 100, .incarnation = 1}, std::nullopt);
+        CHECK(state.previous_incarnation(kAlice) == 1);
+    }
+}
+
+TEST_CASE("CheckpointState", "[silkrpc][core][checkpoint_state]") {
+    InMemoryState inner_state;
+    inner_state.begin_block(0);
+    const Account alice_account{.balance = 100, .incarnation = 1};
+    inner_state.update_account(kAlice, std::nullopt, alice_account);
+    inner_state.update_storage(kAlice, 1, kLocation, {}, kValue1);
+    CheckpointState state{inner_state};
+
+    SECTION("no checkpoint before any change") {
+        CHECK(state.take_checkpoint() == nullptr);
+        CHECK(state.read_account(kAlice) == alice_account);
+    }
+
+    SECTION("changes are read back before taking a checkpoint") {
+        state.update_account(kBob, std::nullopt, Account{.balance = 1});
+        CHECK(state.read_account(kBob)->balance == 1);
+        CHECK_FALSE(inner_state.read_account(kBob));
+    }
+
+    SECTION("checkpoints are layered") {
+        state.update_account(kBob, std::nullopt, Account{.balance = 1});
+        const auto checkpoint1{state.take_checkpoint()};
+        REQUIRE(checkpoint1);
+        CHECK(checkpoint1->previous == nullptr);
+
+        // No changes, no new layer
+        CHECK(state.take_checkpoint() == checkpoint1);
+
+        state.update_account(kCarol, std::nullopt, Account{.balance = 2});
+        state.update_account(kBob, Account{.balance = 1}, Account{.balance = 3});
+        const auto checkpoint2{state.take_checkpoint()};
+        REQUIRE(checkpoint2);
+        CHECK(checkpoint2->previous == checkpoint1);
+        // Each layer holds just its own changes
+        CHECK(checkpoint2->accounts.size() == 2);
+        CHECK(checkpoint1->accounts.size() == 1);
+
+        CheckpointState state1{inner_state, checkpoint1};
+        CHECK(state1.read_account(kAlice) == alice_account);
+        CHECK(state1.read_account(kBob)->balance == 1);
+        CHECK_FALSE(state1.read_account(kCarol));
+
+        CheckpointState state2{inner_state, checkpoint2};
+        CHECK(state2.read_account(kAlice) == alice_account);
+        CHECK(state2.read_account(kBob)->balance == 3);
+        CHECK(state2.read_account(kCarol)->balance == 2);
+
+        // Changes written on top of one checkpoint are not visible from the others
+        state2.update_account(kCarol, Account{.balance = 2}, std::nullopt);
+        CHECK_FALSE(state2.read_account(kCarol));
+        CHECK(CheckpointState{inner_state, checkpoint2}.read_account(kCarol)->balance == 2);
+    }
+
+    SECTION("self-destruct and re-creation") {
+        state.update_storage(kAlice, 1, kLocation, kValue1, kValue2);
+        const auto checkpoint1{state.take_checkpoint()};
+
+        // Self-destruct the account...
+        state.update_account(kAlice, Account{.balance = 100, .incarnation = 1}, std::nullopt);
+        const auto checkpoint2{state.take_checkpoint()};
+
+        // ...then create it again with the next incarnation
+        state.update_account(kAlice, std::nullopt, Account{.balance = 5, .incarnation = 2});
+        state.update_storage(kAlice, 2, kLocation, {}, kValue1);
+        const auto checkpoint3{state.take_checkpoint()};
+
+        CheckpointState state1{inner_state, checkpoint1};
+        CHECK(state1.read_account(kAlice) == alice_account);
+        CHECK(state1.previous_incarnation(kAlice) == 0);
+        CHECK(state1.read_storage(kAlice, 1, kLocation) == kValue2);
+
+        CheckpointState state2{inner_state, checkpoint2};
+        CHECK_FALSE(state2.read_account(kAlice));
+        CHECK(state2.previous_incarnation(kAlice) == 1);
+
+        CheckpointState state3{inner_state, checkpoint3};
+        CHECK(state3.read_account(kAlice)->incarnation == 2);
+        CHECK(state3.previous_incarnation(kAlice) == 1);
+        // The storage of each incarnation is kept apart
+        CHECK(state3.read_storage(kAlice, 2, kLocation) == kValue1);
+        CHECK(state3.read_storage(kAlice, 1, kLocation) == kValue2);
+        CHECK(state3.read_storage(kAlice, 2, kValue1) == evmc::bytes32{});
+    }
+
+    SECTION("code") {
+        const Bytes code{*from_hex("600160005500")};
+        const auto code_hash{0x00000000000000000000000000000000000000000000000000000000000000cc_bytes32};
+        state.update_account_code(kCarol, 1, code_hash, code);
+        const auto checkpoint1{state.take_checkpoint()};
+        state.update_account(kBob, std::nullopt, Account{.balance = 1});
+        const auto checkpoint2{state.take_checkpoint()};
+
+        CHECK(CheckpointState{inner_state, checkpoint2}.read_code(code_hash) == code);
+        CHECK(CheckpointState{inner_state}.read_code(code_hash).empty());
+    }
+}
+
+TEST_CASE("collect_checkpoints", "[silkrpc][core][checkpoint_state]") {
+    auto inner_state = std::make_shared<InMemoryState>();
+    inner_state->begin_block(0);
+    inner_state->update_account(kAlice, std::nullopt, Account{.balance = 1'000});
+    SynchronizedState block_state{inner_state};
+    boost::asio::thread_pool workers{4};
+
+    // Each transaction spends the value received by the previous one, so it must see the changes of all the previous
+    Block block;
+    block.header.number = 16'000'000;
+    block.header.gas_limit = 30'000'000;
+    block.header.base_fee_per_gas = 0;
+    const auto make_transfer = [](const evmc::address& from, const evmc::address& to, uint64_t value) {
+        Transaction txn;
+        txn.type = TransactionType::kLegacy;
+        txn.gas_limit = 21'000;
+        txn.from = from;
+        txn.to = to;
+        txn.value = value;
+        return txn;
+    };
+    block.transactions.push_back(make_transfer(kAlice, kBob, 100));
+    block.transactions.push_back(make_transfer(kBob, kCarol, 60));
+    block.transactions.push_back(make_transfer(kCarol, kAlice, 10));
+
+    const auto checkpoints{collect_checkpoints(kMainnetConfig, workers, block_state, block, block.transactions,
+                                               /*refund=*/true, /*gas_bailout=*/false)};
+    REQUIRE(checkpoints.size() == 3);
+    CHECK(checkpoints[0] == nullptr);
+    REQUIRE(checkpoints[1]);
+    REQUIRE(checkpoints[2]);
+    CHECK(checkpoints[2]->previous == checkpoints[1]);
+    // Each layer holds just the changes of the previous transaction
+    CHECK(checkpoints[1]->accounts.contains(kAlice));
+    CHECK_FALSE(checkpoints[2]->accounts.contains(kAlice));
+    CHECK(checkpoints[2]->accounts.contains(kCarol));
+
+    CheckpointState state1{block_state, checkpoints[1]};
+    CHECK(state1.read_account(kAlice)->balance == 900);
+    CHECK(state1.read_account(kAlice)->nonce == 1);
+    CHECK(state1.read_account(kBob)->balance == 100);
+    CHECK_FALSE(state1.read_account(kCarol));
+
+    CheckpointState state2{block_state, checkpoints[2]};
+    CHECK(state2.read_account(kAlice)->balance == 900);
+    CHECK(state2.read_account(kBob)->balance == 40);
+    CHECK(state2.read_account(kBob)->nonce == 1);
+    CHECK(state2.read_account(kCarol)->balance == 60);
+}
+
+}  // namespace silkworm::rpc::state
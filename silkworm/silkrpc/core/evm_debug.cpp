@@ -36,6 +36,7 @@
 #include <silkworm/silkrpc/core/cached_chain.hpp>
 #include <silkworm/silkrpc/core/evm_executor.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 
@@ -56,53 +57,18 @@ std::ostream& operator<<(std::ostream& out, const DebugConfig& tc) {
 }
 
 std::string uint256_to_hex(const evmone::uint256& x) {
-    std::stringstream ss;
-    ss << "0x";
-
-    bool leading_zeros = true;
-    const uint64_t* px = &x[0];
-    for (int i = 3; i >= 0; i--) {
-        if (px[i] == 0 && leading_zeros) {
-            continue;
-        }
-        if (leading_zeros) {
-            ss << std::hex << px[i];
-            leading_zeros = false;
-        } else {
-            ss << std::setfill('0') << std::setw(16) << std::hex << px[i];
-        }
-    }
-
-    if (leading_zeros) {
-        ss << "0";
-    }
-
-    return ss.str();
-}
-
-std::string get_opcode_name(const char* const* names, std::uint8_t opcode) {
-    const auto name = names[opcode];
-    return (name != nullptr) ? name : "opcode 0x" + evmc::hex(opcode) + " not defined";
+    std::string out;
+    append_quantity_hex(out, x);
+    return out;
 }
 
-static std::string EMPTY_MEMORY(64, '0');
-
-void output_stack(std::vector<std::string>& vect, const evmone::uint256* stack, uint32_t stack_size) {
-    vect.reserve(stack_size);
-    for (int i = int(stack_size - 1); i >= 0; --i) {
-        vect.push_back(uint256_to_hex(stack[-i]));
-    }
+std::string get_opcode_name(const OpcodeNameTable& names, std::uint8_t opcode) {
+    const auto& name = names[opcode];
+    return !name.empty() ? name : "opcode 0x" + evmc::hex(opcode) + " not defined";
 }
 
-void output_memory(std::vector<std::string>& vect, const evmone::Memory& memory) {
-    const std::size_t len = 32;
-    vect.reserve(memory.size() / len);
-
-    const auto data = memory.data();
-    for (std::size_t start = 0; start < memory.size(); start += len) {
-        vect.push_back(silkworm::to_hex({data + start, len}));
-    }
-}
+//! The size of each memory chunk in output
+static constexpr std::size_t kMemoryChunkSize{32};
 
 void insert_error(DebugLog& log, evmc_status_code status_code) {
     switch (status_code) {
@@ -119,7 +85,7 @@ void insert_error(DebugLog& log, evmc_status_code status_code) {
 
 void DebugTracer::on_execution_start(evmc_revision rev, const evmc_message& msg, evmone::bytes_view code) noexcept {
     if (opcode_names_ == nullptr) {
-        opcode_names_ = evmc_get_instruction_names_table(rev);
+        opcode_names_ = &opcode_name_table(rev);
     }
     start_gas_ = msg.gas;
     const evmc::address recipient(msg.recipient);
@@ -138,7 +104,7 @@ void DebugTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_t
     const evmc::address sender(execution_state.msg->sender);
 
     const auto opcode = execution_state.original_code[pc];
-    const auto opcode_name = get_opcode_name(opcode_names_, opcode);
+    const auto opcode_name = get_opcode_name(*opcode_names_, opcode);
 
     SILK_DEBUG << "on_instruction_start:"
                << " pc: " << std::dec << pc
@@ -155,24 +121,19 @@ void DebugTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_t
 
     bool output_storage = false;
     if (!config_.disableStorage) {
-        if (opcode_name == "SLOAD" && stack_height >= 1) {
-            const auto address = silkworm::bytes32_from_hex(intx::hex(stack_top[0]));
+        if (opcode == evmc_opcode::OP_SLOAD && stack_height >= 1) {
+            const auto address = intx::be::store<evmc::bytes32>(stack_top[0]);
             const auto value = intra_block_state.get_current_storage(recipient, address);
             storage_[recipient][silkworm::to_hex(address)] = silkworm::to_hex(value);
             output_storage = true;
-        } else if (opcode_name == "SSTORE" && stack_height >= 2) {
-            const auto address = silkworm::bytes32_from_hex(intx::hex(stack_top[0]));
-            const auto value = silkworm::bytes32_from_hex(intx::hex(stack_top[-1]));
+        } else if (opcode == evmc_opcode::OP_SSTORE && stack_height >= 2) {
+            const auto address = intx::be::store<evmc::bytes32>(stack_top[0]);
+            const auto value = intx::be::store<evmc::bytes32>(stack_top[-1]);
             storage_[recipient][silkworm::to_hex(address)] = silkworm::to_hex(value);
             output_storage = true;
         }
     }
 
-    std::vector<std::string> current_memory;
-    if (!config_.disableMemory) {
-        output_memory(current_memory, execution_state.memory);
-    }
-
     if (!logs_.empty()) {
         auto& log = logs_[logs_.size() - 1];
         const auto depth = log.depth;
@@ -183,11 +144,8 @@ void DebugTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_t
             } else {
                 log.gas_cost = log.gas - gas;
             }
-            if (!config_.disableMemory) {
-                auto& memory = log.memory;
-                for (std::size_t idx = memory.size(); idx < current_memory.size(); idx++) {
-                    memory.push_back(EMPTY_MEMORY);
-                }
+            if (!config_.disableMemory && log.memory.size() < execution_state.memory.size()) {
+                log.memory.resize(execution_state.memory.size(), 0);
             }
         } else if (depth == execution_state.msg->depth) {
             log.gas_cost = log.gas - gas;
@@ -206,10 +164,13 @@ void DebugTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_t
     log.depth = execution_state.msg->depth + 1;
 
     if (!config_.disableStack) {
-        output_stack(log.stack, stack_top, uint32_t(stack_height));
+        log.stack.reserve(static_cast<std::size_t>(stack_height));
+        for (int i = stack_height - 1; i >= 0; --i) {
+            log.stack.push_back(stack_top[-i]);
+        }
     }
     if (!config_.disableMemory) {
-        log.memory = current_memory;
+        log.memory.assign(execution_state.memory.data(), execution_state.memory.size());
     }
     if (output_storage) {
         for (const auto& entry : storage_[recipient]) {
@@ -219,7 +180,7 @@ void DebugTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_t
 
     insert_error(log, execution_state.status);
 
-    logs_.push_back(log);
+    logs_.push_back(std::move(log));
 }
 
 void DebugTracer::on_precompiled_run(const evmc_result& result, int64_t gas, const silkworm::IntraBlockState& /*intra_block_state*/) noexcept {
@@ -286,16 +247,30 @@ void DebugTracer::write_log(const DebugLog& log) {
         stream_.write_field("stack");
         stream_.open_array();
         for (const auto& item : log.stack) {
-            stream_.write_entry(item);
+            hex_buffer_.clear();
+            append_quantity_hex(hex_buffer_, item);
+            stream_.write_entry(hex_buffer_);
         }
         stream_.close_array();
     }
     if (!config_.disableMemory) {
         stream_.write_field("memory");
         stream_.open_array();
-        for (const auto& item : log.memory) {
-            stream_.write_entry(item);
+        // Consecutive logs usually share most of the memory content, so encode just the chunks changed since last log
+        const ByteView memory{log.memory};
+        const ByteView last_memory{last_written_memory_};
+        last_written_memory_hex_.resize(memory.size() / kMemoryChunkSize);
+        for (std::size_t start{0}, index{0}; start + kMemoryChunkSize <= memory.size(); start += kMemoryChunkSize, ++index) {
+            const auto chunk{memory.substr(start, kMemoryChunkSize)};
+            auto& chunk_hex{last_written_memory_hex_[index]};
+            if (chunk_hex.empty() || start + kMemoryChunkSize > last_memory.size() ||
+                chunk != last_memory.substr(start, kMemoryChunkSize)) {
+                chunk_hex.clear();
+                append_bytes_hex(chunk_hex, chunk);
+            }
+            stream_.write_entry(chunk_hex);
         }
+        last_written_memory_ = log.memory;
         stream_.close_array();
     }
     if (!config_.disableStorage && !log.storage.empty()) {
@@ -416,11 +391,11 @@ Task<void> DebugExecutor::execute(json::Stream& stream, const ChainStorage& stor
                 auto state = tx_.create_state(current_executor, database_reader_, storage, block_number - 1);
                 EVMExecutor executor{*chain_config_ptr, workers_, state};
 
+                std::vector<silkworm::Transaction> block_transactions{transactions};
+                recover_senders(block_transactions, workers_, sender_cache_);
+
                 for (std::uint64_t idx = 0; idx < transactions.size(); idx++) {
-                    rpc::Transaction txn{block.transactions[idx]};
-                    if (!txn.from) {
-                        txn.recover_sender();
-                    }
+                    rpc::Transaction txn{block_transactions[idx]};
                     SILK_DEBUG << "processing transaction: idx: " << idx << " txn: " << txn;
 
                     auto debug_tracer = std::make_shared<debug::DebugTracer>(stream, config_);
@@ -488,9 +463,7 @@ Task<void> DebugExecutor::execute(
                 for (auto idx{0}; idx < index; idx++) {
                     silkworm::Transaction txn{block.transactions[std::size_t(idx)]};
 
-                    if (!txn.from) {
-                        txn.recover_sender();
-                    }
+                    recover_sender(txn, sender_cache_);
                     executor.call(block, txn);
                 }
                 executor.reset();
@@ -552,9 +525,7 @@ Task<void> DebugExecutor::execute(
                 for (auto idx{0}; idx < transaction_index; idx++) {
                     silkworm::Transaction txn{block_transactions[std::size_t(idx)]};
 
-                    if (!txn.from) {
-                        txn.recover_sender();
-                    }
+                    recover_sender(txn, sender_cache_);
 
                     executor.call(block, txn);
                 }
@@ -32,7 +32,9 @@
 #include <silkworm/core/common/block_cache.hpp>
 #include <silkworm/core/execution/evm.hpp>
 #include <silkworm/core/state/intra_block_state.hpp>
+#include <silkworm/silkrpc/core/evm_trace_format.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
 #include <silkworm/silkrpc/json/stream.hpp>
@@ -63,8 +65,8 @@ struct DebugLog {
     std::int64_t gas_cost;
     std::int32_t depth;
     bool error{false};
-    std::vector<std::string> memory;
-    std::vector<std::string> stack;
+    silkworm::Bytes memory;
+    std::vector<intx::uint256> stack;
     Storage storage;
 };
 
@@ -93,7 +95,10 @@ class DebugTracer : public EvmTracer {
     const DebugConfig& config_;
     std::vector<DebugLog> logs_;
     std::map<evmc::address, Storage> storage_;
-    const char* const* opcode_names_ = nullptr;
+    const OpcodeNameTable* opcode_names_ = nullptr;
+    silkworm::Bytes last_written_memory_;
+    std::vector<std::string> last_written_memory_hex_;
+    std::string hex_buffer_;
     std::int64_t start_gas_{0};
     std::int64_t gas_on_precompiled_{0};
 };
@@ -122,8 +127,9 @@ class DebugExecutor {
         BlockCache& block_cache,
         boost::asio::thread_pool& workers,
         ethdb::Transaction& tx,
-        DebugConfig config = {})
-        : database_reader_(database_reader), block_cache_(block_cache), workers_{workers}, tx_{tx}, config_{config} {}
+        DebugConfig config = {},
+        SenderCache* sender_cache = nullptr)
+        : database_reader_(database_reader), block_cache_(block_cache), workers_{workers}, tx_{tx}, config_{config}, sender_cache_{sender_cache} {}
     virtual ~DebugExecutor() = default;
 
     DebugExecutor(const DebugExecutor&) = delete;
@@ -161,6 +167,7 @@ class DebugExecutor {
     boost::asio::thread_pool& workers_;
     ethdb::Transaction& tx_;
     DebugConfig config_;
+    SenderCache* sender_cache_;
 };
 
 }  // namespace silkworm::rpc::debug
@@ -108,6 +108,9 @@ class EVMExecutor {
     ExecutionResult call(const silkworm::Block& block, const silkworm::Transaction& txn, Tracers tracers = {}, bool refund = true, bool gas_bailout = false);
     void reset();
 
+    //! Write the state changes of the last call into the underlying state, must be done before reset
+    void write_state_changes(BlockNum block_number) { ibs_state_.write_journal_to_db(block_number); }
+
     const IntraBlockState& get_ibs_state() { return ibs_state_; }
 
   private:
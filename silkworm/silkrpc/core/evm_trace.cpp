@@ -42,8 +42,10 @@
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/cached_chain.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/json/call.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
 
 namespace silkworm::rpc::trace {
 
@@ -462,8 +464,7 @@ void copy_stack(std::uint8_t op_code, const evmone::uint256* stack, std::vector<
     const int top = get_stack_count(op_code);
     trace_stack.reserve(top > 0 ? static_cast<std::size_t>(top) : 0);
     for (int i = top - 1; i >= 0; i--) {
-        const auto str = intx::to_string(stack[-i], 16);
-        trace_stack.push_back("0x" + intx::to_string(stack[-i], 16));
+        append_quantity_hex(trace_stack.emplace_back(), stack[-i]);
     }
 }
 
@@ -474,19 +475,17 @@ void copy_memory(const evmone::Memory& memory, std::optional<TraceMemory>& trace
             trace_memory.reset();
             return;
         }
+        tm.data.reserve(2 + 2 * tm.len);
         tm.data = "0x";
-        const auto data = memory.data();
-        const auto start = tm.offset;
-        for (uint64_t idx{0}; idx < tm.len; idx++) {
-            std::string entry{evmc::hex({data + start + idx, 1})};
-            tm.data.append(entry);
-        }
+        append_bytes_hex(tm.data, {memory.data() + tm.offset, tm.len});
     }
 }
 
 void copy_store(std::uint8_t op_code, const evmone::uint256* stack, std::optional<TraceStorage>& trace_storage) {
     if (op_code == evmc_opcode::OP_SSTORE) {
-        trace_storage = TraceStorage{"0x" + intx::to_string(stack[0], 16), "0x" + intx::to_string(stack[-1], 16)};
+        trace_storage.emplace();
+        append_quantity_hex(trace_storage->key, stack[0]);
+        append_quantity_hex(trace_storage->value, stack[-1]);
     }
 }
 
@@ -540,28 +539,39 @@ void push_memory_offset_len(std::uint8_t op_code, const evmone::uint256* stack,
     }
 }
 
+static std::string get_undefined_op_name(std::uint8_t opcode) {
+    auto hex = evmc::hex(opcode);
+    if (opcode < 16) {
+        hex = hex.substr(1);
+    }
+    return "opcode 0x" + hex + " not defined";
+}
+
 std::string get_op_name(const char* const* names, std::uint8_t opcode) {
     const auto name = names[opcode];
     if (name != nullptr) {
         return name;
     }
-    auto hex = evmc::hex(opcode);
-    if (opcode < 16) {
-        hex = hex.substr(1);
+    return get_undefined_op_name(opcode);
+}
+
+std::string get_op_name(const OpcodeNameTable& names, std::uint8_t opcode) {
+    const auto& name = names[opcode];
+    if (!name.empty()) {
+        return name;
     }
-    return "opcode 0x" + hex + " not defined";
+    return get_undefined_op_name(opcode);
 }
 
-static const char* PADDING = "0x0000000000000000000000000000000000000000000000000000000000000000";
 std::string to_string(intx::uint256 value) {
-    const auto out = intx::to_string(value, 16);
-    std::string padding = std::string{PADDING};
-    return padding.substr(0, padding.size() - out.size()) + out;
+    std::string out;
+    append_word_hex(out, value);
+    return out;
 }
 
 void VmTraceTracer::on_execution_start(evmc_revision rev, const evmc_message& msg, evmone::bytes_view code) noexcept {
     if (opcode_names_ == nullptr) {
-        opcode_names_ = evmc_get_instruction_names_table(rev);
+        opcode_names_ = &opcode_name_table(rev);
     }
     if (precompile::is_precompile(msg.code_address, rev)) {
         is_precompile_ = true;
@@ -613,7 +623,7 @@ void VmTraceTracer::on_execution_start(evmc_revision rev, const evmc_message& ms
 void VmTraceTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_top, const int /*stack_height*/, const int64_t gas,
                                          const evmone::ExecutionState& execution_state, const silkworm::IntraBlockState& /*intra_block_state*/) noexcept {
     const auto op_code = execution_state.original_code[pc];
-    auto op_name = get_op_name(opcode_names_, op_code);
+    const auto op_name = get_op_name(*opcode_names_, op_code);
 
     auto& vm_trace = traces_stack_.top().get();
     if (!vm_trace.ops.empty()) {
@@ -642,7 +652,7 @@ void VmTraceTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack
     copy_memory_offset_len(op_code, stack_top, trace_op.trace_ex.memory);
     copy_store(op_code, stack_top, trace_op.trace_ex.storage);
 
-    vm_trace.ops.push_back(trace_op);
+    vm_trace.ops.push_back(std::move(trace_op));
     SILK_DEBUG << "VmTraceTracer::on_instruction_start:"
                << " pc: " << std::dec << pc
                << ", opcode: 0x" << std::hex << evmc::hex(op_code)
@@ -717,7 +727,7 @@ void VmTraceTracer::on_execution_end(const evmc_result& result, const silkworm::
 
 void TraceTracer::on_execution_start(evmc_revision rev, const evmc_message& msg, evmone::bytes_view code) noexcept {
     if (opcode_names_ == nullptr) {
-        opcode_names_ = evmc_get_instruction_names_table(rev);
+        opcode_names_ = &opcode_name_table(rev);
     }
 
     if (precompile::is_precompile(msg.code_address, rev)) {
@@ -803,12 +813,11 @@ void TraceTracer::on_execution_start(evmc_revision rev, const evmc_message& msg,
 void TraceTracer::on_instruction_start(uint32_t pc, const intx::uint256* /*stack_top*/, const int /*stack_height*/, const int64_t gas,
                                        const evmone::ExecutionState& execution_state, const silkworm::IntraBlockState& /*intra_block_state*/) noexcept {
     const auto opcode = execution_state.original_code[pc];
-    auto opcode_name = get_op_name(opcode_names_, opcode);
 
     SILK_DEBUG << "TraceTracer::on_instruction_start:"
                << " pc: " << std::dec << pc
                << ", opcode: 0x" << std::hex << evmc::hex(opcode)
-               << ", opcode_name: " << opcode_name
+               << ", opcode_name: " << get_op_name(*opcode_names_, opcode)
                << ", recipient: " << evmc::address{execution_state.msg->recipient}
                << ", sender: " << evmc::address{execution_state.msg->sender}
                << ", execution_state: {"
@@ -978,7 +987,7 @@ silkworm::ByteView StateAddresses::get_code(const evmc::address& address) const
 
 void StateDiffTracer::on_execution_start(evmc_revision rev, const evmc_message& msg, evmone::bytes_view code) noexcept {
     if (opcode_names_ == nullptr) {
-        opcode_names_ = evmc_get_instruction_names_table(rev);
+        opcode_names_ = &opcode_name_table(rev);
     }
     if (precompile::is_precompile(msg.code_address, rev)) {
         is_precompile_ = true;
@@ -1000,19 +1009,16 @@ void StateDiffTracer::on_execution_start(evmc_revision rev, const evmc_message&
 void StateDiffTracer::on_instruction_start(uint32_t pc, const intx::uint256* stack_top, const int /*stack_height*/, const int64_t gas,
                                            const evmone::ExecutionState& execution_state, const silkworm::IntraBlockState& /*intra_block_state*/) noexcept {
     const auto opcode = execution_state.original_code[pc];
-    auto opcode_name = get_op_name(opcode_names_, opcode);
 
     if (opcode == evmc_opcode::OP_SSTORE) {
-        auto key = to_string(stack_top[0]);
-        auto value = to_string(stack_top[-1]);
         auto address = evmc::address{execution_state.msg->recipient};
         auto& keys = diff_storage_[address];
-        keys.insert(key);
+        keys.insert(to_string(stack_top[0]));
     }
 
     SILK_DEBUG << "StateDiffTracer::on_instruction_start:"
                << " pc: " << std::dec << pc
-               << ", opcode_name: " << opcode_name
+               << ", opcode_name: " << get_op_name(*opcode_names_, opcode)
                << ", recipient: " << evmc::address{execution_state.msg->recipient}
                << ", sender: " << evmc::address{execution_state.msg->sender}
                << ", execution_state: {"
@@ -1164,9 +1170,7 @@ Task<std::vector<Trace>> TraceCallExecutor::trace_block(const BlockWithHash& blo
     const auto trace_call_results = co_await trace_block_transactions(block_with_hash.block, trace_block_config);
     for (std::uint64_t pos = 0; pos < trace_call_results.size(); pos++) {
         rpc::Transaction transaction{block_with_hash.block.transactions[pos]};
-        if (!transaction.from) {
-            transaction.recover_sender();
-        }
+        recover_sender(transaction, sender_cache_);
         const auto hash = hash_of_transaction(transaction);
         const auto tnx_hash = silkworm::to_bytes32({hash.bytes, silkworm::kHashLength});
 
@@ -1283,60 +1287,49 @@ Task<std::vector<TraceCallResult>> TraceCallExecutor::trace_block_transactions(c
 
     auto current_executor = co_await boost::asio::this_coro::executor;
 
-    const auto call_result = co_await boost::asio::async_compose<decltype(boost::asio::use_awaitable), void(std::vector<TraceCallResult>)>(
+    const auto call_result = co_await boost::asio::async_compose<decltype(boost::asio::use_awaitable), void(std::exception_ptr, std::vector<TraceCallResult>)>(
         [&](auto&& self) {
             boost::asio::post(workers_, [&, self = std::move(self)]() mutable {
-                auto state = tx_.create_state(current_executor, database_reader_, chain_storage_, block_number - 1);
-                IntraBlockState initial_ibs{*state};
-
-                StateAddresses state_addresses(initial_ibs);
-                std::shared_ptr<EvmTracer> ibs_tracer = std::make_shared<trace::IntraBlockStateTracer>(state_addresses);
-
-                auto curr_state = tx_.create_state(current_executor, database_reader_, chain_storage_, block_number - 1);
-                EVMExecutor executor{*chain_config_ptr, workers_, curr_state};
-
-                std::vector<TraceCallResult> trace_call_result(transactions.size());
-                for (std::uint64_t index = 0; index < transactions.size(); index++) {
-                    silkworm::Transaction transaction{block.transactions[index]};
-                    if (!transaction.from) {
-                        transaction.recover_sender();
-                    }
-
-                    auto& result = trace_call_result.at(index);
-                    TraceCallTraces& traces = result.traces;
-                    auto hash{hash_of_transaction(transaction)};
-                    traces.transaction_hash = silkworm::to_bytes32({hash.bytes, silkworm::kHashLength});
-
-                    Tracers tracers;
-                    if (config.vm_trace) {
-                        traces.vm_trace.emplace();
-                        std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::VmTraceTracer>(traces.vm_trace.value(), index);
-                        tracers.push_back(tracer);
+                using Completion = std::decay_t<decltype(self)>;
+                auto completion = std::make_shared<Completion>(std::move(self));
+                auto tracing = std::make_shared<BlockTracing>();
+                try {
+                    tracing->transactions = transactions;
+                    recover_senders(tracing->transactions, workers_, sender_cache_);
+                    tracing->results.resize(transactions.size());
+                    tracing->pending_count = transactions.size();
+                    if (transactions.empty()) {
+                        boost::asio::post(current_executor, [completion]() mutable {
+                            completion->complete(std::exception_ptr{}, std::vector<TraceCallResult>{});
+                        });
+                        return;
                     }
-                    if (config.trace) {
-                        std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::TraceTracer>(traces.trace, initial_ibs);
-                        tracers.push_back(tracer);
-                    }
-                    if (config.state_diff) {
-                        traces.state_diff.emplace();
 
-                        std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::StateDiffTracer>(traces.state_diff.value(), state_addresses);
-                        tracers.push_back(tracer);
+                    // Execute the block w/o tracing to get the state before each transaction from state read just once...
+                    auto block_start_state = tx_.create_state(current_executor, database_reader_, chain_storage_, block_number - 1);
+                    tracing->block_state = std::make_shared<state::SynchronizedState>(block_start_state);
+                    tracing->checkpoints = state::collect_checkpoints(*chain_config_ptr, workers_, *tracing->block_state, block,
+                                                                      tracing->transactions, /*refund=*/true, /*gas_bailout=*/true);
+
+                    // ...then trace all the transactions in parallel starting each one from its own state
+                    for (std::size_t index = 0; index < transactions.size(); index++) {
+                        boost::asio::post(workers_, [&, index, tracing, completion]() mutable {
+                            tracing->results[index] = trace_block_transaction(*chain_config_ptr, *tracing->block_state,
+                                                                              tracing->checkpoints[index], block,
+                                                                              tracing->transactions[index], index, config);
+                            if (--tracing->pending_count == 0) {
+                                boost::asio::post(current_executor, [tracing, completion]() mutable {
+                                    completion->complete(std::exception_ptr{}, std::move(tracing->results));
+                                });
+                            }
+                        });
                     }
-
-                    tracers.push_back(ibs_tracer);
-
-                    auto execution_result = executor.call(block, transaction, tracers, /*refund=*/true, /*gas_bailout=*/true);
-                    if (execution_result.pre_check_error) {
-                        result.pre_check_error = execution_result.pre_check_error.value();
-                    } else {
-                        traces.output = "0x" + silkworm::to_hex(execution_result.data);
-                    }
-                    executor.reset();
+                } catch (...) {
+                    // Checkpoint collection executes the whole block, so any failure must reach the awaiting caller
+                    boost::asio::post(current_executor, [completion, error = std::current_exception()]() mutable {
+                        completion->complete(error, std::vector<TraceCallResult>{});
+                    });
                 }
-                boost::asio::post(current_executor, [trace_call_result, self = std::move(self)]() mutable {
-                    self.complete(trace_call_result);
-                });
             });
         },
         boost::asio::use_awaitable);
@@ -1344,6 +1337,61 @@ Task<std::vector<TraceCallResult>> TraceCallExecutor::trace_block_transactions(c
     co_return call_result;
 }
 
+TraceCallResult TraceCallExecutor::trace_block_transaction(const silkworm::ChainConfig& chain_config,
+                                                           silkworm::State& block_state,
+                                                           const std::shared_ptr<const state::StateCheckpoint>& checkpoint,
+                                                           const silkworm::Block& block,
+                                                           const silkworm::Transaction& transaction,
+                                                           std::uint64_t index,
+                                                           const TraceConfig& config) {
+    TraceCallResult result;
+    TraceCallTraces& traces = result.traces;
+    auto hash{hash_of_transaction(transaction)};
+    traces.transaction_hash = silkworm::to_bytes32({hash.bytes, silkworm::kHashLength});
+
+    try {
+        state::CheckpointState initial_state{block_state, checkpoint};
+        IntraBlockState initial_ibs{initial_state};
+
+        StateAddresses state_addresses(initial_ibs);
+        std::shared_ptr<EvmTracer> ibs_tracer = std::make_shared<trace::IntraBlockStateTracer>(state_addresses);
+
+        std::shared_ptr<silkworm::State> curr_state = std::make_shared<state::CheckpointState>(block_state, checkpoint);
+        EVMExecutor executor{chain_config, workers_, curr_state};
+
+        Tracers tracers;
+        if (config.vm_trace) {
+            traces.vm_trace.emplace();
+            std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::VmTraceTracer>(traces.vm_trace.value(), index);
+            tracers.push_back(tracer);
+        }
+        if (config.trace) {
+            std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::TraceTracer>(traces.trace, initial_ibs);
+            tracers.push_back(tracer);
+        }
+        if (config.state_diff) {
+            traces.state_diff.emplace();
+
+            std::shared_ptr<silkworm::EvmTracer> tracer = std::make_shared<trace::StateDiffTracer>(traces.state_diff.value(), state_addresses);
+            tracers.push_back(tracer);
+        }
+
+        tracers.push_back(ibs_tracer);
+
+        auto execution_result = executor.call(block, transaction, tracers, /*refund=*/true, /*gas_bailout=*/true);
+        if (execution_result.pre_check_error) {
+            result.pre_check_error = execution_result.pre_check_error.value();
+        } else {
+            traces.output = "0x" + silkworm::to_hex(execution_result.data);
+        }
+    } catch (const std::exception& e) {
+        SILK_ERROR << "trace_block_transaction: block_number: " << block.header.number << " index: " << index << " error: " << e.what();
+        result.pre_check_error = e.what();
+    }
+
+    return result;
+}
+
 Task<TraceCallResult> TraceCallExecutor::trace_call(const silkworm::Block& block, const Call& call, const TraceConfig& config) {
     rpc::Transaction transaction{call.to_transaction()};
     auto result = co_await execute(block.header.number, block, transaction, -1, config);
@@ -1447,9 +1495,7 @@ Task<TraceDeployResult> TraceCallExecutor::trace_deploy_transaction(const silkwo
 
                 for (std::uint64_t index = 0; index < transactions.size(); index++) {
                     silkworm::Transaction transaction{block.transactions[index]};
-                    if (!transaction.from) {
-                        transaction.recover_sender();
-                    }
+                    recover_sender(transaction, sender_cache_);
 
                     executor.call(block, transaction, tracers, /*refund=*/true, /*gas_bailout=*/true);
                     executor.reset();
@@ -1627,7 +1673,7 @@ Task<bool> TraceCallExecutor::trace_touch_transaction(const silkworm::Block& blo
     co_return ret_entry_tracer->found();
 }
 
-Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream* stream) {
+Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream* stream, uint64_t max_blocks) {
     SILK_TRACE << "TraceCallExecutor::trace_filter: filter " << trace_filter;
 
     const auto from_block_with_hash = co_await core::read_block_by_number_or_hash(block_cache_, storage, database_reader_, trace_filter.from_block);
@@ -1648,6 +1694,13 @@ Task<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter, cons
         stream->write_json_field("error", error);
         co_return;
     }
+    // The reply is streamed while tracing, so the budget must be enforced before the result is opened
+    const auto block_count{to_block_with_hash->block.header.number - from_block_with_hash->block.header.number + 1};
+    if (block_count > max_blocks) {
+        const Error error{kLimitExceeded, "block range exceeds the limit of " + std::to_string(max_blocks) + " blocks"};
+        stream->write_json_field("error", error);
+        co_return;
+    }
 
     stream->write_field("result");
     stream->open_array();
@@ -1719,9 +1772,7 @@ Task<TraceCallResult> TraceCallExecutor::execute(
                 for (std::size_t idx{0}; idx < transaction.transaction_index; idx++) {
                     silkworm::Transaction txn{block.transactions[idx]};
 
-                    if (!txn.from) {
-                        txn.recover_sender();
-                    }
+                    recover_sender(txn, sender_cache_);
                     const auto execution_result = executor.call(block, txn, tracers, /*refund=*/true, /*gas_bailout=*/true);
                     if (execution_result.pre_check_error) {
                         SILK_ERROR << "execution failed for tx " << idx << " due to pre-check error: " << *execution_result.pre_check_error;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <limits>
@@ -36,8 +37,12 @@
 #include <silkworm/core/common/block_cache.hpp>
 #include <silkworm/core/execution/evm.hpp>
 #include <silkworm/core/state/intra_block_state.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/core/checkpoint_state.hpp>
 #include <silkworm/silkrpc/core/evm_executor.hpp>
+#include <silkworm/silkrpc/core/evm_trace_format.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 #include <silkworm/silkrpc/json/stream.hpp>
 #include <silkworm/silkrpc/types/block.hpp>
@@ -74,6 +79,7 @@ struct TraceFilter {
 void from_json(const nlohmann::json& json, TraceFilter& tc);
 
 std::string get_op_name(const char* const* names, std::uint8_t opcode);
+std::string get_op_name(const OpcodeNameTable& names, std::uint8_t opcode);
 std::string to_string(intx::uint256 value);
 std::ostream& operator<<(std::ostream& out, const TraceConfig& tc);
 std::ostream& operator<<(std::ostream& out, const TraceFilter& tf);
@@ -148,7 +154,7 @@ class VmTraceTracer : public silkworm::EvmTracer {
     std::int32_t transaction_index_;
     std::stack<std::string> index_prefix_;
     std::stack<std::reference_wrapper<VmTrace>> traces_stack_;
-    const char* const* opcode_names_ = nullptr;
+    const OpcodeNameTable* opcode_names_ = nullptr;
     std::stack<int64_t> start_gas_;
     std::stack<TraceMemory> trace_memory_stack_;
 };
@@ -227,7 +233,7 @@ class TraceTracer : public silkworm::EvmTracer {
     bool is_precompile_{false};
     std::vector<Trace>& traces_;
     silkworm::IntraBlockState& initial_ibs_;
-    const char* const* opcode_names_ = nullptr;
+    const OpcodeNameTable* opcode_names_ = nullptr;
     int64_t initial_gas_{0};
     int32_t current_depth_{-1};
     std::set<evmc::address> created_address_;
@@ -299,7 +305,7 @@ class StateDiffTracer : public silkworm::EvmTracer {
     StateAddresses& state_addresses_;
     std::map<evmc::address, std::set<std::string>> diff_storage_;
     std::map<evmc::address, silkworm::ByteView> code_;
-    const char* const* opcode_names_ = nullptr;
+    const OpcodeNameTable* opcode_names_ = nullptr;
 };
 
 struct TraceCallTraces {
@@ -452,8 +458,9 @@ class TraceCallExecutor {
                                const core::rawdb::DatabaseReader& database_reader,
                                const ChainStorage& chain_storage,
                                boost::asio::thread_pool& workers,
-                               ethdb::Transaction& tx)
-        : block_cache_(block_cache), database_reader_(database_reader), chain_storage_{chain_storage}, workers_{workers}, tx_{tx} {}
+                               ethdb::Transaction& tx,
+                               SenderCache* sender_cache = nullptr)
+        : block_cache_(block_cache), database_reader_(database_reader), chain_storage_{chain_storage}, workers_{workers}, tx_{tx}, sender_cache_{sender_cache} {}
     virtual ~TraceCallExecutor() = default;
 
     TraceCallExecutor(const TraceCallExecutor&) = delete;
@@ -472,9 +479,20 @@ class TraceCallExecutor {
     Task<std::string> trace_transaction_error(const TransactionWithBlock& transaction_with_block);
     Task<TraceOperationsResult> trace_operations(const TransactionWithBlock& transaction_with_block);
     Task<bool> trace_touch_transaction(const silkworm::Block& block, const silkworm::Transaction& txn, const evmc::address& address);
-    Task<void> trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream* stream);
+    //! Stream the traces matching the filter, the block range wider than max_blocks is rejected upfront
+    Task<void> trace_filter(const TraceFilter& trace_filter, const ChainStorage& storage, json::Stream* stream,
+                            uint64_t max_blocks = kDefaultTraceFilterMaxBlocks);
 
   private:
+    //! The shared context of one block whose transactions are traced in parallel
+    struct BlockTracing {
+        std::vector<silkworm::Transaction> transactions;
+        std::shared_ptr<silkworm::State> block_state;
+        std::vector<std::shared_ptr<const state::StateCheckpoint>> checkpoints;
+        std::vector<TraceCallResult> results;
+        std::atomic_size_t pending_count{0};
+    };
+
     Task<TraceCallResult> execute(
         BlockNum block_number,
         const silkworm::Block& block,
@@ -482,11 +500,20 @@ class TraceCallExecutor {
         std::int32_t index,
         const TraceConfig& config);
 
+    TraceCallResult trace_block_transaction(const silkworm::ChainConfig& chain_config,
+                                            silkworm::State& block_state,
+                                            const std::shared_ptr<const state::StateCheckpoint>& checkpoint,
+                                            const silkworm::Block& block,
+                                            const silkworm::Transaction& transaction,
+                                            std::uint64_t index,
+                                            const TraceConfig& config);
+
     silkworm::BlockCache& block_cache_;
     const core::rawdb::DatabaseReader& database_reader_;
     const ChainStorage& chain_storage_;
     boost::asio::thread_pool& workers_;
     ethdb::Transaction& tx_;
+    SenderCache* sender_cache_;
 };
 
 }  // namespace silkworm::rpc::trace
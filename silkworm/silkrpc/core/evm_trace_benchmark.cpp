@@ -0,0 +1,202 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <atomic>
+#include <bit>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <ethash/keccak.hpp>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+#include <silkworm/silkrpc/core/checkpoint_state.hpp>
+#include <silkworm/silkrpc/core/evm_executor.hpp>
+#include <silkworm/silkrpc/core/evm_trace.hpp>
+#include <silkworm/silkrpc/core/evm_trace_format.hpp>
+
+namespace {
+
+using namespace silkworm;
+using namespace silkworm::rpc;
+
+// Count down from 200 to 0 in a loop, i.e. some thousands of opcodes to trace for each call
+const Bytes kLoopCode{*from_hex("6100c85b600190038060035700")};
+constexpr std::size_t kNumTransactions{500};
+constexpr std::size_t kNumWorkers{8};
+
+struct SyntheticBlock {
+    Block block;
+    std::shared_ptr<State> state;
+};
+
+evmc::address make_address(uint64_t seed, uint8_t prefix) {
+    evmc::address address;
+    address.bytes[0] = prefix;
+    endian::store_big_u64(address.bytes + kAddressLength - sizeof(uint64_t), seed);
+    return address;
+}
+
+// Build a block where each transaction is sent by a distinct funded account to one of few looping contracts
+SyntheticBlock make_synthetic_block() {
+    auto state = std::make_shared<InMemoryState>();
+    state->begin_block(0);
+
+    const auto code_hash{std::bit_cast<evmc_bytes32>(keccak256(kLoopCode))};
+    std::vector<evmc::address> contracts;
+    for (uint64_t i{0}; i < 10; ++i) {
+        const auto contract{make_address(i, 0xcc)};
+        Account account{.code_hash = code_hash, .incarnation = 1};
+        state->update_account(contract, std::nullopt, account);
+        state->update_account_code(contract, 1, code_hash, kLoopCode);
+        contracts.push_back(contract);
+    }
+
+    Block block;
+    block.header.number = 16'000'000;
+    block.header.gas_limit = 30'000'000;
+    block.header.base_fee_per_gas = 0;
+    for (uint64_t i{0}; i < kNumTransactions; ++i) {
+        const auto sender{make_address(i, 0xaa)};
+        state->update_account(sender, std::nullopt, Account{.balance = 1'000'000'000});
+
+        Transaction txn;
+        txn.type = TransactionType::kDynamicFee;
+        txn.chain_id = kMainnetConfig.chain_id;
+        txn.nonce = 0;
+        txn.gas_limit = 100'000;
+        txn.to = contracts[i % contracts.size()];
+        txn.from = sender;
+        block.transactions.push_back(std::move(txn));
+    }
+    return {std::move(block), std::move(state)};
+}
+
+void trace_transaction(boost::asio::thread_pool& workers, State& state, std::shared_ptr<State> executor_state,
+                       const Block& block, const Transaction& txn, std::int32_t index) {
+    IntraBlockState initial_ibs{state};
+    trace::StateAddresses state_addresses{initial_ibs};
+    trace::TraceCallTraces traces;
+    traces.vm_trace.emplace();
+
+    EVMExecutor executor{kMainnetConfig, workers, executor_state};
+    Tracers tracers{
+        std::make_shared<trace::VmTraceTracer>(traces.vm_trace.value(), index),
+        std::make_shared<trace::TraceTracer>(traces.trace, initial_ibs),
+        std::make_shared<trace::IntraBlockStateTracer>(state_addresses),
+    };
+    benchmark::DoNotOptimize(executor.call(block, txn, tracers, /*refund=*/true, /*gas_bailout=*/true));
+}
+
+void sequential_block_tracing(benchmark::State& bench_state) {
+    auto synthetic_block{make_synthetic_block()};
+    const auto& block{synthetic_block.block};
+    auto& state{synthetic_block.state};
+    boost::asio::thread_pool workers{kNumWorkers};
+
+    for ([[maybe_unused]] auto _ : bench_state) {
+        IntraBlockState initial_ibs{*state};
+        trace::StateAddresses state_addresses{initial_ibs};
+        auto ibs_tracer = std::make_shared<trace::IntraBlockStateTracer>(state_addresses);
+        EVMExecutor executor{kMainnetConfig, workers, state};
+        for (std::size_t index{0}; index < block.transactions.size(); ++index) {
+            trace::TraceCallTraces traces;
+            traces.vm_trace.emplace();
+            Tracers tracers{
+                std::make_shared<trace::VmTraceTracer>(traces.vm_trace.value(), static_cast<std::int32_t>(index)),
+                std::make_shared<trace::TraceTracer>(traces.trace, initial_ibs),
+                ibs_tracer,
+            };
+            benchmark::DoNotOptimize(executor.call(block, block.transactions[index], tracers, true, true));
+            executor.reset();
+        }
+    }
+}
+BENCHMARK(sequential_block_tracing)->Unit(benchmark::kMillisecond);
+
+void parallel_block_tracing(benchmark::State& bench_state) {
+    auto synthetic_block{make_synthetic_block()};
+    const auto& block{synthetic_block.block};
+    boost::asio::thread_pool workers{kNumWorkers};
+
+    for ([[maybe_unused]] auto _ : bench_state) {
+        state::SynchronizedState block_state{synthetic_block.state};
+        const auto checkpoints{state::collect_checkpoints(kMainnetConfig, workers, block_state, block, block.transactions,
+                                                          /*refund=*/true, /*gas_bailout=*/true)};
+
+        std::atomic_size_t pending_count{block.transactions.size()};
+        std::promise<void> all_traced;
+        auto all_traced_future{all_traced.get_future()};
+        for (std::size_t index{0}; index < block.transactions.size(); ++index) {
+            boost::asio::post(workers, [&, index]() {
+                state::CheckpointState initial_state{block_state, checkpoints[index]};
+                auto executor_state = std::make_shared<state::CheckpointState>(block_state, checkpoints[index]);
+                trace_transaction(workers, initial_state, executor_state, block, block.transactions[index],
+                                  static_cast<std::int32_t>(index));
+                if (--pending_count == 0) {
+                    all_traced.set_value();
+                }
+            });
+        }
+        all_traced_future.wait();
+    }
+}
+BENCHMARK(parallel_block_tracing)->Unit(benchmark::kMillisecond);
+
+void vm_trace_transaction(benchmark::State& bench_state) {
+    auto synthetic_block{make_synthetic_block()};
+    const auto& block{synthetic_block.block};
+    boost::asio::thread_pool workers{1};
+
+    std::size_t traced_instructions{0};
+    for ([[maybe_unused]] auto _ : bench_state) {
+        trace::VmTrace vm_trace;
+        EVMExecutor executor{kMainnetConfig, workers, synthetic_block.state};
+        Tracers tracers{std::make_shared<trace::VmTraceTracer>(vm_trace)};
+        benchmark::DoNotOptimize(executor.call(block, block.transactions[0], tracers, true, true));
+        traced_instructions += vm_trace.ops.size();
+    }
+    bench_state.counters["instructions"] = benchmark::Counter(static_cast<double>(traced_instructions), benchmark::Counter::kIsRate);
+}
+BENCHMARK(vm_trace_transaction);
+
+const intx::uint256 kStackWord{intx::from_string<intx::uint256>("0x1234567890abcdef1234567890abcdef1234567890abcdef")};
+
+void uint256_hex_intx(benchmark::State& bench_state) {
+    for ([[maybe_unused]] auto _ : bench_state) {
+        benchmark::DoNotOptimize("0x" + intx::to_string(kStackWord, 16));
+    }
+}
+BENCHMARK(uint256_hex_intx);
+
+void uint256_hex_append(benchmark::State& bench_state) {
+    std::string buffer;
+    for ([[maybe_unused]] auto _ : bench_state) {
+        buffer.clear();
+        append_quantity_hex(buffer, kStackWord);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(uint256_hex_append);
+
+}  // namespace
@@ -0,0 +1,83 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "evm_trace_format.hpp"
+
+#include <algorithm>
+
+#include <evmc/instructions.h>
+
+namespace silkworm::rpc {
+
+static constexpr const char* kHexDigits{"0123456789abcdef"};
+
+//! Hex digit pairs for all the byte values, so that each byte is encoded by a single lookup
+static constexpr auto kHexBytes = [] {
+    std::array<std::array<char, 2>, 256> table{};
+    for (std::size_t i{0}; i < table.size(); ++i) {
+        table[i] = {kHexDigits[i >> 4], kHexDigits[i & 0x0f]};
+    }
+    return table;
+}();
+
+const OpcodeNameTable& opcode_name_table(evmc_revision rev) {
+    static const auto kNameTables = [] {
+        std::array<OpcodeNameTable, EVMC_MAX_REVISION + 1> name_tables;
+        for (std::size_t r{0}; r < name_tables.size(); ++r) {
+            const char* const* names = evmc_get_instruction_names_table(static_cast<evmc_revision>(r));
+            for (std::size_t opcode{0}; opcode < 256; ++opcode) {
+                if (names[opcode] != nullptr) {
+                    name_tables[r][opcode] = names[opcode];
+                }
+            }
+        }
+        return name_tables;
+    }();
+    return kNameTables[std::min<std::size_t>(rev, EVMC_MAX_REVISION)];
+}
+
+static void append_uint256_hex(std::string& out, const intx::uint256& value, std::size_t num_digits) {
+    const auto offset{out.size()};
+    out.resize(offset + 2 + num_digits);
+    char* dest{out.data() + offset};
+    *dest++ = '0';
+    *dest++ = 'x';
+    for (std::size_t i{0}; i < num_digits; ++i) {
+        const std::size_t nibble{num_digits - 1 - i};
+        dest[i] = kHexDigits[(value[nibble / 16] >> (4 * (nibble % 16))) & 0x0f];
+    }
+}
+
+void append_quantity_hex(std::string& out, const intx::uint256& value) {
+    const std::size_t significant_digits{(256 - intx::clz(value) + 3) / 4};
+    append_uint256_hex(out, value, std::max<std::size_t>(significant_digits, 1));
+}
+
+void append_word_hex(std::string& out, const intx::uint256& value) {
+    append_uint256_hex(out, value, 64);
+}
+
+void append_bytes_hex(std::string& out, ByteView bytes) {
+    const auto offset{out.size()};
+    out.resize(offset + 2 * bytes.size());
+    char* dest{out.data() + offset};
+    for (const auto b : bytes) {
+        *dest++ = kHexBytes[b][0];
+        *dest++ = kHexBytes[b][1];
+    }
+}
+
+}  // namespace silkworm::rpc
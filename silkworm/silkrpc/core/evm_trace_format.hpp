@@ -0,0 +1,47 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <evmc/evmc.h>
+#include <intx/intx.hpp>
+
+#include <silkworm/core/common/base.hpp>
+
+// Formatting helpers used by EVM tracers on each executed instruction, hence designed to avoid any allocation
+
+namespace silkworm::rpc {
+
+//! The names of all the opcodes in one EVM revision interned as strings, undefined opcodes having empty name
+using OpcodeNameTable = std::array<std::string, 256>;
+
+//! Get the opcode names for the specified EVM revision (tables are built just once for all revisions)
+const OpcodeNameTable& opcode_name_table(evmc_revision rev);
+
+//! Append the hex representation of the value w/ "0x" prefix and w/o leading zeros (e.g. 0x0, 0xb0a0) to the output
+void append_quantity_hex(std::string& out, const intx::uint256& value);
+
+//! Append the hex representation of the value w/ "0x" prefix and zero-padded to 64 digits to the output
+void append_word_hex(std::string& out, const intx::uint256& value);
+
+//! Append the hex representation of the bytes w/o "0x" prefix to the output
+void append_bytes_hex(std::string& out, ByteView bytes);
+
+}  // namespace silkworm::rpc
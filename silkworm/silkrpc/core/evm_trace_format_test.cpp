@@ -0,0 +1,101 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "evm_trace_format.hpp"
+
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <evmc/instructions.h>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::rpc {
+
+TEST_CASE("opcode_name_table", "[silkrpc][core][evm_trace_format]") {
+    SECTION("defined opcodes") {
+        const auto& names{opcode_name_table(EVMC_SHANGHAI)};
+        CHECK(names[evmc_opcode::OP_STOP] == "STOP");
+        CHECK(names[evmc_opcode::OP_SSTORE] == "SSTORE");
+        CHECK(names[0x5f] == "PUSH0");
+    }
+    SECTION("undefined opcodes") {
+        CHECK(opcode_name_table(EVMC_SHANGHAI)[0x0c].empty());
+        CHECK(opcode_name_table(EVMC_LONDON)[0x5f].empty());
+    }
+    SECTION("same table for same revision") {
+        CHECK(&opcode_name_table(EVMC_LONDON) == &opcode_name_table(EVMC_LONDON));
+    }
+}
+
+TEST_CASE("append_quantity_hex", "[silkrpc][core][evm_trace_format]") {
+    const std::vector<intx::uint256> values{
+        0,
+        1,
+        0xf,
+        0x10,
+        0xB0A0,
+        0xCB0A0,
+        intx::uint256{1} << 64,
+        intx::from_string<intx::uint256>("0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef"),
+        ~intx::uint256{0},
+    };
+    for (const auto& value : values) {
+        std::string out;
+        append_quantity_hex(out, value);
+        CHECK(out == "0x" + intx::to_string(value, 16));
+    }
+
+    SECTION("append to existing content") {
+        std::string out{"prefix"};
+        append_quantity_hex(out, 0xab);
+        CHECK(out == "prefix0xab");
+    }
+}
+
+TEST_CASE("append_word_hex", "[silkrpc][core][evm_trace_format]") {
+    SECTION("zero") {
+        std::string out;
+        append_word_hex(out, 0);
+        CHECK(out == "0x0000000000000000000000000000000000000000000000000000000000000000");
+    }
+    SECTION("small value") {
+        std::string out;
+        append_word_hex(out, 0xB0A0);
+        CHECK(out == "0x000000000000000000000000000000000000000000000000000000000000b0a0");
+    }
+    SECTION("max value") {
+        std::string out;
+        append_word_hex(out, ~intx::uint256{0});
+        CHECK(out == "0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+    }
+}
+
+TEST_CASE("append_bytes_hex", "[silkrpc][core][evm_trace_format]") {
+    SECTION("empty") {
+        std::string out;
+        append_bytes_hex(out, {});
+        CHECK(out.empty());
+    }
+    SECTION("not empty") {
+        const Bytes bytes{*from_hex("00010a0fa0ff7f80")};
+        std::string out{"0x"};
+        append_bytes_hex(out, bytes);
+        CHECK(out == "0x00010a0fa0ff7f80");
+    }
+}
+
+}  // namespace silkworm::rpc
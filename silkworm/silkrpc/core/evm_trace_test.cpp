@@ -34,6 +34,7 @@
 #include <silkworm/silkrpc/test/context_test_base.hpp>
 #include <silkworm/silkrpc/test/dummy_transaction.hpp>
 #include <silkworm/silkrpc/test/mock_back_end.hpp>
+#include <silkworm/silkrpc/test/mock_chain_storage.hpp>
 #include <silkworm/silkrpc/test/mock_cursor.hpp>
 #include <silkworm/silkrpc/test/mock_database_reader.hpp>
 #include <silkworm/silkrpc/types/transaction.hpp>
@@ -2022,10 +2023,12 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_block_transact
     test::DummyTransaction tx{0, mock_cursor};
     const auto backend = std::make_unique<test::BackEndMock>();
     const RemoteChainStorage chain_storage{db_reader, backend.get()};
-    TraceCallExecutor executor{block_cache, db_reader, chain_storage, workers, tx};
-    const auto result = spawn_and_wait(executor.trace_block_transactions(block, config));
 
-    CHECK(nlohmann::json(result) == R"([
+    SECTION("single transaction") {
+        TraceCallExecutor executor{block_cache, db_reader, chain_storage, workers, tx};
+        const auto result = spawn_and_wait(executor.trace_block_transactions(block, config));
+
+        CHECK(nlohmann::json(result) == R"([
         {
             "output": "0x6080604052348015600f57600080fd5b506004361060325760003560e01c806360fe47b11460375780636d4ce63c146062575b600080fd5b606060048036036020811015604b57600080fd5b8101908080359060200190929190505050607e565b005b60686088565b6040518082815260200191505060405180910390f35b8060008190555050565b6000805490509056fea265627a7a72305820ca7603d2458ae7a9db8bde091d8ba88a4637b54a8cc213b73af865f97c60af2c64736f6c634300050a0032",
             "stateDiff": {
@@ -2393,6 +2396,40 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_block_transact
             }
         }
     ])"_json);
+    }
+
+    SECTION("multiple transactions on multiple workers") {
+        // Two calls to the contract created by the first transaction, both reverting at once because of missing input
+        silkworm::Transaction call{transaction};
+        call.to = 0xa85b4c37cd8f447848d49851a1bb06d10d410c13_address;
+        call.data.clear();
+        call.nonce = 28;
+        block.transactions.push_back(call);
+        call.nonce = 29;
+        block.transactions.push_back(call);
+
+        boost::asio::thread_pool multiple_workers{4};
+        TraceCallExecutor executor{block_cache, db_reader, chain_storage, multiple_workers, tx};
+        const auto result = spawn_and_wait(executor.trace_block_transactions(block, config));
+
+        // Results are in transaction order and each transaction starts from the state left by the previous ones
+        const nlohmann::json json = result;
+        REQUIRE(json.size() == 3);
+        CHECK(json[0]["transactionHash"] == "0x849ca3076047d76288f2d15b652f18e80622aa6163eff0a216a446d0a4a5288e");
+        CHECK(json[0]["trace"][0]["type"] == "create");
+        const auto* sender{"0xdaae090d53f9ed9e2e1fd25258c01bac4dd6d1c5"};
+        CHECK(json[0]["stateDiff"][sender]["nonce"] == R"({"*": {"from": "0x27", "to": "0x28"}})"_json);
+        for (std::size_t index{1}; index < json.size(); ++index) {
+            CHECK(json[index]["output"] == "0x");
+            CHECK(json[index]["trace"][0]["type"] == "call");
+            CHECK(json[index]["trace"][0]["action"]["to"] == "0xa85b4c37cd8f447848d49851a1bb06d10d410c13");
+            CHECK(json[index]["trace"][0]["error"] == "Reverted");
+        }
+        CHECK(json[1]["stateDiff"][sender]["nonce"] == R"({"*": {"from": "0x28", "to": "0x29"}})"_json);
+        CHECK(json[2]["stateDiff"][sender]["nonce"] == R"({"*": {"from": "0x29", "to": "0x2a"}})"_json);
+        CHECK(json[1]["stateDiff"][sender]["balance"]["*"]["from"] == "0x3347b7164e52e40");
+        CHECK(json[2]["stateDiff"][sender]["balance"]["*"]["from"] == json[1]["stateDiff"][sender]["balance"]["*"]["to"]);
+    }
 }
 
 TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_block") {
@@ -5723,6 +5760,47 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
         ])"_json);
     }
 }
+
+TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter block range limit") {
+    test::MockDatabaseReader db_reader;
+    test::MockChainStorage chain_storage;
+    boost::asio::thread_pool workers{1};
+    BlockCache block_cache;
+    test::DummyTransaction tx{0, nullptr};
+
+    EXPECT_CALL(chain_storage, read_canonical_hash(_)).WillRepeatedly([](BlockNum block_number) -> Task<std::optional<Hash>> {
+        Hash block_hash;
+        block_hash.bytes[0] = static_cast<uint8_t>(block_number);
+        co_return block_hash;
+    });
+    EXPECT_CALL(chain_storage, read_block(testing::An<HashAsSpan>(), _, _, _))
+        .WillRepeatedly([](HashAsSpan /*hash*/, BlockNum block_number, bool /*read_senders*/, silkworm::Block& block) -> Task<bool> {
+            block.header.number = block_number;
+            co_return true;
+        });
+
+    TraceCallExecutor executor{block_cache, db_reader, chain_storage, workers, tx};
+    StringWriter string_writer(4096);
+    json::Stream stream(string_writer);
+
+    TraceFilter trace_filter = R"({
+      "fromBlock": "0x10",
+      "toBlock": "0x19"
+    })"_json;
+
+    stream.open_object();
+    spawn_and_wait(executor.trace_filter(trace_filter, chain_storage, &stream, /*max_blocks=*/9));
+    stream.close_object();
+    stream.close();
+
+    // The limit is checked before any block is traced, so no partial result is written
+    CHECK(nlohmann::json::parse(string_writer.get_content()) == R"({
+        "error":{
+            "code":-32005,
+            "message":"block range exceeds the limit of 9 blocks"
+        }
+    })"_json);
+}
 #endif
 
 TEST_CASE("VmTrace json serialization") {
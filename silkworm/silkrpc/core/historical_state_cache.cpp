@@ -0,0 +1,102 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_cache.hpp"
+
+#include <algorithm>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc {
+
+//! Rough memory overhead of one cached key and one cached range, besides their actual content
+static constexpr std::size_t kEntryOverhead{128};
+static constexpr std::size_t kRangeOverhead{64};
+
+std::optional<Bytes> HistoricalStateCache::get(ByteView key, BlockNum block_number) {
+    std::scoped_lock lock{mutex_};
+    const auto entry_it = entry_by_key_.find(key);
+    if (entry_it == entry_by_key_.end()) {
+        ++miss_count_;
+        return std::nullopt;
+    }
+    const auto& ranges = entry_it->second->ranges_by_last_block;
+    const auto range_it = ranges.lower_bound(block_number);
+    if (range_it == ranges.end() || range_it->second.first_block > block_number) {
+        ++miss_count_;
+        return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, entry_it->second);
+    ++hit_count_;
+    return range_it->second.value;
+}
+
+void HistoricalStateCache::put(ByteView key, BlockNum first_block, BlockNum last_block, ByteView value) {
+    if (first_block > last_block || last_block + kHistoricalStateCacheReorgDepth > head_block_) {
+        return;
+    }
+
+    std::scoped_lock lock{mutex_};
+    auto entry_it = entry_by_key_.find(key);
+    if (entry_it == entry_by_key_.end()) {
+        entries_.push_front(Entry{.key = Bytes{key}, .ranges_by_last_block = {}});
+        entry_it = entry_by_key_.emplace(entries_.front().key, entries_.begin()).first;
+        size_ += key.size() + kEntryOverhead;
+    } else {
+        entries_.splice(entries_.begin(), entries_, entry_it->second);
+    }
+
+    auto& ranges = entry_it->second->ranges_by_last_block;
+    const auto [range_it, inserted] = ranges.try_emplace(last_block, ValueRange{first_block, Bytes{value}});
+    if (inserted) {
+        size_ += value.size() + kRangeOverhead;
+    } else {
+        // Lower bound of the same range may be known with different accuracy, just keep the widest one
+        range_it->second.first_block = std::min(range_it->second.first_block, first_block);
+    }
+
+    evict();
+}
+
+void HistoricalStateCache::set_head(BlockNum head_block) {
+    head_block_ = head_block;
+}
+
+std::size_t HistoricalStateCache::size() const {
+    std::scoped_lock lock{mutex_};
+    return size_;
+}
+
+std::size_t HistoricalStateCache::key_count() const {
+    std::scoped_lock lock{mutex_};
+    return entry_by_key_.size();
+}
+
+void HistoricalStateCache::evict() {
+    while (size_ > max_size_ && !entries_.empty()) {
+        const auto& entry = entries_.back();
+        for (const auto& [_, range] : entry.ranges_by_last_block) {
+            size_ -= range.value.size() + kRangeOverhead;
+        }
+        size_ -= entry.key.size() + kEntryOverhead;
+        entry_by_key_.erase(entry.key);
+        entries_.pop_back();
+        ++eviction_count_;
+    }
+    SILK_TRACE << "HistoricalStateCache::evict size: " << size_ << " keys: " << entry_by_key_.size();
+}
+
+}  // namespace silkworm::rpc
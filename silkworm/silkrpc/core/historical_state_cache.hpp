@@ -0,0 +1,93 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/bytes.hpp>
+
+namespace silkworm::rpc {
+
+//! The default max size in bytes of cached historical values
+constexpr std::size_t kDefaultMaxHistoricalStateCacheSize{64_Mebi};
+
+//! The number of blocks below the chain head considered subject to reorganization
+constexpr BlockNum kHistoricalStateCacheReorgDepth{64};
+
+//! Cache of historical state values resolved through history indices and change sets, shared among the execution
+//! contexts. Each value is stored along with its validity range [first_block, last_block], so that any read of the
+//! same key at a block within the range is answered by one lookup. Only ranges ending deeper than
+//! kHistoricalStateCacheReorgDepth blocks below the chain head are accepted, because history above can still change.
+class HistoricalStateCache {
+  public:
+    explicit HistoricalStateCache(std::size_t max_size = kDefaultMaxHistoricalStateCacheSize) : max_size_{max_size} {}
+
+    HistoricalStateCache(const HistoricalStateCache&) = delete;
+    HistoricalStateCache& operator=(const HistoricalStateCache&) = delete;
+
+    //! Get the cached value of the specified key at the specified block, if any
+    std::optional<Bytes> get(ByteView key, BlockNum block_number);
+
+    //! Insert the value of the specified key valid for any block in [first_block, last_block]
+    void put(ByteView key, BlockNum first_block, BlockNum last_block, ByteView value);
+
+    //! Advance the chain head used to decide which validity ranges are final
+    void set_head(BlockNum head_block);
+
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] std::size_t key_count() const;
+    [[nodiscard]] uint64_t hit_count() const { return hit_count_; }
+    [[nodiscard]] uint64_t miss_count() const { return miss_count_; }
+    [[nodiscard]] uint64_t eviction_count() const { return eviction_count_; }
+
+  private:
+    struct ValueRange {
+        BlockNum first_block{0};
+        Bytes value;
+    };
+
+    struct Entry {
+        Bytes key;
+        std::map<BlockNum, ValueRange> ranges_by_last_block;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    void evict();
+
+    std::size_t max_size_;
+    std::atomic<BlockNum> head_block_{0};
+
+    mutable std::mutex mutex_;
+    EntryList entries_;  // most recently used entries first
+    std::map<ByteView, EntryList::iterator, std::less<>> entry_by_key_;
+    std::size_t size_{0};
+
+    std::atomic_uint64_t hit_count_{0};
+    std::atomic_uint64_t miss_count_{0};
+    std::atomic_uint64_t eviction_count_{0};
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,105 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_cache.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::rpc {
+
+static const Bytes kKey1{*from_hex("0x0000000000000000000000000000000000000001")};
+static const Bytes kKey2{*from_hex("0x0000000000000000000000000000000000000002")};
+static const Bytes kValue1{*from_hex("0x0f01020203e801")};
+static const Bytes kValue2{*from_hex("0x0f01020203e802")};
+
+TEST_CASE("HistoricalStateCache::get", "[silkrpc][core][historical_state_cache]") {
+    HistoricalStateCache cache;
+    cache.set_head(1'000);
+
+    SECTION("empty cache") {
+        CHECK(!cache.get(kKey1, 100));
+        CHECK(cache.miss_count() == 1);
+    }
+
+    SECTION("any block within validity range") {
+        cache.put(kKey1, 100, 200, kValue1);
+        CHECK(cache.get(kKey1, 100) == kValue1);
+        CHECK(cache.get(kKey1, 150) == kValue1);
+        CHECK(cache.get(kKey1, 200) == kValue1);
+        CHECK(cache.hit_count() == 3);
+        CHECK(!cache.get(kKey1, 99));
+        CHECK(!cache.get(kKey1, 201));
+        CHECK(!cache.get(kKey2, 150));
+        CHECK(cache.miss_count() == 3);
+    }
+
+    SECTION("several validity ranges for the same key") {
+        cache.put(kKey1, 100, 200, kValue1);
+        cache.put(kKey1, 201, 300, kValue2);
+        CHECK(cache.get(kKey1, 200) == kValue1);
+        CHECK(cache.get(kKey1, 201) == kValue2);
+        CHECK(cache.key_count() == 1);
+    }
+
+    SECTION("same validity range keeps the widest lower bound") {
+        cache.put(kKey1, 150, 200, kValue1);
+        cache.put(kKey1, 100, 200, kValue1);
+        cache.put(kKey1, 180, 200, kValue1);
+        CHECK(cache.get(kKey1, 100) == kValue1);
+    }
+}
+
+TEST_CASE("HistoricalStateCache::put", "[silkrpc][core][historical_state_cache]") {
+    SECTION("range not deep enough below chain head") {
+        HistoricalStateCache cache;
+        cache.set_head(200 + kHistoricalStateCacheReorgDepth - 1);
+        cache.put(kKey1, 100, 200, kValue1);
+        CHECK(!cache.get(kKey1, 150));
+        cache.set_head(200 + kHistoricalStateCacheReorgDepth);
+        cache.put(kKey1, 100, 200, kValue1);
+        CHECK(cache.get(kKey1, 150) == kValue1);
+    }
+
+    SECTION("unknown chain head") {
+        HistoricalStateCache cache;
+        cache.put(kKey1, 100, 200, kValue1);
+        CHECK(cache.key_count() == 0);
+    }
+
+    SECTION("invalid range") {
+        HistoricalStateCache cache;
+        cache.set_head(1'000);
+        cache.put(kKey1, 201, 200, kValue1);
+        CHECK(cache.key_count() == 0);
+    }
+
+    SECTION("least recently used keys evicted over max size") {
+        HistoricalStateCache cache{500};
+        cache.set_head(1'000);
+        cache.put(kKey1, 100, 200, kValue1);
+        cache.put(kKey2, 100, 200, kValue2);
+        CHECK(cache.get(kKey1, 150) == kValue1);
+        cache.put(Bytes(kAddressLength, 0x03), 100, 200, kValue2);
+        CHECK(cache.size() <= 500);
+        CHECK(cache.eviction_count() == 1);
+        CHECK(cache.get(kKey1, 150) == kValue1);
+        CHECK(!cache.get(kKey2, 150));
+    }
+}
+
+}  // namespace silkworm::rpc
@@ -16,6 +16,8 @@
 
 #include "logs_walker.hpp"
 
+#include <chrono>
+#include <stdexcept>
 #include <string>
 
 #include <boost/endian/conversion.hpp>
@@ -108,6 +110,10 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
     std::uint64_t logCount{0};
     std::uint64_t blockCount{0};
 
+    // Do not let a single pathological query hold the worker indefinitely
+    const auto deadline{std::chrono::steady_clock::now() + max_duration_};
+    bool timeout_exceeded{false};
+
     Logs chunk_logs;
     Logs filtered_chunk_logs;
     Logs filtered_block_logs;
@@ -122,6 +128,10 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
         const auto block_key = silkworm::db::block_key(block_to_match);
         SILK_DEBUG << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
         co_await tx_database_.for_prefix(db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                timeout_exceeded = true;
+                return false;
+            }
             chunk_logs.clear();
             const bool decoding_ok{cbor_decode(v, chunk_logs)};
             if (!decoding_ok) {
@@ -147,6 +157,10 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
             }
             return options.log_count == 0 || options.log_count > logCount;
         });
+        if (timeout_exceeded) {
+            SILK_WARN << "LogsWalker::get_logs timeout exceeded after blocks: " << blockCount << " logs: " << logCount;
+            throw QueryTimeoutError{};
+        }
         SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
 
         if (!filtered_block_logs.empty()) {
@@ -173,6 +187,10 @@ Task<void> LogsWalker::get_logs(std::uint64_t start, std::uint64_t end,
         if (options.block_count != 0 && options.block_count == blockCount) {
             break;
         }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            SILK_WARN << "LogsWalker::get_logs timeout exceeded after blocks: " << blockCount << " logs: " << logCount;
+            throw QueryTimeoutError{};
+        }
     }
     SILK_DEBUG << "resulting logs size: " << logs.size();
 
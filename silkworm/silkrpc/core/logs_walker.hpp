@@ -16,13 +16,16 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 
 #include <boost/asio/awaitable.hpp>
 
 #include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/protocol/errors.hpp>
 #include <silkworm/silkrpc/types/filter.hpp>
 #include <silkworm/silkrpc/types/log.hpp>
 
@@ -32,8 +35,9 @@ using boost::asio::awaitable;
 
 class LogsWalker {
   public:
-    explicit LogsWalker(ethbackend::BackEnd* backend, BlockCache& block_cache, ethdb::TransactionDatabase& tx_database)
-        : backend_(backend), block_cache_(block_cache), tx_database_(tx_database) {}
+    explicit LogsWalker(ethbackend::BackEnd* backend, BlockCache& block_cache, ethdb::TransactionDatabase& tx_database,
+                        std::chrono::milliseconds max_duration = kDefaultLogsQueryTimeout)
+        : backend_(backend), block_cache_(block_cache), tx_database_(tx_database), max_duration_(max_duration) {}
 
     LogsWalker(const LogsWalker&) = delete;
     LogsWalker& operator=(const LogsWalker&) = delete;
@@ -55,6 +59,9 @@ class LogsWalker {
     ethbackend::BackEnd* backend_;
     BlockCache& block_cache_;
     ethdb::TransactionDatabase& tx_database_;
+
+    //! The maximum time spent scanning blocks in one query, checked after each log chunk
+    std::chrono::milliseconds max_duration_;
 };
 
 }  // namespace silkworm::rpc
@@ -0,0 +1,78 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "logs_walker.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
+#include <catch2/catch.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/core/common/block_cache.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/silkrpc/test/dummy_transaction.hpp>
+#include <silkworm/silkrpc/test/mock_cursor.hpp>
+
+namespace silkworm::rpc {
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+TEST_CASE("LogsWalker::get_logs timeout", "[silkrpc][core][logs_walker]") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    boost::asio::thread_pool pool{1};
+    BlockCache block_cache;
+    auto mock_cursor = std::make_shared<test::MockCursorDupSort>();
+    test::DummyTransaction transaction{0, mock_cursor};
+    ethdb::TransactionDatabase tx_database{transaction};
+
+    // One log chunk for transaction 0 in block 1, containing an empty CBOR array
+    Bytes log_key{db::block_key(1)};
+    log_key.append(4, uint8_t{0});
+    EXPECT_CALL(*mock_cursor, seek(_)).WillOnce(InvokeWithoutArgs([=]() -> Task<KeyValue> {
+        co_return KeyValue{log_key, Bytes{0x80}};
+    }));
+
+    std::vector<Log> logs;
+
+    SECTION("exceeded before the first log chunk") {
+        EXPECT_CALL(*mock_cursor, next()).Times(0);
+        LogsWalker logs_walker{/*backend=*/nullptr, block_cache, tx_database, std::chrono::milliseconds{0}};
+        auto result = boost::asio::co_spawn(pool, logs_walker.get_logs(1, 1, {}, {}, logs), boost::asio::use_future);
+        CHECK_THROWS_AS(result.get(), QueryTimeoutError);
+    }
+
+    SECTION("not exceeded") {
+        EXPECT_CALL(*mock_cursor, next()).WillOnce(InvokeWithoutArgs([]() -> Task<KeyValue> {
+            co_return KeyValue{};
+        }));
+        LogsWalker logs_walker{/*backend=*/nullptr, block_cache, tx_database, std::chrono::minutes{1}};
+        auto result = boost::asio::co_spawn(pool, logs_walker.get_logs(1, 1, {}, {}, logs), boost::asio::use_future);
+        CHECK_NOTHROW(result.get());
+        CHECK(logs.empty());
+    }
+}
+
+}  // namespace silkworm::rpc
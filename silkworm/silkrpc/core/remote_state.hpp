@@ -28,6 +28,7 @@
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/state/state.hpp>
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/storage/chain_storage.hpp>
@@ -36,8 +37,9 @@ namespace silkworm::rpc::state {
 
 class AsyncRemoteState {
   public:
-    explicit AsyncRemoteState(const core::rawdb::DatabaseReader& db_reader, const ChainStorage& storage, BlockNum block_number)
-        : storage_(storage), block_number_(block_number), state_reader_{db_reader} {}
+    explicit AsyncRemoteState(const core::rawdb::DatabaseReader& db_reader, const ChainStorage& storage, BlockNum block_number,
+                              HistoricalStateCache* historical_cache = nullptr)
+        : storage_(storage), block_number_(block_number), state_reader_{db_reader, historical_cache} {}
 
     Task<std::optional<silkworm::Account>> read_account(const evmc::address& address) const noexcept;
 
@@ -69,8 +71,9 @@ class AsyncRemoteState {
 
 class RemoteState : public silkworm::State {
   public:
-    explicit RemoteState(boost::asio::any_io_executor& executor, const core::rawdb::DatabaseReader& db_reader, const ChainStorage& storage, BlockNum block_number)
-        : executor_(executor), async_state_{db_reader, storage, block_number} {}
+    explicit RemoteState(boost::asio::any_io_executor& executor, const core::rawdb::DatabaseReader& db_reader, const ChainStorage& storage, BlockNum block_number,
+                         HistoricalStateCache* historical_cache = nullptr)
+        : executor_(executor), async_state_{db_reader, storage, block_number, historical_cache} {}
 
     std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
 
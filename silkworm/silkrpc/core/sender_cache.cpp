@@ -0,0 +1,114 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "sender_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <boost/asio/post.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc {
+
+static void recover_and_cache(silkworm::Transaction& txn, const evmc::bytes32& txn_hash, SenderCache* cache) {
+    txn.recover_sender();
+    if (cache && txn.from) {
+        cache->put(txn_hash, *txn.from);
+    }
+}
+
+void recover_sender(silkworm::Transaction& txn, SenderCache* cache) {
+    if (txn.from) {
+        return;
+    }
+    if (!cache) {
+        txn.recover_sender();
+        return;
+    }
+    const auto txn_hash{txn.hash()};
+    if (const auto sender{cache->get(txn_hash)}) {
+        txn.from = *sender;
+        return;
+    }
+    recover_and_cache(txn, txn_hash, cache);
+}
+
+//! The state of one batch recovery shared by the calling thread and the workers
+struct SenderRecovery {
+    SenderRecovery(std::vector<silkworm::Transaction>& txns, SenderCache* sender_cache)
+        : transactions{txns}, cache{sender_cache} {}
+
+    std::vector<silkworm::Transaction>& transactions;
+    SenderCache* cache;
+    std::vector<std::pair<std::size_t, evmc::bytes32>> missing;
+    std::atomic_size_t next_index{0};
+    std::atomic_size_t recovered_count{0};
+    std::mutex mutex;
+    std::condition_variable all_recovered;
+
+    //! Recover the missing senders until none is left to take, notifying when all have been recovered
+    void run() {
+        for (auto index{next_index++}; index < missing.size(); index = next_index++) {
+            const auto& [txn_index, txn_hash] = missing[index];
+            recover_and_cache(transactions[txn_index], txn_hash, cache);
+            if (++recovered_count == missing.size()) {
+                std::scoped_lock lock{mutex};
+                all_recovered.notify_one();
+            }
+        }
+    }
+};
+
+void recover_senders(std::vector<silkworm::Transaction>& transactions, boost::asio::thread_pool& workers, SenderCache* cache) {
+    auto recovery = std::make_shared<SenderRecovery>(transactions, cache);
+    for (std::size_t i{0}; i < transactions.size(); ++i) {
+        auto& txn{transactions[i]};
+        if (txn.from) {
+            continue;
+        }
+        const auto txn_hash{cache ? txn.hash() : evmc::bytes32{}};
+        if (const auto sender{cache ? cache->get(txn_hash) : std::nullopt}) {
+            txn.from = *sender;
+        } else {
+            recovery->missing.emplace_back(i, txn_hash);
+        }
+    }
+    if (recovery->missing.empty()) {
+        return;
+    }
+    SILK_TRACE << "recover_senders #txns: " << transactions.size() << " #missing: " << recovery->missing.size();
+
+    // Workers starting late find nothing left to do, so they keep the recovery state alive but never touch the input
+    if (recovery->missing.size() >= kMinParallelSenderRecovery) {
+        const std::size_t max_helpers{std::max(std::thread::hardware_concurrency(), 2u) - 1};
+        const std::size_t num_helpers{std::min(recovery->missing.size() / kMinParallelSenderRecovery, max_helpers)};
+        for (std::size_t i{0}; i < num_helpers; ++i) {
+            boost::asio::post(workers, [recovery]() { recovery->run(); });
+        }
+    }
+    recovery->run();
+
+    std::unique_lock lock{recovery->mutex};
+    recovery->all_recovered.wait(lock, [&]() { return recovery->recovered_count == recovery->missing.size(); });
+}
+
+}  // namespace silkworm::rpc
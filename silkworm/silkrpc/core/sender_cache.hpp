@@ -0,0 +1,63 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <boost/asio/thread_pool.hpp>
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/core/types/transaction.hpp>
+
+namespace silkworm::rpc {
+
+//! Default max number of transaction senders kept in cache
+inline constexpr std::size_t kDefaultSenderCacheCapacity{100'000};
+
+//! Min number of transactions lacking sender to recover them in parallel
+inline constexpr std::size_t kMinParallelSenderRecovery{8};
+
+//! Bounded cache of the senders recovered from transaction signatures, keyed by transaction hash.
+//! Senders should always come from storage (Senders table, snapshots or txpool metadata): this is the last resort
+//! to avoid repeating the same recovery again and again when they don't. One instance is shared by all the RPC
+//! execution contexts as shared service.
+class SenderCache {
+  public:
+    explicit SenderCache(std::size_t capacity = kDefaultSenderCacheCapacity) : senders_{capacity, /*thread_safe=*/true} {}
+
+    std::optional<evmc::address> get(const evmc::bytes32& txn_hash) { return senders_.get_as_copy(txn_hash); }
+
+    void put(const evmc::bytes32& txn_hash, const evmc::address& sender) { senders_.put(txn_hash, sender); }
+
+  private:
+    lru_cache<evmc::bytes32, evmc::address> senders_;
+};
+
+//! Set the sender of the transaction if missing, looking it up in the cache (if any) before recovering it
+void recover_sender(silkworm::Transaction& txn, SenderCache* cache);
+
+//! Set the sender of all the transactions missing it, looking them up in the cache (if any) before recovering them.
+//! Recovery runs in parallel on the workers together with the calling thread, which never waits for any worker to
+//! become available: hence it's safe to call this even from one of the workers.
+void recover_senders(std::vector<silkworm::Transaction>& transactions,
+                     boost::asio::thread_pool& workers,
+                     SenderCache* cache);
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,116 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "sender_cache.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address;
+
+// https://etherscan.io/tx/0x5c504ed432cb51138bcf09aa5e8a410dd4a1e204ef84bfed1be16dfba1b22060
+static silkworm::Transaction make_signed_transaction() {
+    return silkworm::Transaction{
+        {.type = TransactionType::kLegacy,
+         .nonce = 0,
+         .max_priority_fee_per_gas = 50'000 * kGiga,
+         .max_fee_per_gas = 50'000 * kGiga,
+         .gas_limit = 21'000,
+         .to = 0x5df9b87991262f6ba471f09758cde1c0fc1de734_address,
+         .value = 31337},
+        true,                                                                                                    // odd_y_parity
+        intx::from_string<intx::uint256>("0x88ff6cf0fefd94db46111149ae4bfc179e9b94721fffd821d38d16464b3f71d0"),  // r
+        intx::from_string<intx::uint256>("0x45e0aff800961cfce805daef7016b9b675c137a6a41a548f7b60a3484c06a33a"),  // s
+    };
+}
+
+static const evmc::address kSender{0xa1e4380a3b1f749673e270229993ee55f35663b4_address};
+
+TEST_CASE("recover_sender", "[silkrpc][core][sender_cache]") {
+    SenderCache cache;
+    auto txn{make_signed_transaction()};
+
+    SECTION("sender recovered and cached") {
+        recover_sender(txn, &cache);
+        CHECK(txn.from == kSender);
+        CHECK(cache.get(txn.hash()) == kSender);
+    }
+
+    SECTION("sender found in cache") {
+        const auto cached_sender{0x0000000000000000000000000000000000000001_address};
+        cache.put(txn.hash(), cached_sender);
+        recover_sender(txn, &cache);
+        CHECK(txn.from == cached_sender);
+    }
+
+    SECTION("sender already present") {
+        const auto stored_sender{0x0000000000000000000000000000000000000002_address};
+        txn.from = stored_sender;
+        recover_sender(txn, &cache);
+        CHECK(txn.from == stored_sender);
+        CHECK(!cache.get(txn.hash()));
+    }
+
+    SECTION("no cache") {
+        recover_sender(txn, nullptr);
+        CHECK(txn.from == kSender);
+    }
+}
+
+TEST_CASE("recover_senders", "[silkrpc][core][sender_cache]") {
+    SenderCache cache;
+    boost::asio::thread_pool workers{2};
+
+    SECTION("empty") {
+        std::vector<silkworm::Transaction> transactions;
+        CHECK_NOTHROW(recover_senders(transactions, workers, &cache));
+    }
+
+    SECTION("below parallel threshold") {
+        std::vector<silkworm::Transaction> transactions(kMinParallelSenderRecovery - 1, make_signed_transaction());
+        recover_senders(transactions, workers, &cache);
+        for (const auto& txn : transactions) {
+            CHECK(txn.from == kSender);
+        }
+    }
+
+    SECTION("above parallel threshold") {
+        std::vector<silkworm::Transaction> transactions(4 * kMinParallelSenderRecovery, make_signed_transaction());
+        transactions[1].from = 0x0000000000000000000000000000000000000002_address;
+        recover_senders(transactions, workers, &cache);
+        CHECK(transactions[0].from == kSender);
+        CHECK(transactions[1].from == 0x0000000000000000000000000000000000000002_address);
+        for (std::size_t i{2}; i < transactions.size(); ++i) {
+            CHECK(transactions[i].from == kSender);
+        }
+        CHECK(cache.get(transactions[0].hash()) == kSender);
+    }
+
+    SECTION("no cache") {
+        std::vector<silkworm::Transaction> transactions(4 * kMinParallelSenderRecovery, make_signed_transaction());
+        recover_senders(transactions, workers, nullptr);
+        for (const auto& txn : transactions) {
+            CHECK(txn.from == kSender);
+        }
+    }
+
+    workers.join();
+}
+
+}  // namespace silkworm::rpc
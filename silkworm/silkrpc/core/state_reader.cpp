@@ -28,6 +28,17 @@
 
 namespace silkworm::rpc {
 
+//! Compute the lowest block whose historical value is resolved by the same change found seeking from block_number
+//! \remarks we look just into the given history shard, so we cannot go lower than block_number if change is its first
+static BlockNum first_block_for_change(const roaring::Roaring64Map& bitmap, BlockNum change_block, BlockNum block_number) {
+    const auto change_rank{bitmap.rank(change_block)};
+    uint64_t previous_change_block{0};
+    if (change_rank > 1 && bitmap.select(change_rank - 2, &previous_change_block)) {
+        return previous_change_block + 1;
+    }
+    return block_number;
+}
+
 Task<std::optional<silkworm::Account>> StateReader::read_account(const evmc::address& address, BlockNum block_number) const {
     std::optional<silkworm::Bytes> encoded{co_await read_historical_account(address, block_number)};
     if (!encoded) {
@@ -82,12 +93,18 @@ Task<std::optional<silkworm::Bytes>> StateReader::read_code(const evmc::bytes32&
 }
 
 Task<std::optional<silkworm::Bytes>> StateReader::read_historical_account(const evmc::address& address, BlockNum block_number) const {
+    const auto address_view{full_view(address)};
+    if (historical_cache_) {
+        if (auto cached_value{historical_cache_->get(address_view, block_number)}) {
+            co_return cached_value;
+        }
+    }
+
     const auto account_history_key{silkworm::db::account_history_key(address, block_number)};
     SILK_DEBUG << "StateReader::read_historical_account account_history_key: " << account_history_key;
     const auto kv_pair{co_await db_reader_.get(db::table::kAccountHistoryName, account_history_key)};
 
     SILK_DEBUG << "StateReader::read_historical_account kv_pair.key: " << silkworm::to_hex(kv_pair.key);
-    const auto address_view{full_view(address)};
     if (kv_pair.key.substr(0, silkworm::kAddressLength) != address_view) {
         co_return std::nullopt;
     }
@@ -111,11 +128,25 @@ Task<std::optional<silkworm::Bytes>> StateReader::read_historical_account(const
     const auto value{co_await db_reader_.get_both_range(db::table::kAccountChangeSetName, block_key, address_subkey)};
     SILK_DEBUG << "StateReader::read_historical_account value: " << (value ? *value : silkworm::Bytes{});
 
+    if (historical_cache_ && value) {
+        const auto first_block{first_block_for_change(bitmap, *change_block, block_number)};
+        historical_cache_->put(address_view, first_block, *change_block, *value);
+    }
+
     co_return value;
 }
 
 Task<std::optional<silkworm::Bytes>> StateReader::read_historical_storage(const evmc::address& address, uint64_t incarnation,
                                                                           const evmc::bytes32& location_hash, BlockNum block_number) const {
+    silkworm::Bytes cache_key;
+    if (historical_cache_) {
+        cache_key = silkworm::db::storage_prefix(full_view(address), incarnation);
+        cache_key.append(full_view(location_hash));
+        if (auto cached_value{historical_cache_->get(cache_key, block_number)}) {
+            co_return cached_value;
+        }
+    }
+
     const auto storage_history_key{silkworm::db::storage_history_key(address, location_hash, block_number)};
     SILK_DEBUG << "StateReader::read_historical_storage storage_history_key: " << storage_history_key;
     const auto kv_pair{co_await db_reader_.get(db::table::kStorageHistoryName, storage_history_key)};
@@ -141,6 +172,11 @@ Task<std::optional<silkworm::Bytes>> StateReader::read_historical_storage(const
     const auto value{co_await db_reader_.get_both_range(db::table::kStorageChangeSetName, storage_change_key, location_subkey)};
     SILK_DEBUG << "StateReader::read_historical_storage value: " << (value ? *value : silkworm::Bytes{});
 
+    if (historical_cache_ && value) {
+        const auto first_block{first_block_for_change(bitmap, *change_block, block_number)};
+        historical_cache_->put(cache_key, first_block, *change_block, *value);
+    }
+
     co_return value;
 }
 }  // namespace silkworm::rpc
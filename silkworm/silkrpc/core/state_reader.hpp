@@ -25,13 +25,15 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/account.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 
 namespace silkworm::rpc {
 
 class StateReader {
   public:
-    explicit StateReader(const core::rawdb::DatabaseReader& db_reader) : db_reader_(db_reader) {}
+    explicit StateReader(const core::rawdb::DatabaseReader& db_reader, HistoricalStateCache* historical_cache = nullptr)
+        : db_reader_(db_reader), historical_cache_(historical_cache) {}
 
     StateReader(const StateReader&) = delete;
     StateReader& operator=(const StateReader&) = delete;
@@ -53,6 +55,7 @@ class StateReader {
 
   private:
     const core::rawdb::DatabaseReader& db_reader_;
+    HistoricalStateCache* historical_cache_;
 };
 
 }  // namespace silkworm::rpc
@@ -33,6 +33,8 @@
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/silkrpc/common/compatibility.hpp>
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
+#include <silkworm/silkrpc/core/sender_cache.hpp>
 #include <silkworm/silkrpc/ethbackend/remote_backend.hpp>
 #include <silkworm/silkrpc/ethdb/file/local_database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/remote_database.hpp>
@@ -213,9 +215,9 @@ Daemon::Daemon(DaemonSettings settings, std::optional<mdbx::env> chaindata_env)
         chaindata_env_ = std::move(chaindata_env);
     }
 
-    // Create private and shared state in execution contexts
-    add_private_services();
+    // Create shared and private state in execution contexts (private state may depend on the shared one)
     add_shared_services();
+    add_private_services();
 
     // Create the unique KV state-changes stream feeding the state cache
     auto& context = context_pool_.next_context();
@@ -236,9 +238,11 @@ void Daemon::add_private_services() {
 
         std::unique_ptr<ethdb::Database> database;
         if (chaindata_env_) {
+            // LocalState reads history straight from memory-mapped MDBX, so the historical state cache is not needed
             database = std::make_unique<ethdb::file::LocalDatabase>(*chaindata_env_);
         } else {
-            database = std::make_unique<ethdb::kv::RemoteDatabase>(grpc_context, grpc_channel);
+            auto* historical_cache{must_use_shared_service<HistoricalStateCache>(io_context)};
+            database = std::make_unique<ethdb::kv::RemoteDatabase>(grpc_context, grpc_channel, historical_cache);
         }
         auto backend{std::make_unique<rpc::ethbackend::RemoteBackEnd>(io_context, grpc_channel, grpc_context)};
         auto tx_pool{std::make_unique<txpool::TransactionPool>(io_context, grpc_channel, grpc_context)};
@@ -256,6 +260,10 @@ void Daemon::add_shared_services() {
     auto block_cache = std::make_shared<BlockCache>();
     // Create the unique state cache to be shared among the execution contexts
     auto state_cache = std::make_shared<ethdb::kv::CoherentStateCache>();
+    // Create the unique historical state cache to be shared among the execution contexts
+    auto historical_cache = std::make_shared<HistoricalStateCache>();
+    // Create the unique cache of recovered transaction senders to be shared among the execution contexts
+    auto sender_cache = std::make_shared<SenderCache>();
     // Create the unique filter storage to be shared among the execution contexts
     auto filter_storage = std::make_shared<FilterStorage>(context_pool_.num_contexts() * kDefaultFilterStorageSize);
 
@@ -265,6 +273,8 @@ void Daemon::add_shared_services() {
 
         add_shared_service(io_context, block_cache);
         add_shared_service<ethdb::kv::StateCache>(io_context, state_cache);
+        add_shared_service(io_context, historical_cache);
+        add_shared_service(io_context, sender_cache);
         add_shared_service(io_context, filter_storage);
     }
 }
@@ -298,12 +308,14 @@ void Daemon::start() {
         if (not settings_.eth_end_point.empty()) {
             rpc_services_.emplace_back(
                 std::make_unique<http::Server>(
-                    settings_.eth_end_point, settings_.eth_api_spec, ioc, worker_pool_, settings_.cors_domain, /*jwt_secret=*/std::nullopt));
+                    settings_.eth_end_point, settings_.eth_api_spec, ioc, worker_pool_, settings_.cors_domain, /*jwt_secret=*/std::nullopt,
+                    settings_.logs_query_timeout, settings_.trace_filter_max_blocks));
         }
         if (not settings_.engine_end_point.empty()) {
             rpc_services_.emplace_back(
                 std::make_unique<http::Server>(
-                    settings_.engine_end_point, kDefaultEth2ApiSpec, ioc, worker_pool_, settings_.cors_domain, jwt_secret_));
+                    settings_.engine_end_point, kDefaultEth2ApiSpec, ioc, worker_pool_, settings_.cors_domain, jwt_secret_,
+                    settings_.logs_query_timeout, settings_.trace_filter_max_blocks));
         }
     }
 
@@ -221,7 +221,7 @@ Task<PeerInfos> RemoteBackEnd::peers() {
     co_return peer_infos;
 }
 
-Task<bool> RemoteBackEnd::get_block(BlockNum block_number, const HashAsSpan& hash, bool read_senders, silkworm::Block& block) {
+Task<bool> RemoteBackEnd::get_block(BlockNum block_number, const HashAsSpan& hash, bool /*read_senders*/, silkworm::Block& block) {
     const auto start_time = clock_time::now();
     UnaryRpc<&::remote::ETHBACKEND::StubInterface::AsyncBlock> get_block_rpc{*stub_, grpc_context_};
     ::remote::BlockRequest request;
@@ -232,15 +232,12 @@ Task<bool> RemoteBackEnd::get_block(BlockNum block_number, const HashAsSpan& has
     if (const auto decode_result{rlp::decode(block_rlp, block)}; !decode_result) {
         co_return false;
     }
-    if (read_senders) {
-        ByteView senders{byte_view_of_string(reply.senders())};
-        if (senders.size() % kAddressLength == 0 and senders.size() / kAddressLength == block.transactions.size()) {
-            std::vector<evmc::address> sender_addresses;
-            sender_addresses.reserve(block.transactions.size());
-            for (size_t i{0}; i < block.transactions.size(); ++i) {
-                ByteView sender{senders.substr(i * kAddressLength, kAddressLength)};
-                block.transactions[i].from = bytes_to_address(sender);
-            }
+    // Senders come for free in the reply, so use them even if not requested to avoid any recovery later on
+    ByteView senders{byte_view_of_string(reply.senders())};
+    if (senders.size() == block.transactions.size() * kAddressLength) {
+        for (size_t i{0}; i < block.transactions.size(); ++i) {
+            ByteView sender{senders.substr(i * kAddressLength, kAddressLength)};
+            block.transactions[i].from = bytes_to_address(sender);
         }
     }
     SILK_TRACE << "RemoteBackEnd::get_block t=" << clock_time::since(start_time);
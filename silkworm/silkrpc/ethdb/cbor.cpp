@@ -17,15 +17,14 @@
 #include "cbor.hpp"
 
 #include <algorithm>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 #include <cbor/cbor.h>
 #include <cbor/listener.h>
-#include <nlohmann/json.hpp>
 
 #include <silkworm/infra/common/log.hpp>
-#include <silkworm/silkrpc/json/types.hpp>
 
 namespace silkworm::rpc {
 
@@ -186,21 +185,160 @@ bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs) {
     return decode_success;
 }
 
+//! ReceiptCborListener decodes the Erigon-compatible CBOR representation of receipts directly into Receipt
+//! structures, avoiding the intermediate JSON document built by a generic CBOR parser
+class ReceiptCborListener : public cbor::listener {
+  private:
+    enum class ProcessingState {
+        kWaitNReceipts,
+        kWaitNFields,
+        kWaitType,
+        kWaitPostState,
+        kWaitStatus,
+        kWaitCumulativeGasUsed,
+        kDone
+    };
+
+  public:
+    explicit ReceiptCborListener(std::vector<Receipt>& receipts)
+        : state_(ProcessingState::kWaitNReceipts), receipts_(receipts) {}
+
+    void on_integer(int value) override {
+        if (value < 0) {
+            throw_invalid_argument("Receipt CBOR: unexpected format(on_integer negative value)");
+        }
+        on_unsigned(static_cast<uint64_t>(value));
+    }
+
+    void on_extra_integer(unsigned long long value, int sign) override {
+        if (sign < 0) {
+            throw_invalid_argument("Receipt CBOR: unexpected format(on_extra_integer negative value)");
+        }
+        on_unsigned(value);
+    }
+
+    void on_null() override {
+        if (state_ == ProcessingState::kWaitNReceipts) {
+            state_ = ProcessingState::kDone;  // no receipts
+        } else if (state_ == ProcessingState::kWaitPostState) {
+            state_ = ProcessingState::kWaitStatus;
+        } else {
+            throw_invalid_argument("Receipt CBOR: unexpected format(on_null bad state)");
+        }
+    }
+
+    void on_array(int size) override {
+        if (size < 0) {
+            throw_invalid_argument("Receipt CBOR: unexpected format(on_array negative size)");
+        }
+        if (state_ == ProcessingState::kWaitNReceipts) {
+            num_receipts_ = static_cast<std::size_t>(size);
+            receipts_.reserve(num_receipts_);
+            state_ = num_receipts_ == 0 ? ProcessingState::kDone : ProcessingState::kWaitNFields;
+        } else if (state_ == ProcessingState::kWaitNFields) {
+            if (size < 4) {
+                throw_invalid_argument("Receipt CBOR: missing entries");
+            }
+            if (size > 4) {
+                throw_invalid_argument("Receipt CBOR: unexpected format(on_array too many entries)");
+            }
+            receipts_.emplace_back();
+            state_ = ProcessingState::kWaitType;
+        } else {
+            throw_invalid_argument("Receipt CBOR: unexpected format(on_array bad state)");
+        }
+    }
+
+    void on_bytes(unsigned char*, int) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_bytes)");
+    }
+
+    void on_map(int) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_map)");
+    }
+
+    void on_string(std::string&) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_string)");
+    }
+
+    void on_tag(unsigned int) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_tag)");
+    }
+
+    void on_undefined() override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_undefined)");
+    }
+
+    void on_bool(bool) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_bool)");
+    }
+
+    void on_extra_tag(unsigned long long) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_extra_tag)");
+    }
+
+    void on_float32(float) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_float)");
+    }
+
+    void on_double(double) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_double)");
+    }
+
+    void on_extra_special(unsigned long long) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_extra_special)");
+    }
+
+    void on_error(const char*) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_error)");
+    }
+
+    void on_special(unsigned int) override {
+        throw_invalid_argument("Receipt CBOR: unexpected format(on_special)");
+    }
+
+    bool success() const {
+        return state_ == ProcessingState::kDone;
+    }
+
+  private:
+    void on_unsigned(uint64_t value) {
+        if (state_ == ProcessingState::kWaitType) {
+            receipts_.back().type = static_cast<uint8_t>(value);
+            state_ = ProcessingState::kWaitPostState;
+        } else if (state_ == ProcessingState::kWaitStatus) {
+            receipts_.back().success = value == 1u;
+            state_ = ProcessingState::kWaitCumulativeGasUsed;
+        } else if (state_ == ProcessingState::kWaitCumulativeGasUsed) {
+            receipts_.back().cumulative_gas_used = value;
+            state_ = receipts_.size() == num_receipts_ ? ProcessingState::kDone : ProcessingState::kWaitNFields;
+        } else {
+            throw_invalid_argument("Receipt CBOR: unexpected format(integer bad state)");
+        }
+    }
+
+    [[noreturn]] static void throw_invalid_argument(const char* message) {
+        throw std::system_error{std::make_error_code(std::errc::invalid_argument), message};
+    }
+
+    ProcessingState state_;
+    std::size_t num_receipts_{0};
+    std::vector<Receipt>& receipts_;
+};
+
 bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Receipt>& receipts) {
     if (bytes.empty()) {
         return false;
     }
-    auto json = nlohmann::json::from_cbor(bytes);
-    SILK_TRACE << "cbor_decode<std::vector<Receipt>> json: " << json.dump();
-    if (json.is_array()) {
-        receipts = json.get<std::vector<Receipt>>();
-        return true;
-    } else if (json.is_null()) {
-        return true;
-    } else {
-        SILK_ERROR << "cbor_decode<std::vector<Receipt>> unexpected json: " << json.dump();
-        return false;
+    const void* data = static_cast<const void*>(bytes.data());
+    cbor::input input(const_cast<void*>(data), static_cast<int>(bytes.size()));
+    ReceiptCborListener listener(receipts);
+    cbor::decoder decoder(input, listener);
+    decoder.run();
+    if (!listener.success()) {
+        throw std::system_error{std::make_error_code(std::errc::invalid_argument), "Receipt CBOR: unexpected end of input"};
     }
+    return true;
 }
 
 }  // namespace silkworm::rpc
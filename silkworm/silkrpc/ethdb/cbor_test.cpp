@@ -176,6 +176,30 @@ TEST_CASE("decode receipts from CBOR 3", "[silkrpc][ethdb][cbor]") {
     CHECK(receipts[2].cumulative_gas_used == 0x3947f4);
 }
 
+TEST_CASE("decode receipts from null", "[silkrpc][ethdb][cbor]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    Receipts receipts{};
+    CHECK(cbor_decode(*silkworm::from_hex("f6"), receipts));
+    CHECK(receipts.empty());
+}
+
+TEST_CASE("decode receipts with large cumulative gas", "[silkrpc][ethdb][cbor]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    Receipts receipts{};
+    CHECK(cbor_decode(*silkworm::from_hex(
+                          "82"
+                          "8402f6001a80000000"
+                          "8402f6011b0000000100000000"),
+                      receipts));
+    CHECK(receipts.size() == 2);
+    CHECK(receipts[0].type == 2);
+    CHECK(receipts[0].success == false);
+    CHECK(receipts[0].cumulative_gas_used == 0x80000000);
+    CHECK(receipts[1].type == 2);
+    CHECK(receipts[1].success == true);
+    CHECK(receipts[1].cumulative_gas_used == 0x100000000);
+}
+
 TEST_CASE("decode receipts from incorrect bytes", "[silkrpc][ethdb][cbor]") {
     test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
     Receipts receipts{};
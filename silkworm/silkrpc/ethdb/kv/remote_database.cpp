@@ -21,8 +21,9 @@
 
 namespace silkworm::rpc::ethdb::kv {
 
-RemoteDatabase::RemoteDatabase(agrpc::GrpcContext& grpc_context, const std::shared_ptr<grpc::Channel>& channel)
-    : grpc_context_(grpc_context), stub_{remote::KV::NewStub(channel)} {
+RemoteDatabase::RemoteDatabase(agrpc::GrpcContext& grpc_context, const std::shared_ptr<grpc::Channel>& channel,
+                               HistoricalStateCache* historical_cache)
+    : grpc_context_(grpc_context), stub_{remote::KV::NewStub(channel)}, historical_cache_{historical_cache} {
     SILK_TRACE << "RemoteDatabase::ctor " << this;
 }
 
@@ -37,7 +38,7 @@ RemoteDatabase::~RemoteDatabase() {
 
 Task<std::unique_ptr<Transaction>> RemoteDatabase::begin() {
     SILK_TRACE << "RemoteDatabase::begin " << this << " start";
-    auto txn = std::make_unique<RemoteTransaction>(*stub_, grpc_context_);
+    auto txn = std::make_unique<RemoteTransaction>(*stub_, grpc_context_, historical_cache_);
     co_await txn->open();
     SILK_TRACE << "RemoteDatabase::begin " << this << " txn: " << txn.get() << " end";
     co_return txn;
@@ -23,6 +23,7 @@
 #include <grpcpp/grpcpp.h>
 
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
 #include <silkworm/silkrpc/ethbackend/remote_backend.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
@@ -31,7 +32,8 @@ namespace silkworm::rpc::ethdb::kv {
 
 class RemoteDatabase : public Database {
   public:
-    RemoteDatabase(agrpc::GrpcContext& grpc_context, const std::shared_ptr<grpc::Channel>& channel);
+    RemoteDatabase(agrpc::GrpcContext& grpc_context, const std::shared_ptr<grpc::Channel>& channel,
+                   HistoricalStateCache* historical_cache = nullptr);
     RemoteDatabase(agrpc::GrpcContext& grpc_context, std::unique_ptr<remote::KV::StubInterface>&& stub);
     ~RemoteDatabase() override;
 
@@ -43,6 +45,7 @@ class RemoteDatabase : public Database {
   private:
     agrpc::GrpcContext& grpc_context_;
     std::unique_ptr<remote::KV::StubInterface> stub_;
+    HistoricalStateCache* historical_cache_{nullptr};
 };
 
 }  // namespace silkworm::rpc::ethdb::kv
@@ -64,7 +64,7 @@ Task<std::shared_ptr<CursorDupSort>> RemoteTransaction::get_cursor(const std::st
 }
 
 std::shared_ptr<silkworm::State> RemoteTransaction::create_state(boost::asio::any_io_executor& executor, const DatabaseReader& db_reader, const ChainStorage& storage, BlockNum block_number) {
-    return std::make_shared<silkworm::rpc::state::RemoteState>(executor, db_reader, storage, block_number);
+    return std::make_shared<silkworm::rpc::state::RemoteState>(executor, db_reader, storage, block_number, historical_cache_);
 }
 
 std::shared_ptr<ChainStorage> RemoteTransaction::create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) {
@@ -26,6 +26,7 @@
 #include <agrpc/grpc_context.hpp>
 #include <grpcpp/grpcpp.h>
 
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/remote_cursor.hpp>
@@ -36,8 +37,9 @@ namespace silkworm::rpc::ethdb::kv {
 
 class RemoteTransaction : public Transaction {
   public:
-    RemoteTransaction(::remote::KV::StubInterface& stub, agrpc::GrpcContext& grpc_context)
-        : tx_rpc_{stub, grpc_context} {}
+    RemoteTransaction(::remote::KV::StubInterface& stub, agrpc::GrpcContext& grpc_context,
+                      HistoricalStateCache* historical_cache = nullptr)
+        : tx_rpc_{stub, grpc_context}, historical_cache_{historical_cache} {}
 
     ~RemoteTransaction() override = default;
 
@@ -62,6 +64,7 @@ class RemoteTransaction : public Transaction {
     std::map<std::string, std::shared_ptr<CursorDupSort>> dup_cursors_;
     TxRpc tx_rpc_;
     uint64_t view_id_{0};
+    HistoricalStateCache* historical_cache_;
 };
 
 }  // namespace silkworm::rpc::ethdb::kv
@@ -43,6 +43,7 @@ StateChangesStream::StateChangesStream(ClientContext& context, remote::KV::StubI
       grpc_context_(*context.grpc_context()),
       stub_(stub),
       cache_(must_use_shared_service<ethdb::kv::StateCache>(scheduler_)),
+      historical_cache_(use_shared_service<HistoricalStateCache>(scheduler_)),
       retry_timer_{scheduler_} {}
 
 std::future<void> StateChangesStream::open() {
@@ -102,6 +103,9 @@ Task<void> StateChangesStream::run() {
             if (!read_ec) {
                 SILK_TRACE << "State changes batch received: " << reply << "";
                 cache_->on_new_block(reply);
+                if (historical_cache_ && reply.change_batch_size() > 0) {
+                    historical_cache_->set_head(reply.change_batch(reply.change_batch_size() - 1).block_height());
+                }
             } else {
                 if (read_ec.value() == grpc::StatusCode::CANCELLED) {
                     cancelled = true;
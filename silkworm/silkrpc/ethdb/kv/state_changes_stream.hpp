@@ -32,6 +32,7 @@
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/interfaces/remote/kv.grpc.pb.h>
+#include <silkworm/silkrpc/core/historical_state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/kv/rpc.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 
@@ -87,6 +88,9 @@ class StateChangesStream {
     //! The local state cache where the received state changes will be applied
     StateCache* cache_;
 
+    //! The historical state cache (if any) following the chain head
+    HistoricalStateCache* historical_cache_;
+
     //! The signal used to cancel the register-and-receive stream loop
     boost::asio::cancellation_signal cancellation_signal_;
 
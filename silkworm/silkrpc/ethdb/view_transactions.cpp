@@ -0,0 +1,56 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "view_transactions.hpp"
+
+#include <exception>
+#include <memory>
+
+namespace silkworm::rpc::ethdb {
+
+Task<void> with_view_transactions(Database& database, Transaction& tx, std::size_t max_transactions, ViewTransactionsTask task) {
+    std::vector<std::unique_ptr<Transaction>> pinned_txs;
+    std::exception_ptr task_exception;
+    try {
+        while (pinned_txs.size() + 1 < max_transactions) {
+            pinned_txs.push_back(co_await database.begin());
+            if (pinned_txs.back()->view_id() != tx.view_id()) {
+                // Some state change has been committed in the meantime, so no more transactions can see the same view
+                break;
+            }
+        }
+
+        std::vector<Transaction*> view_txs{&tx};
+        for (const auto& pinned_tx : pinned_txs) {
+            if (pinned_tx->view_id() == tx.view_id()) {
+                view_txs.push_back(pinned_tx.get());
+            }
+        }
+
+        co_await task(view_txs);
+    } catch (...) {
+        task_exception = std::current_exception();
+    }
+
+    for (const auto& pinned_tx : pinned_txs) {
+        co_await pinned_tx->close();  // RAII not (yet) available with coroutines
+    }
+    if (task_exception) {
+        std::rethrow_exception(task_exception);
+    }
+}
+
+}  // namespace silkworm::rpc::ethdb
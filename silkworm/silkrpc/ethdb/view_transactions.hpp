@@ -0,0 +1,39 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <absl/functional/function_ref.h>
+
+#include <silkworm/silkrpc/ethdb/database.hpp>
+#include <silkworm/silkrpc/ethdb/transaction.hpp>
+
+namespace silkworm::rpc::ethdb {
+
+using ViewTransactionsTask = absl::FunctionRef<Task<void>(const std::vector<Transaction*>&)>;
+
+//! Run the task on the given transaction plus the additional ones opened on the same view, up to max_transactions.
+//! Cursors cannot be shared by concurrent reads, so each one needs its own transaction: just the transactions seeing
+//! the same state as the given one are used, hence the task gets just that one if the state has moved on meanwhile.
+//! The additional transactions are closed when the task completes, even if it fails.
+Task<void> with_view_transactions(Database& database, Transaction& tx, std::size_t max_transactions, ViewTransactionsTask task);
+
+}  // namespace silkworm::rpc::ethdb
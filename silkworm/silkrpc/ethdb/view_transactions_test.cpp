@@ -0,0 +1,102 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "view_transactions.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
+#include <catch2/catch.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/silkrpc/test/mock_database.hpp>
+#include <silkworm/silkrpc/test/mock_transaction.hpp>
+
+namespace silkworm::rpc::ethdb {
+
+using testing::InvokeWithoutArgs;
+using testing::Return;
+
+static constexpr uint64_t kTestViewId{42};
+
+//! Open a transaction on the given view which expects to be closed exactly once
+static Task<std::unique_ptr<Transaction>> begin_on_view(uint64_t view_id) {
+    auto mock_tx = std::make_unique<test::MockTransaction>();
+    EXPECT_CALL(*mock_tx, view_id()).WillRepeatedly(Return(view_id));
+    EXPECT_CALL(*mock_tx, close()).WillOnce(InvokeWithoutArgs([]() -> Task<void> { co_return; }));
+    co_return mock_tx;
+}
+
+TEST_CASE("with_view_transactions", "[silkrpc][ethdb][view_transactions]") {
+    boost::asio::thread_pool pool{1};
+    test::MockDatabase database;
+    test::MockTransaction tx;
+    EXPECT_CALL(tx, view_id()).WillRepeatedly(Return(kTestViewId));
+    EXPECT_CALL(tx, close()).Times(0);
+
+    std::vector<Transaction*> task_txs;
+    auto collect_txs = [&](const std::vector<Transaction*>& view_txs) -> Task<void> {
+        task_txs = view_txs;
+        co_return;
+    };
+
+    SECTION("single transaction") {
+        EXPECT_CALL(database, begin()).Times(0);
+        auto result = boost::asio::co_spawn(pool, with_view_transactions(database, tx, 1, collect_txs), boost::asio::use_future);
+        CHECK_NOTHROW(result.get());
+        CHECK(task_txs == std::vector<Transaction*>{&tx});
+    }
+
+    SECTION("all transactions on the same view") {
+        EXPECT_CALL(database, begin()).Times(3).WillRepeatedly(InvokeWithoutArgs([]() { return begin_on_view(kTestViewId); }));
+        auto result = boost::asio::co_spawn(pool, with_view_transactions(database, tx, 4, collect_txs), boost::asio::use_future);
+        CHECK_NOTHROW(result.get());
+        REQUIRE(task_txs.size() == 4);
+        CHECK(task_txs[0] == &tx);
+        for (const auto* view_tx : task_txs) {
+            CHECK(view_tx->view_id() == kTestViewId);
+        }
+    }
+
+    SECTION("state changed after the first additional transaction") {
+        EXPECT_CALL(database, begin())
+            .WillOnce(InvokeWithoutArgs([]() { return begin_on_view(kTestViewId); }))
+            .WillOnce(InvokeWithoutArgs([]() { return begin_on_view(kTestViewId + 1); }));
+        auto result = boost::asio::co_spawn(pool, with_view_transactions(database, tx, 4, collect_txs), boost::asio::use_future);
+        CHECK_NOTHROW(result.get());
+        REQUIRE(task_txs.size() == 2);
+        CHECK(task_txs[0] == &tx);
+        CHECK(task_txs[1]->view_id() == kTestViewId);
+    }
+
+    SECTION("task failure closes the additional transactions") {
+        EXPECT_CALL(database, begin()).Times(2).WillRepeatedly(InvokeWithoutArgs([]() { return begin_on_view(kTestViewId); }));
+        auto failing_task = [](const std::vector<Transaction*>& /*view_txs*/) -> Task<void> {
+            throw std::runtime_error{"task failure"};
+            co_return;
+        };
+        auto result = boost::asio::co_spawn(pool, with_view_transactions(database, tx, 3, failing_task), boost::asio::use_future);
+        CHECK_THROWS_AS(result.get(), std::runtime_error);
+    }
+}
+
+}  // namespace silkworm::rpc::ethdb
@@ -24,6 +24,7 @@
 
 #include <exception>
 #include <fstream>
+#include <string>
 #include <string_view>
 
 #include <boost/asio/use_awaitable.hpp>
@@ -82,20 +83,33 @@ Task<void> Connection::do_read() {
     SILK_DEBUG << "Connection::do_read bytes_read: " << bytes_read;
     SILK_TRACE << "Connection::do_read buffer: " << std::string_view{static_cast<const char*>(buffer_.data()), bytes_read};
 
-    RequestParser::ResultType result = request_parser_.parse(request_, buffer_.data(), buffer_.data() + bytes_read);
-
-    if (result == RequestParser::ResultType::good) {
-        co_await request_handler_.handle(request_);
-        clean();
-    } else if (result == RequestParser::ResultType::bad) {
-        reply_ = Reply::stock_reply(StatusType::bad_request);
-        co_await do_write();
-        clean();
-    } else if (result == RequestParser::ResultType::processing_continue) {
-        reply_ = Reply::stock_reply(StatusType::processing_continue);
-        co_await do_write();
-        reply_.reset();
-    }
+    const char* begin{buffer_.data()};
+    const char* end{buffer_.data() + bytes_read};
+    std::string pipelined_data;
+    do {
+        RequestParser::ResultType result = request_parser_.parse(request_, begin, end);
+
+        if (result == RequestParser::ResultType::good) {
+            co_await request_handler_.handle(request_);
+            // Back-to-back requests received in the same read must be handled in order, as they come
+            pipelined_data = request_parser_.release_pipelined_data();
+            begin = pipelined_data.data();
+            end = pipelined_data.data() + pipelined_data.size();
+            clean();
+        } else if (result == RequestParser::ResultType::bad) {
+            reply_ = Reply::stock_reply(StatusType::bad_request);
+            co_await do_write();
+            clean();
+            break;
+        } else if (result == RequestParser::ResultType::processing_continue) {
+            reply_ = Reply::stock_reply(StatusType::processing_continue);
+            co_await do_write();
+            reply_.reset();
+            break;
+        } else {
+            break;
+        }
+    } while (begin != end);
 }
 
 Task<void> Connection::do_write() {
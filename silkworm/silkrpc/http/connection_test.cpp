@@ -16,12 +16,28 @@
 
 #include "connection.hpp"
 
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
 #include <catch2/catch.hpp>
+#include <nlohmann/json.hpp>
+#include <zlib.h>
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/silkrpc/commands/rpc_api.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
+#include <silkworm/silkrpc/test/context_test_base.hpp>
 
 namespace silkworm::rpc::http {
 
@@ -49,6 +65,147 @@ TEST_CASE("connection creation", "[silkrpc][http][connection]") {
         context_pool.join();
     }
 }
+
+struct HttpResponse {
+    std::string status_line;
+    std::map<std::string, std::string> headers;
+    std::string content;
+};
+
+//! Split the raw data received from the server into the responses it contains
+static std::vector<HttpResponse> parse_responses(std::string_view data) {
+    std::vector<HttpResponse> responses;
+    while (!data.empty()) {
+        HttpResponse response;
+        const auto status_end{data.find("\r\n")};
+        REQUIRE(status_end != std::string_view::npos);
+        response.status_line = data.substr(0, status_end);
+        data.remove_prefix(status_end + 2);
+        for (auto header_end{data.find("\r\n")}; header_end != 0; header_end = data.find("\r\n")) {
+            REQUIRE(header_end != std::string_view::npos);
+            const auto header{data.substr(0, header_end)};
+            const auto separator{header.find(": ")};
+            REQUIRE(separator != std::string_view::npos);
+            response.headers.emplace(header.substr(0, separator), header.substr(separator + 2));
+            data.remove_prefix(header_end + 2);
+        }
+        data.remove_prefix(2);
+        REQUIRE(response.headers.contains("Content-Length"));
+        const auto content_length{std::stoul(response.headers["Content-Length"])};
+        REQUIRE(data.size() >= content_length);
+        response.content = data.substr(0, content_length);
+        data.remove_prefix(content_length);
+        responses.push_back(std::move(response));
+    }
+    return responses;
+}
+
+//! Decompress the gzip content in one shot
+static std::string gunzip(const std::string& compressed, std::size_t max_size) {
+    z_stream stream{};
+    REQUIRE(inflateInit2(&stream, 15 + 16) == Z_OK);
+    std::string decompressed(max_size, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(decompressed.data());
+    stream.avail_out = static_cast<uInt>(decompressed.size());
+    CHECK(inflate(&stream, Z_FINISH) == Z_STREAM_END);
+    decompressed.resize(stream.total_out);
+    inflateEnd(&stream);
+    return decompressed;
+}
+
+static std::string make_request(const std::string& content, const std::string& extra_headers = "") {
+    return "POST / HTTP/1.1\r\nHost: localhost:8545\r\nContent-Type: application/json\r\n" + extra_headers +
+           "Content-Length: " + std::to_string(content.size()) + "\r\n\r\n" + content;
+}
+
+class ConnectionTest : public test::ContextTestBase {
+  public:
+    //! Send the raw data to one connection in a single write, then read all the replies until the connection is closed
+    std::string send_and_receive(const std::string& raw_data) {
+        boost::asio::ip::tcp::acceptor acceptor{io_context_, {boost::asio::ip::address_v4::loopback(), 0}};
+        Connection connection{io_context_, api_, handler_table_, /*allowed_origins=*/{}, /*jwt_secret=*/std::nullopt};
+        auto served = spawn([&]() -> Task<void> {
+            co_await acceptor.async_accept(connection.socket(), boost::asio::use_awaitable);
+            co_await connection.read_loop();
+            connection.socket().close();
+        });
+
+        boost::asio::io_context client_context;
+        boost::asio::ip::tcp::socket client_socket{client_context};
+        client_socket.connect(acceptor.local_endpoint());
+        boost::asio::write(client_socket, boost::asio::buffer(raw_data));
+        client_socket.shutdown(boost::asio::ip::tcp::socket::shutdown_send);
+
+        std::string received;
+        boost::system::error_code ec;
+        boost::asio::read(client_socket, boost::asio::dynamic_buffer(received), ec);
+        CHECK(ec == boost::asio::error::eof);
+        served.get();
+        return received;
+    }
+
+  private:
+    boost::asio::thread_pool workers_{1};
+    commands::RpcApi api_{io_context_, workers_};
+    commands::RpcApiTable handler_table_{""};
+};
+
+TEST_CASE_METHOD(ConnectionTest, "Connection: pipelined requests", "[silkrpc][http][connection]") {
+    const std::string raw_data{make_request(R"({"jsonrpc":"2.0","id":1,"method":"foo_first"})") +
+                               make_request(R"({"jsonrpc":"2.0","id":2,"method":"foo_second"})")};
+    const auto responses{parse_responses(send_and_receive(raw_data))};
+
+    // Both requests are handled and replied in the same order
+    REQUIRE(responses.size() == 2);
+    CHECK(responses[0].status_line == "HTTP/1.1 501 Not Implemented");
+    CHECK(nlohmann::json::parse(responses[0].content) == R"({
+        "jsonrpc":"2.0",
+        "id":1,
+        "error":{"code":-32601,"message":"the method foo_first does not exist/is not available"}
+    })"_json);
+    CHECK(responses[1].status_line == "HTTP/1.1 501 Not Implemented");
+    CHECK(nlohmann::json::parse(responses[1].content) == R"({
+        "jsonrpc":"2.0",
+        "id":2,
+        "error":{"code":-32601,"message":"the method foo_second does not exist/is not available"}
+    })"_json);
+}
+
+TEST_CASE_METHOD(ConnectionTest, "Connection: gzip content encoding", "[silkrpc][http][connection]") {
+    // The method name is echoed in the error reply, so a long one makes it big enough to be compressed
+    const std::string method(kHttpMinCompressedContentSize, 'x');
+    const std::string big_request{R"({"jsonrpc":"2.0","id":1,"method":")" + method + R"("})"};
+    const std::string small_request{R"({"jsonrpc":"2.0","id":2,"method":"foo"})"};
+
+    SECTION("accepted") {
+        const auto responses{parse_responses(send_and_receive(make_request(big_request, "Accept-Encoding: gzip, deflate\r\n") +
+                                                              make_request(small_request, "Accept-Encoding: gzip\r\n")))};
+        REQUIRE(responses.size() == 2);
+        CHECK(responses[0].headers["Content-Encoding"] == "gzip");
+        CHECK(responses[0].content.size() < kHttpMinCompressedContentSize);
+        const auto content{gunzip(responses[0].content, 2 * kHttpMinCompressedContentSize)};
+        CHECK(nlohmann::json::parse(content)["error"]["message"] == "the method " + method + " does not exist/is not available");
+        // Small replies are never compressed
+        CHECK_FALSE(responses[1].headers.contains("Content-Encoding"));
+        CHECK(nlohmann::json::parse(responses[1].content)["id"] == 2);
+    }
+
+    SECTION("refused") {
+        const auto responses{parse_responses(send_and_receive(make_request(big_request, "Accept-Encoding: gzip;q=0\r\n")))};
+        REQUIRE(responses.size() == 1);
+        CHECK_FALSE(responses[0].headers.contains("Content-Encoding"));
+        CHECK(nlohmann::json::parse(responses[0].content)["id"] == 1);
+    }
+
+    SECTION("not requested") {
+        const auto responses{parse_responses(send_and_receive(make_request(big_request)))};
+        REQUIRE(responses.size() == 1);
+        CHECK_FALSE(responses[0].headers.contains("Content-Encoding"));
+        CHECK(responses[0].content.size() > kHttpMinCompressedContentSize);
+    }
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::http
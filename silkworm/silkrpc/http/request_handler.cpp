@@ -22,11 +22,18 @@
 
 #include "request_handler.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <optional>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+#include <absl/strings/numbers.h>
 #include <absl/strings/str_join.h>
+#include <absl/strings/str_split.h>
 #include <boost/asio/write.hpp>
 #include <jwt-cpp/jwt.h>
 #include <jwt-cpp/traits/nlohmann-json/defaults.h>
@@ -35,13 +42,51 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/silkrpc/commands/eth_api.hpp>
 #include <silkworm/silkrpc/common/clock_time.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/http/header.hpp>
 #include <silkworm/silkrpc/types/writer.hpp>
 
 namespace silkworm::rpc::http {
 
+//! Check if the client accepts gzip content encoding (i.e. gzip is listed in Accept-Encoding without q=0)
+static bool accepts_gzip_encoding(const http::Request& request) {
+    const auto it = std::find_if(request.headers.begin(), request.headers.end(), [&](const Header& h) {
+        return h.name == "Accept-Encoding";
+    });
+    if (it == request.headers.end()) {
+        return false;
+    }
+    for (const auto coding : absl::StrSplit(it->value, ',')) {
+        const std::vector<std::string_view> coding_params = absl::StrSplit(coding, ';');
+        const auto name = absl::StripAsciiWhitespace(coding_params[0]);
+        if (!absl::EqualsIgnoreCase(name, "gzip") && name != "*") {
+            continue;
+        }
+        double quality{1.0};
+        for (std::size_t i{1}; i < coding_params.size(); ++i) {
+            const auto param = absl::StripAsciiWhitespace(coding_params[i]);
+            if (absl::StartsWith(param, "q=") && !absl::SimpleAtod(param.substr(2), &quality)) {
+                quality = 0;
+            }
+        }
+        return quality > 0;
+    }
+    return false;
+}
+
+//! Compress the reply content in gzip format
+static void compress_content(http::Reply& reply) {
+    StringWriter string_writer{reply.content.size() / 4};
+    GzipWriter gzip_writer{string_writer};
+    gzip_writer.write(reply.content);
+    gzip_writer.close();
+    reply.content = string_writer.get_content();
+    reply.headers.emplace_back(http::Header{"Content-Encoding", "gzip"});
+}
+
 Task<void> RequestHandler::handle(const http::Request& request) {
     auto start = clock_time::now();
+    const bool gzip_encoding = accepts_gzip_encoding(request);
 
     bool send_reply{true};
     http::Reply reply;
@@ -62,7 +107,7 @@ Task<void> RequestHandler::handle(const http::Request& request) {
                     reply.status = http::StatusType::bad_request;
                     reply.content = make_json_error(0, -32600, "invalid request").dump() + "\n";
                 } else {
-                    send_reply = co_await handle_request_and_create_reply(request_json, reply);
+                    send_reply = co_await handle_request_and_create_reply(request_json, reply, gzip_encoding);
                     reply.content += "\n";
                 }
             } else {
@@ -91,6 +136,9 @@ Task<void> RequestHandler::handle(const http::Request& request) {
     }
 
     if (send_reply) {
+        if (gzip_encoding && reply.content.size() >= kHttpMinCompressedContentSize) {
+            compress_content(reply);
+        }
         co_await do_write(reply);
     }
 
@@ -130,7 +178,7 @@ bool RequestHandler::is_valid_jsonrpc(const nlohmann::json& request_json) {
     return true;
 }
 
-Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply) {
+Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply, bool gzip_encoding) {
     if (!request_json.contains("method")) {
         reply.content = make_json_error(request_json, -32600, "invalid request").dump();
         reply.status = http::StatusType::bad_request;
@@ -162,7 +210,7 @@ Task<bool> RequestHandler::handle_request_and_create_reply(const nlohmann::json&
     const auto stream_handler = rpc_api_table_.find_stream_handler(method);
     if (stream_handler) {
         SILK_TRACE << "--> handle RPC stream request: " << method;
-        co_await handle_request(*stream_handler, request_json);
+        co_await handle_request(*stream_handler, request_json, gzip_encoding);
         SILK_TRACE << "<-- handle RPC stream request: " << method;
         co_return false;
     }
@@ -214,13 +262,17 @@ Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleMethod ha
     co_return;
 }
 
-Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json) {
+Task<void> RequestHandler::handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json, bool gzip_encoding) {
     try {
         SocketWriter socket_writer(socket_);
         ChunksWriter chunks_writer(socket_writer, 0x1FFF);
-        json::Stream stream(chunks_writer);
+        std::optional<GzipWriter> gzip_writer;
+        if (gzip_encoding) {
+            gzip_writer.emplace(chunks_writer);
+        }
+        json::Stream stream(gzip_writer ? static_cast<Writer&>(*gzip_writer) : chunks_writer);
 
-        co_await write_headers();
+        co_await write_headers(gzip_encoding);
         co_await (rpc_api_.*handler)(request_json, stream);
 
         stream.close();
@@ -284,7 +336,7 @@ Task<void> RequestHandler::do_write(Reply& reply) {
     try {
         SILK_DEBUG << "RequestHandler::do_write reply: " << reply.content;
 
-        reply.headers.reserve(allowed_origins_.empty() ? 2 : 2 + kCorsNumHeaders);
+        reply.headers.reserve(reply.headers.size() + (allowed_origins_.empty() ? 2 : 2 + kCorsNumHeaders));
         reply.headers.emplace_back(http::Header{"Content-Length", std::to_string(reply.content.size())});
         reply.headers.emplace_back(http::Header{"Content-Type", "application/json"});
 
@@ -299,12 +351,15 @@ Task<void> RequestHandler::do_write(Reply& reply) {
     }
 }
 
-Task<void> RequestHandler::write_headers() {
+Task<void> RequestHandler::write_headers(bool gzip_encoding) {
     try {
         std::vector<http::Header> headers;
-        headers.reserve(allowed_origins_.empty() ? 2 : 2 + kCorsNumHeaders);
+        headers.reserve(allowed_origins_.empty() ? 3 : 3 + kCorsNumHeaders);
         headers.emplace_back(http::Header{"Content-Type", "application/json"});
         headers.emplace_back(http::Header{"Transfer-Encoding", "chunked"});
+        if (gzip_encoding) {
+            headers.emplace_back(http::Header{"Content-Encoding", "gzip"});
+        }
 
         set_cors(headers);
 
@@ -55,7 +55,7 @@ class RequestHandler {
     Task<void> handle(const http::Request& request);
 
   protected:
-    Task<bool> handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply);
+    Task<bool> handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply, bool gzip_encoding = false);
     virtual Task<void> do_write(http::Reply& reply);
 
   private:
@@ -74,8 +74,8 @@ class RequestHandler {
         commands::RpcApiTable::HandleMethodGlaze handler,
         const nlohmann::json& request_json,
         http::Reply& reply);
-    Task<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json);
-    Task<void> write_headers();
+    Task<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json, bool gzip_encoding);
+    Task<void> write_headers(bool gzip_encoding);
 
     commands::RpcApi& rpc_api_;
 
@@ -24,8 +24,11 @@
 
 #include <picohttpparser.h>
 
+#include <algorithm>
 #include <cstdlib>
-#include <cstring>
+#include <string_view>
+
+#include <absl/strings/match.h>
 
 namespace silkworm::rpc::http {
 
@@ -35,32 +38,36 @@ constexpr std::size_t kDefaultHttpBufferSize{65536};
 //! The maximum number of HTTP headers supported by the parser
 constexpr std::size_t kMaxHttpHeaders{100};
 
+//! The names of the HTTP headers relevant for the parser
+constexpr const char* kContentLength{"Content-Length"};
+constexpr const char* kExpect{"Expect"};
+constexpr const char* kAuthorization{"Authorization"};
+constexpr const char* kAcceptEncoding{"Accept-Encoding"};
+
 void RequestParser::reset() {
     prev_len_ = 0;
     buffer_.clear();
+    pipelined_data_.clear();
 }
 
 RequestParser::RequestParser() {
-    buffer_.resize(kDefaultHttpBufferSize);
+    buffer_.reserve(kDefaultHttpBufferSize);
+}
+
+//! Check if the header has the given name (header names are case-insensitive)
+static bool has_name(const phr_header& header, std::string_view name) {
+    return absl::EqualsIgnoreCase(std::string_view{header.name, header.name_len}, name);
 }
 
 RequestParser::ResultType RequestParser::parse(Request& req, const char* begin, const char* end) {
     auto current_len = static_cast<size_t>(end - begin);
 
     if (req.content_length != 0 && req.content.length() < req.content_length) {
-        for (size_t i{0}; i < current_len; i++) {
-            req.content.push_back(begin[i]);
-        }
-        if (req.content.length() < req.content_length)
-            return ResultType::indeterminate;
-        else
-            return ResultType::good;
+        return append_content(req, begin, current_len);
     }
 
     if (prev_len_) {
-        for (size_t i = 0; i < current_len; i++) {
-            buffer_.push_back(*begin++);
-        }
+        buffer_.insert(buffer_.end(), begin, end);
         begin = buffer_.data();
         current_len = buffer_.size();
     }
@@ -77,9 +84,8 @@ RequestParser::ResultType RequestParser::parse(Request& req, const char* begin,
     if (res == -1) {
         return ResultType::bad;
     } else if (res == -2) {
-        buffer_.clear();
-        for (size_t i = 0; i < current_len; i++) {
-            buffer_.push_back(*begin++);
+        if (!prev_len_) {
+            buffer_.assign(begin, begin + current_len);
         }
         prev_len_ = buffer_.size();
         return ResultType::indeterminate;
@@ -91,37 +97,41 @@ RequestParser::ResultType RequestParser::parse(Request& req, const char* begin,
     bool content_length_present{false};
     for (size_t i{0}; i < num_headers; ++i) {
         const auto& header{headers[i]};
-        if (header.name_len == 0) continue;
-        if (std::memcmp(header.name, "Content-Length", std::min(header.name_len, sizeof("Content-Length"))) == 0) {
+        if (has_name(header, kContentLength)) {
             req.content_length = static_cast<uint32_t>(atoi(header.value));
             content_length_present = true;
-        } else if (std::memcmp(header.name, "Expect", std::min(header.name_len, sizeof("Expect"))) == 0) {
+        } else if (has_name(header, kExpect)) {
             expect_request = true;
-        } else if (std::memcmp(header.name, "Authorization", std::min(header.name_len, sizeof("Authorization"))) == 0) {
-            req.headers.emplace_back();
-            for (size_t index = 0; index < static_cast<size_t>(header.name_len); index++) {
-                req.headers.back().name.push_back(header.name[index]);
-            }
-            for (size_t index = 0; index < static_cast<size_t>(header.value_len); index++) {
-                req.headers.back().value.push_back(header.value[index]);
-            }
+        } else if (has_name(header, kAuthorization)) {
+            req.headers.push_back({kAuthorization, std::string{header.value, header.value_len}});
+        } else if (has_name(header, kAcceptEncoding)) {
+            req.headers.push_back({kAcceptEncoding, std::string{header.value, header.value_len}});
         }
     }
 
+    const char* content{begin + res};
+    const auto content_len{current_len - static_cast<size_t>(res)};
+
     if (!content_length_present || req.content_length == 0) {
+        pipelined_data_.assign(content, content_len);
         return ResultType::good;
     }
 
-    req.content.resize(current_len - static_cast<size_t>(res));
-    std::memcpy(req.content.data(), begin + res, current_len - static_cast<size_t>(res));
-
     if (expect_request) {
+        req.content.assign(content, content_len);
         return ResultType::processing_continue;
-    } else if (req.content.length() < req.content_length) {
-        return ResultType::indeterminate;
-    } else {
-        return ResultType::good;
     }
+
+    return append_content(req, content, content_len);
+}
+
+RequestParser::ResultType RequestParser::append_content(Request& req, const char* data, std::size_t length) {
+    const std::size_t content_length{std::min(static_cast<std::size_t>(req.content_length - req.content.length()), length)};
+    req.content.append(data, content_length);
+    if (content_length < length) {
+        pipelined_data_.assign(data + content_length, length - content_length);
+    }
+    return req.content.length() < req.content_length ? ResultType::indeterminate : ResultType::good;
 }
 
 }  // namespace silkworm::rpc::http
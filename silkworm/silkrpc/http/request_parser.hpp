@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "request.hpp"
 
 namespace silkworm::rpc::http {
@@ -40,11 +44,21 @@ class RequestParser {
      */
     ResultType parse(Request& req, const char* begin, const char* end);
 
+    //! Whether the parsed data goes beyond the end of the complete request, i.e. further requests are pipelined
+    [[nodiscard]] bool has_pipelined_data() const { return !pipelined_data_.empty(); }
+
+    //! Take the data following the complete request, which must be parsed as the start of the next request
+    std::string release_pipelined_data() { return std::exchange(pipelined_data_, {}); }
+
     void reset();
 
   private:
+    //! Copy in bulk the body data up to content length, keeping any exceeding data as pipelined
+    ResultType append_content(Request& req, const char* data, std::size_t length);
+
     uint64_t prev_len_{0};
     std::vector<char> buffer_;
+    std::string pipelined_data_;
 };
 
 }  // namespace silkworm::rpc::http
@@ -217,6 +217,64 @@ TEST_CASE("parse", "[silkrpc][http][request_parser]") {
     }
 }
 
+TEST_CASE("parse pipelined requests", "[silkrpc][http][request_parser]") {
+    RequestParser parser;
+    Request req;
+
+    SECTION("two requests in one buffer") {
+        std::string buffer{
+            "POST / HTTP/1.1\r\nContent-Length: 15\r\n\r\n{\"json\": \"2.0\"}"
+            "POST / HTTP/1.1\r\nContent-Length: 2\r\n\r\n{}"};
+        const auto result1{parser.parse(req, buffer.data(), buffer.data() + buffer.size())};
+        CHECK(result1 == RequestParser::ResultType::good);
+        CHECK(req.content == "{\"json\": \"2.0\"}");
+        REQUIRE(parser.has_pipelined_data());
+        const auto pipelined_data{parser.release_pipelined_data()};
+        CHECK(!parser.has_pipelined_data());
+        parser.reset();
+        req.reset();
+        const auto result2{parser.parse(req, pipelined_data.data(), pipelined_data.data() + pipelined_data.size())};
+        CHECK(result2 == RequestParser::ResultType::good);
+        CHECK(req.content == "{}");
+        CHECK(!parser.has_pipelined_data());
+    }
+
+    SECTION("second request split across buffers") {
+        std::string buffer{"POST / HTTP/1.1\r\nContent-Length: 0\r\n\r\nPOST / HTTP/1.1\r\n"};
+        std::string segment{"Content-Length: 2\r\n\r\n{}"};
+        CHECK(parser.parse(req, buffer.data(), buffer.data() + buffer.size()) == RequestParser::ResultType::good);
+        const auto pipelined_data{parser.release_pipelined_data()};
+        parser.reset();
+        req.reset();
+        CHECK(parser.parse(req, pipelined_data.data(), pipelined_data.data() + pipelined_data.size()) == RequestParser::ResultType::indeterminate);
+        CHECK(parser.parse(req, segment.data(), segment.data() + segment.size()) == RequestParser::ResultType::good);
+        CHECK(req.content == "{}");
+    }
+}
+
+TEST_CASE("parse headers", "[silkrpc][http][request_parser]") {
+    RequestParser parser;
+    Request req;
+
+    SECTION("header names are case-insensitive") {
+        std::string s{"POST / HTTP/1.1\r\ncontent-length: 2\r\naccept-encoding: gzip\r\n\r\n{}"};
+        CHECK(parser.parse(req, s.data(), s.data() + s.size()) == RequestParser::ResultType::good);
+        CHECK(req.content_length == 2);
+        CHECK(req.content == "{}");
+        REQUIRE(req.headers.size() == 1);
+        CHECK(req.headers[0].name == "Accept-Encoding");
+        CHECK(req.headers[0].value == "gzip");
+    }
+
+    SECTION("authorization header kept") {
+        std::string s{"POST / HTTP/1.1\r\nAuthorization: Bearer token\r\nContent-Length: 0\r\n\r\n"};
+        CHECK(parser.parse(req, s.data(), s.data() + s.size()) == RequestParser::ResultType::good);
+        REQUIRE(req.headers.size() == 1);
+        CHECK(req.headers[0].name == "Authorization");
+        CHECK(req.headers[0].value == "Bearer token");
+    }
+}
+
 TEST_CASE("reset", "[silkrpc][http][request_parser]") {
     RequestParser parser;
 
@@ -52,8 +52,10 @@ Server::Server(const std::string& end_point,
                boost::asio::io_context& io_context,
                boost::asio::thread_pool& workers,
                std::vector<std::string> allowed_origins,
-               std::optional<std::string> jwt_secret)
-    : rpc_api_{io_context, workers},
+               std::optional<std::string> jwt_secret,
+               std::chrono::milliseconds logs_query_timeout,
+               uint64_t trace_filter_max_blocks)
+    : rpc_api_{io_context, workers, logs_query_timeout, trace_filter_max_blocks},
       handler_table_{api_spec},
       io_context_(io_context),
       acceptor_{io_context},
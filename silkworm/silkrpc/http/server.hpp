@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -34,6 +35,7 @@
 
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/silkrpc/commands/rpc_api_table.hpp>
+#include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/http/request_handler.hpp>
 
 namespace silkworm::rpc::http {
@@ -50,7 +52,9 @@ class Server {
                     boost::asio::io_context& io_context,
                     boost::asio::thread_pool& workers,
                     std::vector<std::string> allowed_origins,
-                    std::optional<std::string> jwt_secret);
+                    std::optional<std::string> jwt_secret,
+                    std::chrono::milliseconds logs_query_timeout = kDefaultLogsQueryTimeout,
+                    uint64_t trace_filter_max_blocks = kDefaultTraceFilterMaxBlocks);
 
     void start();
 
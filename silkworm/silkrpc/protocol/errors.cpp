@@ -44,6 +44,8 @@ class ProtocolErrorCategory final : public boost::system::error_category {
                 return "internal JSON-RPC error";
             case ErrorCode::kServerError:
                 return "generic client error while processing request";
+            case ErrorCode::kLimitExceeded:
+                return "request exceeds defined limit";
             case ErrorCode::kUnknownPayload:
                 return "payload does not exist / is not available";
             case ErrorCode::kInvalidForkChoiceState:
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <stdexcept>
 
 #include <boost/system/system_error.hpp>
 
@@ -30,6 +31,7 @@ enum ErrorCode : int64_t {
     kInvalidParams = -32602,   // Invalid method parameter(s)
     kInternalError = -32603,   // Internal JSON-RPC error
     kServerError = -32000,     // Generic client error while processing request
+    kLimitExceeded = -32005,   // Request exceeds defined limit
 
     /** Engine API errors **/
     kUnknownPayload = -38001,            // Payload does not exist / is not available
@@ -42,4 +44,10 @@ enum ErrorCode : int64_t {
 //    throw boost::system::system_error{rpc::to_system_code(rpc::ErrorCode::kSomething)};
 boost::system::error_code to_system_code(ErrorCode e);
 
+//! The query has not completed within its maximum duration, reported as kLimitExceeded
+class QueryTimeoutError : public std::runtime_error {
+  public:
+    QueryTimeoutError() : std::runtime_error{"query timeout exceeded"} {}
+};
+
 }  // namespace silkworm::rpc
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -29,6 +31,8 @@ namespace silkworm::rpc {
 struct DaemonSettings {
     log::Settings log_settings;
     concurrency::ContextPoolSettings context_pool_settings;
+    //! Local data directory: when set, the chain state is read directly from the local database and the historical
+    //! state cache is not used, because it only saves the KV round trips made by remote state reads
     std::optional<std::filesystem::path> datadir;
     std::string eth_end_point{kDefaultEth1EndPoint};
     std::string engine_end_point{kDefaultEngineEndPoint};
@@ -39,6 +43,10 @@ struct DaemonSettings {
     std::optional<std::string> jwt_secret_file;
     bool skip_protocol_check{false};
     bool erigon_json_rpc_compatibility{false};
+    //! Max duration of a single logs query or Otterscan transaction search
+    std::chrono::milliseconds logs_query_timeout{kDefaultLogsQueryTimeout};
+    //! Max number of blocks in the range of a single trace_filter request
+    uint64_t trace_filter_max_blocks{kDefaultTraceFilterMaxBlocks};
 };
 
 }  // namespace silkworm::rpc
@@ -16,9 +16,12 @@
 
 #include "writer.hpp"
 
+#include <zlib.h>
+
 #include <algorithm>
 #include <charconv>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
 #include <boost/asio/detached.hpp>
@@ -146,4 +149,44 @@ void JsonChunksWriter::close() {
     writer_.close();
 }
 
+void GzipWriter::StreamDeleter::operator()(z_stream_s* stream) const {
+    deflateEnd(stream);
+    delete stream;
+}
+
+GzipWriter::GzipWriter(Writer& writer, int compression_level)
+    : writer_(writer), stream_{new z_stream_s{}}, buffer_{new char[kOutputBufferSize]} {
+    // Window bits greater than 15 select the gzip format instead of the zlib one
+    if (deflateInit2(stream_.get(), compression_level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        delete stream_.release();  // not initialized, deflateEnd must not be called
+        throw std::runtime_error{"GzipWriter: cannot initialize compression stream"};
+    }
+}
+
+void GzipWriter::write(std::string_view content) {
+    SILK_DEBUG << "GzipWriter::write size: " << content.size();
+    deflate(content, Z_NO_FLUSH);
+}
+
+void GzipWriter::close() {
+    deflate({}, Z_FINISH);
+    writer_.close();
+}
+
+void GzipWriter::deflate(std::string_view content, int flush) {
+    stream_->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    stream_->avail_in = static_cast<uInt>(content.size());
+    do {
+        stream_->next_out = reinterpret_cast<Bytef*>(buffer_.get());
+        stream_->avail_out = static_cast<uInt>(kOutputBufferSize);
+        if (::deflate(stream_.get(), flush) == Z_STREAM_ERROR) {
+            throw std::runtime_error{"GzipWriter: compression stream error"};
+        }
+        const auto size = kOutputBufferSize - stream_->avail_out;
+        if (size > 0) {
+            writer_.write(std::string_view(buffer_.get(), size));
+        }
+    } while (stream_->avail_out == 0);
+}
+
 }  // namespace silkworm::rpc
@@ -23,6 +23,8 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/write.hpp>
 
+struct z_stream_s;
+
 namespace silkworm::rpc {
 
 class Writer {
@@ -109,4 +111,28 @@ class JsonChunksWriter : public Writer {
     std::stringstream str_chunk_size_;
 };
 
+//! Writer compressing the content in gzip format, streaming the compressed data to the underlying writer
+class GzipWriter : public Writer {
+  public:
+    explicit GzipWriter(Writer& writer, int compression_level = kDefaultCompressionLevel);
+
+    void write(std::string_view content) override;
+    void close() override;
+
+  private:
+    //! Fastest compression level, as output size shrinks anyway by a large factor for JSON hex data
+    static const int kDefaultCompressionLevel = 1;
+    static const std::size_t kOutputBufferSize = 0x4000;
+
+    struct StreamDeleter {
+        void operator()(z_stream_s* stream) const;
+    };
+
+    void deflate(std::string_view content, int flush);
+
+    Writer& writer_;
+    std::unique_ptr<z_stream_s, StreamDeleter> stream_;
+    std::unique_ptr<char[]> buffer_;
+};
+
 }  // namespace silkworm::rpc
@@ -16,7 +16,10 @@
 
 #include "writer.hpp"
 
+#include <zlib.h>
+
 #include <iostream>
+#include <string>
 
 #include <catch2/catch.hpp>
 #include <nlohmann/json.hpp>
@@ -104,6 +107,68 @@ TEST_CASE("ChunksWriter", "[silkrpc]") {
     }
 }
 
+//! Decompress the gzip content in one shot
+static std::string gunzip(const std::string& compressed, std::size_t max_size) {
+    z_stream stream{};
+    REQUIRE(inflateInit2(&stream, 15 + 16) == Z_OK);
+    std::string decompressed(max_size, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(decompressed.data());
+    stream.avail_out = static_cast<uInt>(decompressed.size());
+    CHECK(inflate(&stream, Z_FINISH) == Z_STREAM_END);
+    decompressed.resize(stream.total_out);
+    inflateEnd(&stream);
+    return decompressed;
+}
+
+TEST_CASE("GzipWriter", "[silkrpc]") {
+    silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+
+    SECTION("write&close empty") {
+        StringWriter s_writer;
+        GzipWriter writer(s_writer);
+
+        writer.close();
+
+        CHECK(gunzip(s_writer.get_content(), 16).empty());
+    }
+    SECTION("write&close") {
+        StringWriter s_writer;
+        GzipWriter writer(s_writer);
+
+        writer.write("{\"jsonrpc\":\"2.0\",");
+        writer.write("\"id\":1,\"result\":\"0x0\"}");
+        writer.close();
+
+        CHECK(gunzip(s_writer.get_content(), 64) == "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"0x0\"}");
+    }
+    SECTION("write&close over output buffer size") {
+        std::string content;
+        for (int i{0}; i < 100'000; ++i) {
+            content += "0x" + std::to_string(i * 7919) + ",";
+        }
+        StringWriter s_writer;
+        GzipWriter writer(s_writer);
+
+        writer.write(content);
+        writer.close();
+
+        CHECK(s_writer.get_content().size() < content.size());
+        CHECK(gunzip(s_writer.get_content(), content.size()) == content);
+    }
+    SECTION("close propagated through chunks") {
+        StringWriter s_writer;
+        ChunksWriter chunks_writer(s_writer);
+        GzipWriter writer(chunks_writer);
+
+        writer.write("1234");
+        writer.close();
+
+        CHECK(s_writer.get_content().ends_with("0\r\n\r\n"));
+    }
+}
+
 TEST_CASE("JsonChunksWriter", "[silkrpc]") {
     silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
 
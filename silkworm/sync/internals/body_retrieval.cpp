@@ -31,8 +31,8 @@ std::vector<BlockBody> BodyRetrieval::recover(std::vector<Hash> request) {
         if (!db::read_body(db_tx_, hash, body)) {
             continue;
         }
-        response.push_back(body);
         bytes += rlp::length(body);
+        response.push_back(std::move(body));
         if (bytes >= soft_response_limit || response.size() >= max_bodies_serve || i >= 2 * max_bodies_serve) {
             break;
         }
@@ -23,6 +23,8 @@
 #include <stack>
 #include <vector>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <silkworm/node/db/access_layer.hpp>
 
 #include "priority_queue.hpp"
@@ -40,6 +42,7 @@ struct Link {
     std::vector<std::shared_ptr<Link>> next;  // Reverse of parentHash,allows iter.over links in asc. block height order
     bool persisted = false;                   // Whether this link comes from the database record
     bool preverified = false;                 // Ancestor of pre-verified header
+    size_t queue_index = hbpq_no_index;       // Position in the link queue this link is in, if any
 
     Link(BlockHeader h, bool persisted_) {
         blockHeight = h.number;
@@ -49,11 +52,11 @@ struct Link {
     }
 
     void remove_child(const Link& child) {
-        std::erase_if(next, [child](auto& link) { return (link->hash == child.hash); });
+        std::erase_if(next, [&child](auto& link) { return (link->hash == child.hash); });
     }
 
     auto find_child(const Hash& h) {
-        return std::find_if(next.begin(), next.end(), [h](auto& link) { return (link->hash == h); });
+        return std::find_if(next.begin(), next.end(), [&h](auto& link) { return (link->hash == h); });
     }
 
     bool has_child(const Hash& h) { return find_child(h) != next.end(); }
@@ -69,6 +72,7 @@ struct Anchor {
     std::vector<std::shared_ptr<Link>> links;  // Links attached immediately to this anchor
     BlockNum lastLinkHeight{0};                // the blockHeight of the last link of the chain bundle anchored to this
     PeerId peerId;
+    size_t queue_index = hbpq_no_index;  // Position in the anchor queue, if any
 
     Anchor(const BlockHeader& header, PeerId p) {
         parentHash = header.parent_hash;
@@ -81,11 +85,11 @@ struct Anchor {
     BlockNum chainLength() { return lastLinkHeight - blockHeight + 1; }
 
     void remove_child(const Link& child) {
-        std::erase_if(links, [child](auto& link) { return (link->hash == child.hash); });
+        std::erase_if(links, [&child](auto& link) { return (link->hash == child.hash); });
     }
 
     auto find_child(const Hash& h) {
-        return std::find_if(links.begin(), links.end(), [h](auto& link) { return (link->hash == h); });
+        return std::find_if(links.begin(), links.end(), [&h](auto& link) { return (link->hash == h); });
     }
 
     bool has_child(const Hash& h) { return find_child(h) != links.end(); }
@@ -103,21 +107,21 @@ struct Anchor {
 };
 
 // Binary relations to use in priority queues
-struct LinkOlderThan : public std::function<bool(std::shared_ptr<Link>, std::shared_ptr<Link>)> {
+struct LinkOlderThan {
     bool operator()(const std::shared_ptr<Link>& x, const std::shared_ptr<Link>& y) const {
         return x->blockHeight != y->blockHeight ? x->blockHeight < y->blockHeight :  // cause ordering
                    x < y;                                                            // preserve identity
     }
 };
 
-struct LinkYoungerThan : public std::function<bool(std::shared_ptr<Link>, std::shared_ptr<Link>)> {
+struct LinkYoungerThan {
     bool operator()(const std::shared_ptr<Link>& x, const std::shared_ptr<Link>& y) const {
         return x->blockHeight != y->blockHeight ? x->blockHeight > y->blockHeight :  // cause ordering
                    x > y;                                                            // preserve identity
     }
 };
 
-struct AnchorYoungerThan : public std::function<bool(std::shared_ptr<Link>, std::shared_ptr<Link>)> {
+struct AnchorYoungerThan {
     bool operator()(const std::shared_ptr<Anchor>& x, const std::shared_ptr<Anchor>& y) const {
         return x->timestamp != y->timestamp ? x->timestamp > y->timestamp :               // prefer smaller timestamp
                    (x->blockHeight != y->blockHeight ? x->blockHeight > y->blockHeight :  // when timestamps are the same prioritise low blockHeight
@@ -125,7 +129,7 @@ struct AnchorYoungerThan : public std::function<bool(std::shared_ptr<Link>, std:
     }
 };
 
-struct AnchorOlderThan : public std::function<bool(std::shared_ptr<Anchor>, std::shared_ptr<Anchor>)> {
+struct AnchorOlderThan {
     bool operator()(const std::shared_ptr<Anchor>& x, const std::shared_ptr<Anchor>& y) const {
         return x->timestamp != y->timestamp ? x->timestamp < y->timestamp :               // prefer smaller timestamp
                    (x->blockHeight != y->blockHeight ? x->blockHeight < y->blockHeight :  // when timestamps are the same prioritise low blockHeight
@@ -133,7 +137,7 @@ struct AnchorOlderThan : public std::function<bool(std::shared_ptr<Anchor>, std:
     }
 };
 
-struct BlockOlderThan : public std::function<bool(BlockNum, BlockNum)> {
+struct BlockOlderThan {
     bool operator()(const BlockNum& x, const BlockNum& y) const { return x < y; }
 };
 
@@ -151,6 +155,14 @@ struct BlockOlderThan : public std::function<bool(BlockNum, BlockNum)> {
 
 }  // namespace silkworm
 template <>
+struct hbpq_index<std::shared_ptr<silkworm::Link>> {                                           // extract heap index
+    static size_t& value(const std::shared_ptr<silkworm::Link>& l) { return l->queue_index; }  // stored in the link
+};
+template <>
+struct hbpq_index<std::shared_ptr<silkworm::Anchor>> {                                           // extract heap index
+    static size_t& value(const std::shared_ptr<silkworm::Anchor>& a) { return a->queue_index; }  // stored in the anchor
+};
+template <>
 struct mbpq_key<std::shared_ptr<silkworm::Link>> {                                          // extract key type and value
     using type = silkworm::BlockNum;                                                        // type of the key
     static type value(const std::shared_ptr<silkworm::Link>& l) { return l->blockHeight; }  // value of the key
@@ -161,15 +173,15 @@ namespace silkworm {  // reopen namespace
 using OldestFirstLinkMap = map_based_priority_queue<std::shared_ptr<Link>, BlockOlderThan>;
 
 // A queue of younger links to get the next link to process
-using OldestFirstLinkQueue = set_based_priority_queue<std::shared_ptr<Link>, LinkOlderThan>;
+using OldestFirstLinkQueue = heap_based_priority_queue<std::shared_ptr<Link>, LinkOlderThan>;
 
 // We need a queue for anchors to get anchors in reverse order respect to timestamp
 // (that is the time at which we asked peers for ancestor of the anchor)
-using OldestFirstAnchorQueue = set_based_priority_queue<std::shared_ptr<Anchor>, AnchorOlderThan>;
+using OldestFirstAnchorQueue = heap_based_priority_queue<std::shared_ptr<Anchor>, AnchorOlderThan>;
 
-// Maps to get a link or an anchor by hash
-using LinkMap = std::map<Hash, std::shared_ptr<Link>>;      // hash = link hash
-using AnchorMap = std::map<Hash, std::shared_ptr<Anchor>>;  // hash = anchor *parent* hash
+// Maps to get a link or an anchor by hash (open addressing: no node allocation and no tree walk per insert/lookup)
+using LinkMap = absl::flat_hash_map<Hash, std::shared_ptr<Link>>;      // hash = link hash
+using AnchorMap = absl::flat_hash_map<Hash, std::shared_ptr<Anchor>>;  // hash = anchor *parent* hash
 
 /* We can improve encapsulation:
  * AnchorMap key is the anchor parent hash, note 'parent', so it is better to encapsulate this knowledge in a class
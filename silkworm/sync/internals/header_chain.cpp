@@ -18,6 +18,8 @@
 
 #include <algorithm>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <gsl/util>
 
 #include <silkworm/core/common/random_number.hpp>
@@ -64,6 +66,9 @@ HeaderChain::HeaderChain(protocol::RuleSetPtr rule_set)
     RandomNumber random(100'000'000, 1'000'000'000);
     request_id_prefix = random.generate_one();
     SILK_TRACE << "HeaderChain: request id prefix=" << request_id_prefix;
+
+    // Anchors are few and bounded, avoid rehashing them
+    anchors_.reserve(anchor_limit);
 }
 
 void HeaderChain::set_target_block(BlockNum target_block) {
@@ -108,14 +113,11 @@ size_t HeaderChain::anchors() const { return anchors_.size(); }
 std::vector<Announce>& HeaderChain::announces_to_do() { return announces_to_do_; }
 
 size_t HeaderChain::outstanding_requests(time_point_t tp) const {
-    auto it = std::find_if(anchor_queue_.begin(), anchor_queue_.end(), [tp](const auto& anchor) {
-        return anchor->timestamp > tp;  // anchor_queue_ is sorted by timestamp
-    });
-    auto distance = std::distance(it, anchor_queue_.end());  // skip adding (last_skeleton_request_ < tp ? 1 : 0)
-                                                             // because we cannot say here if it has already been replied
-    if (distance < 0) throw std::logic_error("HeaderChain::outstanding_requests() distance < 0");
+    auto count = std::count_if(anchor_queue_.begin(), anchor_queue_.end(), [tp](const auto& anchor) {
+        return anchor->timestamp > tp;  // anchor_queue_ is iterated in heap order, not by timestamp
+    });  // skip adding (last_skeleton_request_ < tp ? 1 : 0) because we cannot say here if it has already been replied
 
-    return static_cast<size_t>(distance);
+    return static_cast<size_t>(count);
 }
 
 void HeaderChain::add_bad_headers(const std::set<Hash>& bads) {
@@ -149,8 +151,8 @@ Headers HeaderChain::withdraw_stable_headers() {
     SILK_TRACE << "HeaderChain: finding headers to persist on top of " << highest_in_db_ << " (" << insert_list_.size()
                << " waiting in queue)";
 
-    OldestFirstLinkQueue assessing_list = insert_list_;  // use move() operation if it is assured that after the move
-    insert_list_.clear();                                // the container is empty and can be reused
+    OldestFirstLinkQueue assessing_list = std::move(insert_list_);
+    insert_list_.clear();  // a moved-from container is valid but unspecified, clearing makes it reusable
 
     while (!assessing_list.empty()) {
         // Choose a link at top
@@ -413,7 +415,9 @@ std::optional<BlockNum> HeaderChain::lowest_anchor_within_range(BlockNum bottom,
 std::shared_ptr<Anchor> HeaderChain::highest_anchor() {
     std::shared_ptr<Anchor> highest_anchor = nullptr;
     for (const auto& a : anchors_) {
-        if (highest_anchor == nullptr || a.second->blockHeight >= highest_anchor->blockHeight) {
+        // anchors_ is unordered, so break ties by parent hash to keep the choice deterministic
+        if (highest_anchor == nullptr || a.second->blockHeight > highest_anchor->blockHeight ||
+            (a.second->blockHeight == highest_anchor->blockHeight && highest_anchor->parentHash < a.first)) {
             highest_anchor = a.second;
         }
     }
@@ -636,9 +640,12 @@ std::tuple<std::vector<Segment>, Penalty> HeaderList::split_into_segments() {
     });  // sort headers from the highest block height to the lowest
 
     std::vector<Segment> segments;
-    std::map<Hash, size_t> segmentMap;
-    std::map<Hash, std::vector<Header_Ref>> childrenMap;
-    std::set<Hash> dedupMap;
+    absl::flat_hash_map<Hash, size_t> segmentMap;
+    absl::flat_hash_map<Hash, std::vector<Header_Ref>> childrenMap;
+    absl::flat_hash_set<Hash> dedupMap;
+    segmentMap.reserve(headers.size());
+    childrenMap.reserve(headers.size());
+    dedupMap.reserve(headers.size());
     size_t segmentIdx = 0;
 
     for (auto& header : headers) {
@@ -649,7 +656,7 @@ std::tuple<std::vector<Segment>, Penalty> HeaderList::split_into_segments() {
         }
 
         dedupMap.insert(header_hash);
-        auto children = childrenMap[header_hash];
+        const auto& children = childrenMap[header_hash];  // valid until the next insertion in childrenMap
         auto [valid, penalty] = HeaderList::childrenParentValidity(children, header);
         if (!valid) {
             return {std::vector<Segment>{}, penalty};
@@ -672,7 +679,7 @@ std::tuple<std::vector<Segment>, Penalty> HeaderList::split_into_segments() {
         siblings.push_back(header);
     }
 
-    return {segments, Penalty::NoPenalty};
+    return {std::move(segments), Penalty::NoPenalty};
 }
 
 HeaderChain::RequestMoreHeaders HeaderChain::process_segment(const Segment& segment, bool is_a_new_block, const PeerId& peerId) {
@@ -18,6 +18,8 @@
 
 #include <cstdio>
 
+#include <absl/container/flat_hash_set.h>
+
 #include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
 #include <silkworm/node/common/preverified_hashes.hpp>
@@ -166,7 +168,7 @@ class HeaderChain {
     BlockNum highest_in_db_;
     BlockNum top_seen_height_;
     std::optional<BlockNum> target_block_;
-    std::set<Hash> bad_headers_;
+    absl::flat_hash_set<Hash> bad_headers_;
     PreverifiedHashes& preverified_hashes_;  // Set of hashes that are known to belong to canonical chain
     BlockNum last_preverified_hash_{0};
     using Ignore = int;
@@ -0,0 +1,97 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/bytes_to_string.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/sync/internals/header_chain.hpp>
+
+namespace silkworm {
+
+//! Max number of headers in one peer reply, as requested by HeaderChain
+static constexpr std::size_t kHeadersPerReply{192};
+
+//! Build a canonical chain of headers on top of genesis
+static std::vector<BlockHeader> make_headers(const BlockHeader& genesis, std::size_t count) {
+    std::vector<BlockHeader> headers(count);
+    Hash parent_hash{genesis.hash()};
+    for (std::size_t i{0}; i < count; ++i) {
+        headers[i].number = i + 1;
+        headers[i].difficulty = 1'000 + i;
+        headers[i].parent_hash = parent_hash;
+        parent_hash = headers[i].hash();
+    }
+    return headers;
+}
+
+//! Pre-verify the highest header of each reply, as done for mainnet, so that no header validation takes place
+static PreverifiedHashes make_preverified_hashes(const std::vector<BlockHeader>& headers) {
+    PreverifiedHashes preverified_hashes;
+    for (std::size_t i{kHeadersPerReply - 1}; i < headers.size(); i += kHeadersPerReply) {
+        preverified_hashes.hashes.insert(headers[i].hash());
+    }
+    preverified_hashes.hashes.insert(headers.back().hash());
+    preverified_hashes.height = headers.back().number;
+    preverified_hashes.step = kHeadersPerReply;
+    return preverified_hashes;
+}
+
+//! Download the whole chain in consecutive replies, withdrawing the stable headers after each one
+static void header_download(benchmark::State& state) {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+
+    BlockHeader genesis;
+    genesis.difficulty = 1'000;
+    const auto headers{make_headers(genesis, static_cast<std::size_t>(state.range(0)))};
+
+    std::vector<std::vector<BlockHeader>> replies;
+    for (std::size_t i{0}; i < headers.size(); i += kHeadersPerReply) {
+        const auto reply_end{std::min(i + kHeadersPerReply, headers.size())};
+        replies.emplace_back(headers.cbegin() + static_cast<std::ptrdiff_t>(i), headers.cbegin() + static_cast<std::ptrdiff_t>(reply_end));
+    }
+
+    ChainConfig chain_config{kMainnetConfig};
+    chain_config.genesis_hash.emplace(kMainnetGenesisHash);
+
+    // HeaderChain stores the pre-verified hashes into the global instance, so restore it at the end
+    const PreverifiedHashes current_preverified_hashes{PreverifiedHashes::current};
+    auto preverified_hashes{make_preverified_hashes(headers)};
+    const PeerId peer_id{byte_ptr_cast("1")};
+
+    for ([[maybe_unused]] auto _ : state) {
+        HeaderChain chain{chain_config};
+        chain.set_preverified_hashes(preverified_hashes);
+        chain.initial_state({genesis});
+
+        std::size_t stable_headers{0};
+        for (const auto& reply : replies) {
+            chain.accept_headers(reply, /*requestId=*/0, peer_id);
+            stable_headers += chain.withdraw_stable_headers().size();
+        }
+        benchmark::DoNotOptimize(stable_headers);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * headers.size()));
+
+    PreverifiedHashes::current = current_preverified_hashes;
+}
+BENCHMARK(header_download)->Arg(1'024)->Arg(16'384);
+
+}  // namespace silkworm
@@ -16,6 +16,8 @@
 
 #include "header_retrieval.hpp"
 
+#include <limits>
+
 #include <silkworm/infra/common/log.hpp>
 
 namespace silkworm {
@@ -24,52 +26,68 @@ HeaderRetrieval::HeaderRetrieval(db::ROAccess db_access) : db_tx_{db_access.star
 
 void HeaderRetrieval::close() { db_tx_.abort(); }
 
-std::vector<BlockHeader> HeaderRetrieval::recover_by_hash(Hash origin, uint64_t amount, uint64_t skip, bool reverse) {
+//! Whether moving skip + 1 blocks from current overflows, which only a malicious GetBlockHeaders request can ask for
+static bool is_skip_overflow(BlockNum current, uint64_t skip, bool reverse) {
+    const uint64_t step = skip + 1;
+    const bool overflow = step == 0 || (!reverse && current > std::numeric_limits<BlockNum>::max() - step);
+    if (overflow) {
+        log::Warning("HeaderStage") << "GetBlockHeaders skip overflow attack:"
+                                    << " current=" << current << ", skip=" << skip << ", reverse=" << reverse;
+    }
+    return overflow;
+}
+
+std::vector<Bytes> HeaderRetrieval::recover_by_hash(Hash origin, uint64_t amount, uint64_t skip, bool reverse) {
     using std::optional;
     uint64_t max_non_canonical = 100;
 
-    std::vector<BlockHeader> headers;
+    // Peers almost always ask for canonical headers: traversal by number gives the same result without decoding
+    const auto origin_num = data_model_.read_block_number(origin);
+    if (origin_num && db::read_canonical_hash(db_tx_, *origin_num) == origin) {
+        return recover_by_number(*origin_num, amount, skip, reverse);
+    }
+
+    std::vector<Bytes> headers;
     long long bytes = 0;
     Hash hash = origin;
     bool unknown = false;
 
+    auto push_back_encoded = [&](const BlockHeader& h) {
+        Bytes encoded_header;
+        rlp::encode(encoded_header, h);
+        bytes += static_cast<long long>(encoded_header.size());
+        headers.push_back(std::move(encoded_header));
+    };
+
     // first
     optional<BlockHeader> header = data_model_.read_header(hash);
     if (!header) return headers;
     BlockNum block_num = header->number;
-    headers.push_back(*header);
-    bytes += est_header_rlp_size;
+    push_back_encoded(*header);
 
     // followings
     do {
         // compute next hash & number - understand and improve readability
-        if (!reverse) {
+        if (is_skip_overflow(header->number, skip, reverse)) {
+            unknown = true;
+        } else if (!reverse) {
             BlockNum current = header->number;
             BlockNum next = current + skip + 1;
-            if (next <= current) {  // true only if there is an overflow
+            header = data_model_.read_canonical_header(next);
+            if (!header)
                 unknown = true;
-                log::Warning("HeaderStage") << "GetBlockHeaders skip overflow attack:"
-                                            << " current=" << current << ", skip=" << skip << ", next=" << next;
-            } else {
-                header = data_model_.read_canonical_header(next);
-                if (!header)
+            else {
+                Hash nextHash = header->hash();
+                auto [exp_next_hash, _] = get_ancestor(nextHash, next, skip + 1, max_non_canonical);
+                if (exp_next_hash == hash) {
+                    hash = nextHash;
+                    block_num = next;
+                } else
                     unknown = true;
-                else {
-                    Hash nextHash = header->hash();
-                    auto [exp_next_hash, _] = get_ancestor(nextHash, next, skip + 1, max_non_canonical);
-                    if (exp_next_hash == hash) {
-                        hash = nextHash;
-                        block_num = next;
-                    } else
-                        unknown = true;
-                }
             }
         } else {  // reverse
             BlockNum ancestor_delta = skip + 1;
-            if (ancestor_delta == 0)
-                unknown = true;
-            else
-                std::tie(hash, block_num) = get_ancestor(hash, block_num, ancestor_delta, max_non_canonical);
+            std::tie(hash, block_num) = get_ancestor(hash, block_num, ancestor_delta, max_non_canonical);
         }
 
         // end understand
@@ -78,33 +96,36 @@ std::vector<BlockHeader> HeaderRetrieval::recover_by_hash(Hash origin, uint64_t
 
         header = data_model_.read_header(block_num, hash);
         if (!header) break;
-        headers.push_back(*header);
-        bytes += est_header_rlp_size;
+        push_back_encoded(*header);
 
     } while (headers.size() < amount && bytes < soft_response_limit && headers.size() < max_headers_serve);
 
     return headers;
 }
 
-std::vector<BlockHeader> HeaderRetrieval::recover_by_number(BlockNum origin, uint64_t amount, uint64_t skip,
-                                                            bool reverse) {
-    using std::optional;
-
-    std::vector<BlockHeader> headers;
+std::vector<Bytes> HeaderRetrieval::recover_by_number(BlockNum origin, uint64_t amount, uint64_t skip,
+                                                      bool reverse) {
+    std::vector<Bytes> headers;
     long long bytes = 0;
     BlockNum block_num = origin;
 
     do {
-        optional<BlockHeader> header = data_model_.read_canonical_header(block_num);
+        auto header = read_canonical_rlp_header(block_num);
         if (!header) break;
 
-        headers.push_back(*header);
-        bytes += est_header_rlp_size;
+        bytes += static_cast<long long>(header->size());
+        headers.push_back(std::move(*header));
+
+        if (is_skip_overflow(block_num, skip, reverse)) break;
 
-        if (!reverse)
-            block_num += skip + 1;  // Number based traversal towards the leaf block
-        else
-            block_num -= skip + 1;  // Number based traversal towards the genesis block
+        const uint64_t step = skip + 1;
+        if (!reverse) {
+            block_num += step;  // Number based traversal towards the leaf block
+        } else if (block_num >= step) {
+            block_num -= step;  // Number based traversal towards the genesis block
+        } else {
+            break;
+        }
 
     } while (block_num > 0 && headers.size() < amount && bytes < soft_response_limit &&
              headers.size() < max_headers_serve);
@@ -112,6 +133,21 @@ std::vector<BlockHeader> HeaderRetrieval::recover_by_number(BlockNum origin, uin
     return headers;
 }
 
+std::optional<Bytes> HeaderRetrieval::read_canonical_rlp_header(BlockNum block_num) {
+    const auto hash = db::read_canonical_hash(db_tx_, block_num);
+    if (hash) {
+        const auto stored_header = db::read_rlp_encoded_header(db_tx_, block_num, *hash);
+        if (stored_header) return Bytes{*stored_header};
+    }
+
+    // Header not in db (e.g. it is in snapshots) so we need to go through the data model
+    const auto header = data_model_.read_canonical_header(block_num);
+    if (!header) return std::nullopt;
+    Bytes encoded_header;
+    rlp::encode(encoded_header, *header);
+    return encoded_header;
+}
+
 std::tuple<Hash, BlockNum> HeaderRetrieval::get_ancestor(Hash hash, BlockNum block_num, BlockNum ancestor_delta,
                                                          uint64_t& max_non_canonical) {
     if (ancestor_delta > block_num) return {Hash{}, 0};
@@ -24,25 +24,27 @@ namespace silkworm {
 
 /*
  * HeaderRetrieval has the responsibility to retrieve BlockHeader from the db using the hash or the block number.
+ * Headers are returned RLP-encoded: canonical ones are served as stored in the db, without decoding/re-encoding them.
  */
 class HeaderRetrieval {
   public:
     static const long soft_response_limit = 2 * 1024 * 1024;  // Target maximum size of returned blocks
-    static const long est_header_rlp_size = 500;              // Approximate size of an RLP encoded block header
     static const long max_headers_serve = 1024;               // Amount of block headers to be fetched per retrieval request
 
     explicit HeaderRetrieval(db::ROAccess);
     void close();
 
     // Headers
-    std::vector<BlockHeader> recover_by_hash(Hash origin, uint64_t amount, uint64_t skip, bool reverse);
-    std::vector<BlockHeader> recover_by_number(BlockNum origin, uint64_t amount, uint64_t skip, bool reverse);
+    std::vector<Bytes> recover_by_hash(Hash origin, uint64_t amount, uint64_t skip, bool reverse);
+    std::vector<Bytes> recover_by_number(BlockNum origin, uint64_t amount, uint64_t skip, bool reverse);
 
     // Ancestor
     std::tuple<Hash, BlockNum> get_ancestor(Hash hash, BlockNum block_num, BlockNum ancestor_delta,
                                             uint64_t& max_non_canonical);
 
   protected:
+    std::optional<Bytes> read_canonical_rlp_header(BlockNum block_num);
+
     db::ROTxnManaged db_tx_;
     db::DataModel data_model_;
 };
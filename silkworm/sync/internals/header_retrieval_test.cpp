@@ -0,0 +1,83 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "header_retrieval.hpp"
+
+#include <limits>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/rlp/encode.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/test/context.hpp>
+
+namespace silkworm {
+
+static Bytes encode(const BlockHeader& header) {
+    Bytes encoded;
+    rlp::encode(encoded, header);
+    return encoded;
+}
+
+TEST_CASE("HeaderRetrieval", "[silkworm][sync][HeaderRetrieval]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    context.add_genesis_data();
+
+    // canonical chain: genesis <- 1 <- 2 <- 3
+    auto& txn{context.rw_txn()};
+    std::vector<BlockHeader> headers{*db::read_canonical_header(txn, 0)};
+    for (BlockNum number{1}; number <= 3; ++number) {
+        BlockHeader header;
+        header.number = number;
+        header.parent_hash = headers.back().hash();
+        header.difficulty = 1'000'000;
+        db::write_header(txn, header, /*with_header_numbers=*/true);
+        db::write_canonical_header_hash(txn, header.hash().bytes, number);
+        headers.push_back(header);
+    }
+    context.commit_txn();
+
+    HeaderRetrieval header_retrieval{db::ROAccess{context.env()}};
+    constexpr uint64_t kMaxSkip{std::numeric_limits<uint64_t>::max()};
+
+    SECTION("by number") {
+        CHECK(header_retrieval.recover_by_number(1, 3, 0, /*reverse=*/false) ==
+              std::vector<Bytes>{encode(headers[1]), encode(headers[2]), encode(headers[3])});
+        CHECK(header_retrieval.recover_by_number(3, 3, 0, /*reverse=*/true) ==
+              std::vector<Bytes>{encode(headers[3]), encode(headers[2]), encode(headers[1])});
+        CHECK(header_retrieval.recover_by_number(1, 2, 1, /*reverse=*/false) ==
+              std::vector<Bytes>{encode(headers[1]), encode(headers[3])});
+    }
+
+    SECTION("by number with skip overflow") {
+        // skip + 1 overflows
+        CHECK(header_retrieval.recover_by_number(1, 3, kMaxSkip, /*reverse=*/false) == std::vector<Bytes>{encode(headers[1])});
+        CHECK(header_retrieval.recover_by_number(3, 3, kMaxSkip, /*reverse=*/true) == std::vector<Bytes>{encode(headers[3])});
+        // origin + skip + 1 overflows
+        CHECK(header_retrieval.recover_by_number(2, 3, kMaxSkip - 1, /*reverse=*/false) == std::vector<Bytes>{encode(headers[2])});
+    }
+
+    SECTION("by canonical hash with skip overflow") {
+        const Hash origin{headers[1].hash()};
+        CHECK(header_retrieval.recover_by_hash(origin, 3, kMaxSkip, /*reverse=*/false) == std::vector<Bytes>{encode(headers[1])});
+        CHECK(header_retrieval.recover_by_hash(origin, 3, kMaxSkip, /*reverse=*/true) == std::vector<Bytes>{encode(headers[1])});
+        CHECK(header_retrieval.recover_by_hash(origin, 3, kMaxSkip - 1, /*reverse=*/false) == std::vector<Bytes>{encode(headers[1])});
+    }
+}
+
+}  // namespace silkworm
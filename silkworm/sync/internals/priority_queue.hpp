@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <map>
 #include <queue>
 #include <set>
+#include <utility>
 #include <vector>
 
 /*
@@ -55,6 +60,141 @@ class set_based_priority_queue {  // use boost::priority_queue instead?
     typename impl_t::const_iterator end() const { return elements_.end(); }
 };
 
+/*
+ * A binary heap based priority_queue for ease removal of elements
+ *
+ * Each element stores its own position in the heap, so erase and update are O(log n) without any lookup and push
+ * allocates nothing but the vector growth. Hence an element can be in one queue at a time. Iteration order is the
+ * heap order, not the priority order.
+ *
+ * Sample usage:
+ *   template <>
+ *   struct hbpq_index<std::shared_ptr<Link>> {
+ *        static size_t& value(const std::shared_ptr<Link>& l) {return l->queue_index;}
+ *   };
+ *
+ *   heap_based_priority_queue<std::shared_ptr<Link>, LinkOlderThan> queue;
+ */
+inline constexpr size_t hbpq_no_index = std::numeric_limits<size_t>::max();  // index of an element out of any queue
+
+template <typename T>
+struct hbpq_index {
+    static size_t& value(const T&);  // reference to the index stored in the element
+};
+
+template <typename T, typename CMP = std::less<T>>
+class heap_based_priority_queue {
+    using impl_t = std::vector<T>;
+    impl_t elements_;
+    CMP cmp_;
+
+    static size_t& index_of(const T& element) { return hbpq_index<T>::value(element); }
+
+    void place(size_t pos, T&& element) {
+        index_of(element) = pos;
+        elements_[pos] = std::move(element);
+    }
+
+    void sift_up(size_t pos) {
+        T element = std::move(elements_[pos]);
+        while (pos > 0) {
+            size_t parent = (pos - 1) / 2;
+            if (!cmp_(element, elements_[parent])) break;
+            place(pos, std::move(elements_[parent]));
+            pos = parent;
+        }
+        place(pos, std::move(element));
+    }
+
+    void sift_down(size_t pos) {
+        T element = std::move(elements_[pos]);
+        const size_t size = elements_.size();
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= size) break;
+            if (child + 1 < size && cmp_(elements_[child + 1], elements_[child])) ++child;
+            if (!cmp_(elements_[child], element)) break;
+            place(pos, std::move(elements_[child]));
+            pos = child;
+        }
+        place(pos, std::move(element));
+    }
+
+    void restore_order_at(size_t pos) {
+        if (pos > 0 && cmp_(elements_[pos], elements_[(pos - 1) / 2])) {
+            sift_up(pos);
+        } else {
+            sift_down(pos);
+        }
+    }
+
+    void remove_at(size_t pos) {
+        index_of(elements_[pos]) = hbpq_no_index;
+        if (pos + 1 < elements_.size()) {
+            place(pos, std::move(elements_.back()));
+            elements_.pop_back();
+            restore_order_at(pos);
+        } else {
+            elements_.pop_back();
+        }
+    }
+
+  public:
+    heap_based_priority_queue() = default;
+    heap_based_priority_queue(heap_based_priority_queue&& other) noexcept
+        : elements_{std::exchange(other.elements_, {})}, cmp_{std::move(other.cmp_)} {}
+    heap_based_priority_queue& operator=(heap_based_priority_queue&& other) noexcept {
+        clear();
+        elements_ = std::exchange(other.elements_, {});
+        cmp_ = std::move(other.cmp_);
+        return *this;
+    }
+    heap_based_priority_queue(const heap_based_priority_queue&) = delete;  // an element cannot be in two queues
+    heap_based_priority_queue& operator=(const heap_based_priority_queue&) = delete;
+    ~heap_based_priority_queue() { clear(); }
+
+    [[nodiscard]] const T& top() const { return elements_.front(); }
+    void pop() { remove_at(0); }
+    void push(const T& element) { push(T{element}); }
+    void push(T&& element) {
+        if (contains(element)) return;  // same identity, as for set_based_priority_queue
+        elements_.emplace_back();
+        place(elements_.size() - 1, std::move(element));
+        sift_up(elements_.size() - 1);
+    }
+    size_t erase(const T& element) {
+        if (!contains(element)) return 0;
+        remove_at(index_of(element));
+        return 1;
+    }
+    void clear() {
+        for (auto& element : elements_) index_of(element) = hbpq_no_index;
+        elements_.clear();
+    }
+    [[nodiscard]] size_t size() const { return elements_.size(); }
+    [[nodiscard]] bool empty() const { return elements_.empty(); }
+    [[nodiscard]] bool contains(const T& element) const {
+        const size_t pos = index_of(element);
+        return pos < elements_.size() && elements_[pos] == element;
+    }
+
+    bool update(const T& element, std::function<void(T& element)> apply_change) {
+        if (!contains(element)) return false;
+        const size_t pos = index_of(element);
+        apply_change(elements_[pos]);
+        restore_order_at(pos);
+        return true;
+    }
+
+    void push_all(const std::vector<T>& source) {
+        elements_.reserve(elements_.size() + source.size());
+        for (auto& element : source) push(element);
+    }  // bulk insert
+
+    typename impl_t::const_iterator begin() const { return elements_.begin(); }
+    typename impl_t::const_iterator end() const { return elements_.end(); }
+};
+
 /*
  * A multimap based priority_queue for ease removal of elements
  *
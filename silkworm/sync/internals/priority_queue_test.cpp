@@ -15,6 +15,8 @@
 */
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -183,20 +185,12 @@ TEST_CASE("Oldest_First_Anchor_Queue") {
         CHECK(queue.size() == 0);
     }
 
-    SECTION("in order iterating") {
-        auto begin = queue.begin();
-        auto& elem1 = *begin;
+    SECTION("iterating") {
+        // iteration follows the heap order, only the top is guaranteed to be the first
+        auto& elem1 = *queue.begin();
         CHECK((elem1->timestamp == now && elem1->blockHeight == 1));
-        auto& elem2 = *(++begin);
-        CHECK((elem2->timestamp == now && elem2->blockHeight == 3));
-        auto& elem3 = *(++begin);
-        CHECK((elem3->timestamp == now + 2s));
-        auto& elem4 = *(++begin);
-        CHECK((elem4->timestamp == now + 4s));
-
-        auto end = queue.end();
-        auto& elem4bis = *(--end);
-        CHECK((elem4bis->timestamp == now + 4s));
+        CHECK(std::distance(queue.begin(), queue.end()) == 4);
+        CHECK(std::count_if(queue.begin(), queue.end(), [&](const auto& a) { return a->timestamp > now; }) == 2);
     }
 
     SECTION("updating items") {
@@ -340,6 +334,44 @@ TEST_CASE("Oldest_First_Link_Queue") {
     }
 }
 
+TEST_CASE("Oldest_First_Link_Queue - heap order") {
+    BlockHeader dummy_header;
+    bool persisted = false;
+
+    OldestFirstLinkQueue queue;
+    std::vector<std::shared_ptr<Link>> links;
+    for (BlockNum i = 0; i < 100; i++) {
+        auto link = std::make_shared<Link>(dummy_header, persisted);
+        link->blockHeight = (i * 37) % 50;  // scrambled heights, each one repeated twice
+        links.push_back(link);
+    }
+    queue.push_all(links);
+    REQUIRE(queue.size() == 100);
+
+    // removal from the middle of the heap keeps the order of the others
+    for (size_t i = 0; i < links.size(); i += 3) {
+        CHECK(queue.erase(links[i]) == 1);
+        CHECK(links[i]->queue_index == hbpq_no_index);
+        CHECK(queue.erase(links[i]) == 0);  // already removed
+    }
+    REQUIRE(queue.size() == 66);
+
+    BlockNum prev_height = 0;
+    while (!queue.empty()) {
+        auto link = queue.top();
+        queue.pop();
+        CHECK(link->blockHeight >= prev_height);
+        CHECK_FALSE(queue.contains(link));
+        prev_height = link->blockHeight;
+    }
+
+    // a link popped from a queue can be pushed into another one
+    OldestFirstLinkQueue other_queue;
+    other_queue.push(links[1]);
+    CHECK(other_queue.contains(links[1]));
+    CHECK_FALSE(queue.contains(links[1]));
+}
+
 TEST_CASE("Oldest_First_Link_Map") {
     using namespace std::literals::chrono_literals;
     BlockHeader dummy_header;
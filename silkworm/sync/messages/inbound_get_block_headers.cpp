@@ -42,7 +42,7 @@ void InboundGetBlockHeaders::execute(db::ROAccess db, HeaderChain&, BodySequence
 
     HeaderRetrieval header_retrieval(db);
 
-    BlockHeadersPacket66 reply;
+    BlockHeadersRlpPacket66 reply;
     reply.requestId = packet_.requestId;
     if (holds_alternative<Hash>(packet_.request.origin)) {
         reply.request = header_retrieval.recover_by_hash(get<Hash>(packet_.request.origin), packet_.request.amount,
@@ -24,7 +24,7 @@ namespace silkworm {
 
 class OutboundBlockHeaders : public OutboundMessage {
   public:
-    explicit OutboundBlockHeaders(BlockHeadersPacket66 packet) : packet_(std::move(packet)) {}
+    explicit OutboundBlockHeaders(BlockHeadersRlpPacket66 packet) : packet_(std::move(packet)) {}
 
     [[nodiscard]] std::string name() const override { return "OutboundBlockHeaders"; }
     [[nodiscard]] std::string content() const override;
@@ -38,7 +38,7 @@ class OutboundBlockHeaders : public OutboundMessage {
     [[nodiscard]] Bytes message_data() const override;
 
   private:
-    BlockHeadersPacket66 packet_{};
+    BlockHeadersRlpPacket66 packet_{};
 };
 
 }  // namespace silkworm
@@ -29,8 +29,18 @@ struct BlockHeadersPacket66 {  // eth/66 version
     BlockHeadersPacket request;
 };
 
+//! The same as BlockHeadersPacket66 but with headers already RLP-encoded, so that they can be served without decoding
+struct BlockHeadersRlpPacket66 {  // eth/66 version
+    uint64_t requestId;
+    std::vector<Bytes> request;
+};
+
 namespace rlp {
 
+    size_t length(const BlockHeadersRlpPacket66& from) noexcept;
+
+    void encode(Bytes& to, const BlockHeadersRlpPacket66& from);
+
     size_t length(const BlockHeadersPacket66& from) noexcept;
 
     void encode(Bytes& to, const BlockHeadersPacket66& from);
@@ -52,4 +62,10 @@ inline std::ostream& operator<<(std::ostream& os, const BlockHeadersPacket66& pa
     return os;
 }
 
+inline std::ostream& operator<<(std::ostream& os, const BlockHeadersRlpPacket66& packet) {
+    os << "reqId=" << packet.requestId;
+    os << " headers=" << packet.request.size();
+    return os;
+}
+
 }  // namespace silkworm
@@ -1095,6 +1095,19 @@ TEST_CASE("BlockHeadersPacket (eth/66) decoding/encoding") {
     // length test
     auto len = rlp::length(packet);
     REQUIRE(len == re_encoded.size());
+
+    // encoding test using already RLP-encoded headers
+    BlockHeadersRlpPacket66 rlp_packet;
+    rlp_packet.requestId = packet.requestId;
+    for (const auto& header : packet.request) {
+        Bytes encoded_header;
+        rlp::encode(encoded_header, header);
+        rlp_packet.request.push_back(std::move(encoded_header));
+    }
+    Bytes rlp_packet_encoded;
+    rlp::encode(rlp_packet_encoded, rlp_packet);
+    REQUIRE(to_hex(rlp_packet_encoded) == raw_packet);
+    REQUIRE(rlp::length(rlp_packet) == rlp_packet_encoded.size());
 }
 
 // TESTs related to BlockBodiesPacket66 encoding/decoding - eth/66 version
@@ -40,6 +40,37 @@ size_t length(const BlockHeadersPacket66& from) noexcept { return rlp::length_et
 
 void encode(Bytes& to, const BlockHeadersPacket66& from) { return rlp::encode_eth66_packet(to, from); }
 
+// BlockHeadersRlpPacket66: headers are already RLP-encoded and are copied verbatim
+static size_t headers_payload_length(const std::vector<Bytes>& headers) noexcept {
+    size_t payload_length{0};
+    for (const auto& header : headers) {
+        payload_length += header.size();
+    }
+    return payload_length;
+}
+
+size_t length(const BlockHeadersRlpPacket66& from) noexcept {
+    const size_t headers_length = headers_payload_length(from.request);
+    rlp::Header rlp_head{true, rlp::length(from.requestId) + rlp::length_of_length(headers_length) + headers_length};
+
+    size_t rlp_head_len = rlp::length_of_length(rlp_head.payload_length);
+    return rlp_head_len + rlp_head.payload_length;
+}
+
+void encode(Bytes& to, const BlockHeadersRlpPacket66& from) {
+    const size_t headers_length = headers_payload_length(from.request);
+    rlp::Header rlp_head{true, rlp::length(from.requestId) + rlp::length_of_length(headers_length) + headers_length};
+
+    to.reserve(to.size() + rlp::length_of_length(rlp_head.payload_length) + rlp_head.payload_length);
+    rlp::encode_header(to, rlp_head);
+
+    rlp::encode(to, from.requestId);
+    rlp::encode_header(to, {true, headers_length});
+    for (const auto& header : from.request) {
+        to.append(header);
+    }
+}
+
 size_t length(const GetBlockBodiesPacket66& from) noexcept { return rlp::length_eth66_packet(from); }
 
 void encode(Bytes& to, const GetBlockBodiesPacket66& from) { return rlp::encode_eth66_packet(to, from); }